@@ -32,6 +32,7 @@
 #include <TGUI/Text.hpp>
 #include <TGUI/Outline.hpp>
 #include <TGUI/RenderStates.hpp>
+#include <memory>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -39,6 +40,7 @@ namespace tgui
 {
     class Widget;
     class RootContainer;
+    class DisplayList;
 
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -190,6 +192,86 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual void drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor, float radius,
                                           const Borders& borders = {0}, const Color& borderColor = Color::Black);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a display list in an offscreen image and returns its pixels
+        ///
+        /// @param displayList  Draw calls to execute, e.g. recorded with BackendRenderTargetRecorder
+        /// @param region       Part of the coordinate system of the draw calls that has to end up in the image
+        /// @param size         Size of the image in pixels
+        ///
+        /// @return Array of size.x * size.y * 4 bytes with RGBA pixels, or nullptr if the render target can't draw offscreen
+        ///
+        /// The image is fully transparent before the draw calls are executed. The returned pixels aren't premultiplied with
+        /// their alpha, so they can be loaded in a texture and drawn on top of something else like any other image.
+        /// This function may be called while the gui is being drawn. The default implementation always returns nullptr.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual std::unique_ptr<std::uint8_t[]> drawOffscreen(const DisplayList& displayList, FloatRect region, Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of primitives that were skipped because they were entirely outside the clipping area
+        ///
+        /// @return Amount of sprites, texts and triangle lists that weren't drawn since the gui was last drawn
+        ///
+        /// The counter is reset each time drawGui or drawGuiRegion is called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCulledPrimitiveCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area covered by a sprite, before the transform of the render states is applied
+        ///
+        /// @param sprite  Sprite that would be drawn
+        ///
+        /// @return Bounding box of the sprite, which includes its position and rotation
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FloatRect getSpriteBounds(const Sprite& sprite);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area that may be covered by a text, before the transform of the render states is applied
+        ///
+        /// @param text  Text that would be drawn
+        ///
+        /// @return Bounding box of the text with a margin for glyphs that extend outside the text (e.g. italic text or outlines)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FloatRect getTextBounds(const Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area covered by vertices, before the transform of the render states is applied
+        ///
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the array of vertices
+        ///
+        /// @return Smallest rectangle that contains all vertex positions
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static FloatRect getVertexBounds(const Vertex* vertices, std::size_t vertexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Drawing on a transparent image results in colors that are premultiplied with their alpha,
+        // this function divides the color channels by the alpha channel to get the original colors back.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void unpremultiplyAlpha(std::uint8_t* pixels, std::size_t pixelCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether the transformed bounds lie entirely outside the clip rect, in which case the primitive doesn't need to
+        // be drawn. The bounding box of the transformed bounds is used, so rotated primitives may not always be culled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCulled(const Transform& transform, const FloatRect& bounds, const FloatRect& clipRect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::size_t m_culledPrimitiveCount = 0;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
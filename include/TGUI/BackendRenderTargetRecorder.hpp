@@ -0,0 +1,184 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_RENDER_TARGET_RECORDER_HPP
+#define TGUI_BACKEND_RENDER_TARGET_RECORDER_HPP
+
+#include <TGUI/BackendRenderTarget.hpp>
+#include <TGUI/DisplayList.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target that doesn't draw anything but records the draw calls into a display list
+    ///
+    /// Example usage to only draw the gui when it changed:
+    /// @code
+    /// tgui::BackendRenderTargetRecorder recorder;
+    /// tgui::DisplayList previousFrame;
+    /// ...
+    /// recorder.setView(gui.getView().getRect(), gui.getViewport().getRect());
+    /// recorder.drawGui(gui.getContainer());
+    /// if (recorder.getDisplayList() != previousFrame)
+    /// {
+    ///     // Draw the frame
+    ///     previousFrame = recorder.getDisplayList();
+    /// }
+    /// @endcode
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendRenderTargetRecorder : public BackendRenderTargetBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the commands that were recorded
+        ///
+        /// @return Display list containing the calls made since the last call to drawGui or clear
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const DisplayList& getDisplayList() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all recorded commands
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the render target about which part of the window is used for rendering
+        ///
+        /// @param view     Defines which part of the gui is being shown
+        /// @param viewport Defines which part of the window is being rendered to
+        ///
+        /// The view is only used to skip recording widgets that wouldn't be visible. As long as no view is set, all widgets
+        /// are recorded.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(FloatRect view, FloatRect viewport) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the draw calls of the gui and all of its widgets
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        ///
+        /// The commands that were recorded before are removed first.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGui(const std::shared_ptr<RootContainer>& root) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records the draw calls of a widget, if the widget is visible
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param widget  The widget to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a command to add another clipping region
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param rect    The clipping region
+        ///
+        /// @warning Every call must have a matching call to removeClippingLayer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addClippingLayer(const RenderStates& states, FloatRect rect) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a command to remove the last added clipping region
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeClippingLayer() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a command to draw borders
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param borders  Size of the borders on each side
+        /// @param size     Size of the rectangle that is formed by the borders
+        /// @param color    Color of the borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a command to draw a filled rectangle
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param size    Size of the rectangle
+        /// @param color   Color of the rectangle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawFilledRect(const RenderStates& states, Vector2f size, Color color) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a command to draw a texture
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param sprite  Image to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawSprite(const RenderStates& states, const Sprite& sprite) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a command to draw some text
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param text    Text to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(const RenderStates& states, const Text& text) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Records a command to draw one or more triangles
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        ///
+        /// Circles and rounded rectangles are also recorded as triangles.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        DisplayList m_displayList;
+        FloatRect m_viewRect;
+        std::vector<FloatRect> m_clippingLayers;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_RENDER_TARGET_RECORDER_HPP
@@ -41,10 +41,16 @@ namespace tgui
     {
     public:
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendTextureBase();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Virtual destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        virtual ~BackendTextureBase() = default;
+        virtual ~BackendTextureBase();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -52,10 +58,26 @@ namespace tgui
         ///
         /// @param size   Width and height of the image to create
         /// @param pixels Moved pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
+        ///
+        /// The pixels aren't kept in memory. Only a mask with 1 bit per pixel is created to answer isTransparentPixel,
+        /// unless the alpha mask is disabled or none of the pixels are transparent.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         virtual bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture
+        ///
+        /// @param position Position of the top-left pixel of the part to change
+        /// @param size     Width and height of the part to change
+        /// @param pixels   Array of size.x*size.y*4 bytes with the new RGBA pixels
+        ///
+        /// The texture must have been loaded before and the part must lie inside of it. Only the changed pixels are copied,
+        /// which is much cheaper than loading the entire texture again when only a small part of a large texture changes.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        virtual bool update(Vector2u position, Vector2u size, const std::uint8_t* pixels);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
@@ -89,11 +111,101 @@ namespace tgui
         bool isTransparentPixel(Vector2u pixel) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether a mask of transparent pixels is kept for this texture
+        ///
+        /// @param enabled  Should isTransparentPixel be able to tell which pixels are transparent?
+        ///
+        /// Disabling the mask releases its memory, after which isTransparentPixel always returns false. Enabling it only has
+        /// an effect when the texture is loaded again, as the pixels that are needed to create the mask are no longer available.
+        /// The mask is enabled by default unless setDefaultAlphaMaskEnabled(false) was called before creating the texture.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAlphaMaskEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a mask of transparent pixels is kept for this texture
+        ///
+        /// @return Is the alpha mask created when the texture is loaded?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAlphaMaskEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether textures that are created from now on keep a mask of transparent pixels
+        ///
+        /// @param enabled  Should new textures be able to tell which pixels are transparent?
+        ///
+        /// Only widgets with the TransparentTexture renderer property need the mask to ignore mouse events on transparent pixels.
+        /// If no widget relies on this then disabling the mask saves memory.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDefaultAlphaMaskEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether textures that are created from now on keep a mask of transparent pixels
+        ///
+        /// @return Is the alpha mask enabled for new textures?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool getDefaultAlphaMaskEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Moves the alpha mask of another texture with the same size into this texture
+        ///
+        /// @param other  Texture that gives up its alpha mask
+        ///
+        /// This is used by the texture manager to keep isTransparentPixel working after it released the pixels of an image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void takeAlphaMask(BackendTextureBase& other);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of memory in RAM that is used by all textures combined
+        ///
+        /// @return Bytes used by alpha masks and by pixels that backends keep in memory (e.g. the software renderer)
+        ///
+        /// The memory used by the textures on the GPU isn't included.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getCpuMemoryUsage();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the amount of memory that this texture reports as being used in RAM. Derived classes that keep data in memory
+        // call this so that the data is included in getCpuMemoryUsage.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCpuMemoryUsage(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the alpha mask from the pixels, or releases it when none of the pixels are transparent.
+        // The memory usage isn't updated by this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void createAlphaMask(const std::uint8_t* pixels);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the bits of the alpha mask for a part of the image, creating the mask if the part has transparent pixels.
+        // The memory usage isn't updated by this function.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateAlphaMask(Vector2u position, Vector2u size, const std::uint8_t* pixels);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         Vector2u m_imageSize;
-        std::unique_ptr<std::uint8_t[]> m_pixels;
+        std::unique_ptr<std::uint8_t[]> m_alphaMask; // One bit per pixel, set when the pixel is transparent
+        bool m_alphaMaskEnabled = true;
+        std::size_t m_alphaMaskSize = 0;
+        std::size_t m_cpuMemoryUsage = 0;
+
+        static bool m_defaultAlphaMaskEnabled;
+        static std::size_t m_totalCpuMemoryUsage;
     };
 }
 
@@ -27,11 +27,18 @@
 #define TGUI_BACKEND_FONT_SDL_HPP
 
 #include <TGUI/BackendFont.hpp>
+#include <TGUI/FontFileCache.hpp>
+
+#include <unordered_map>
+#include <vector>
+#include <array>
 
 #include <SDL_ttf.h>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+typedef unsigned int GLuint;
+
 namespace tgui
 {
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -41,6 +48,14 @@ namespace tgui
     {
     public:
 
+        /// Glyph that was rasterized into the glyph atlas of the font
+        struct AtlasGlyph
+        {
+            UIntRect textureRect; //!< Part of the atlas texture that contains the glyph (width and height are 0 for whitespace)
+            Vector2f offset;      //!< Position of the top-left corner of the glyph, relative to the pen position at the top of the line
+            float    advance = 0; //!< Offset to move horizontally to the next character
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Destructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -129,13 +144,142 @@ namespace tgui
         TTF_Font* loadInternalFont(unsigned int characterSize) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves a glyph from the glyph atlas, rasterizing it into the atlas if it wasn't used before
+        ///
+        /// @param codePoint      Unicode code point of the character to get
+        /// @param characterSize  Size of the character
+        /// @param style          Combination of TTF_STYLE_* flags
+        /// @param outline        Thickness of the outline, or 0 to get the filled glyph
+        ///
+        /// @return Glyph in the atlas, or nullptr if the glyph couldn't be rasterized
+        ///
+        /// Each combination of code point, character size, style and outline is only rasterized once. All glyphs are stored
+        /// in a single texture that grows when it becomes full. The texture only has an alpha channel, its colors are white.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const AtlasGlyph* getAtlasGlyph(char32_t codePoint, unsigned int characterSize, int style, int outline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the OpenGL texture that contains the glyph atlas
+        ///
+        /// @return Atlas texture, or 0 if no glyph was added to the atlas yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GLuint getAtlasTexture() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the glyph atlas texture
+        ///
+        /// @return Size of the atlas texture in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getAtlasSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the glyph atlas to a file, so that it can be loaded again with loadGlyphCache on the next run
+        ///
+        /// @param filename  Filename of the cache file to create
+        ///
+        /// @return True if the file was written, false if no font was loaded or the file couldn't be opened for writing
+        ///
+        /// The cache is written automatically when the font is destroyed if GlyphAtlasCache::setDirectory was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveGlyphCache(const String& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the glyph atlas with the one stored in a file that was created with saveGlyphCache
+        ///
+        /// @param filename  Filename of the cache file to read
+        ///
+        /// @return True if the atlas was loaded, false if the file doesn't exist or was created for a different font file
+        ///         or TGUI version, in which case the atlas remains unchanged
+        ///
+        /// Glyphs that are found in the cache no longer have to be rendered by SDL_ttf. The font has to be loaded first.
+        /// The cache is loaded automatically when the font is loaded if GlyphAtlasCache::setDirectory was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadGlyphCache(const String& filename);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
-        std::unique_ptr<std::uint8_t[]> m_fileContents;
-        std::size_t m_fileSize = 0;
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Starts using file contents that may be shared with other fonts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFileContents(std::shared_ptr<const FontFileCache::FileContents> fileContents);
+
+
+        // Metrics of glyphs and kerning pairs for one combination of character size, style and outline
+        struct GlyphMetricsTable
+        {
+            std::array<FontGlyph, 128> asciiGlyphs;
+            std::array<bool, 128> asciiGlyphsLoaded{}; // Tells which entries in asciiGlyphs are valid
+            std::unordered_map<char32_t, FontGlyph> otherGlyphs;
+            std::unordered_map<std::uint64_t, float> kernings; // Key contains the first code point in the upper 32 bits
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the cached metrics for the given character size, style and outline, creating the table if needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GlyphMetricsTable& getGlyphMetricsTable(unsigned int characterSize, int style, int outline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Asks SDL_ttf for the metrics of a glyph. An empty glyph is returned if the font doesn't contain the character.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FontGlyph loadGlyphMetrics(TTF_Font* font, char32_t codePoint, int style, int outline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rasterizes a glyph and copies it into the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AtlasGlyph rasterizeAtlasGlyph(char32_t codePoint, unsigned int characterSize, int style, int outline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds a free spot in the atlas for a glyph of the given size, the atlas is enlarged when needed.
+        // Returns false if the glyph didn't fit in the atlas.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool findAtlasSpace(unsigned int width, unsigned int height, Vector2u& position);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the size of the atlas texture while keeping the glyphs that were already added to it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeAtlas(Vector2u newSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::shared_ptr<const FontFileCache::FileContents> m_fileContents;
         unsigned int m_lastCharacterSize = 0;
         TTF_Font* m_cachedFont = nullptr;
+
+        // Row in the atlas in which glyphs of a similar height are placed next to each other
+        struct AtlasRow
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int width;
+        };
+
+        GLuint m_atlasTexture = 0;
+        Vector2u m_atlasSize;
+        std::vector<std::uint8_t> m_atlasPixels; // Copy of the alpha values in the atlas, needed to resize the texture
+        std::vector<AtlasRow> m_atlasRows;
+        std::unordered_map<std::uint64_t, AtlasGlyph> m_atlasGlyphs;
+
+        String m_glyphCacheFilename; // Cache file that is automatically loaded and saved, empty when the cache is disabled
+        bool m_glyphCacheOutdated = false; // Were glyphs added to the atlas since the cache file was loaded?
+
+        // Glyph metrics are cached because changing the style or outline of a TTF_Font clears its internal cache
+        std::unordered_map<std::uint64_t, GlyphMetricsTable> m_glyphMetrics;
+        GlyphMetricsTable* m_lastGlyphMetricsTable = nullptr;
+        std::uint64_t m_lastGlyphMetricsKey = 0;
     };
 }
 
@@ -44,6 +44,25 @@ namespace tgui
     {
     public:
 
+        /// Layout of a vertex as it is stored in the vertex buffer
+        struct VertexGL
+        {
+            float position[2];
+            std::uint8_t color[4];
+            float texCoords[2];
+            float shapePosition[2];      //!< Position relative to the center of a shape drawn by the shader
+            float shapeSize[4];          //!< Half width, half height, corner radius and border width (all 0 for normal vertices)
+            std::uint8_t borderColor[4]; //!< Border color of a shape drawn by the shader
+        };
+
+        /// Amount of draw calls made while drawing the last frame
+        struct DrawStatistics
+        {
+            std::size_t submittedDrawCalls = 0; //!< Amount of draw calls that would have been made without batching
+            std::size_t executedDrawCalls = 0;  //!< Amount of glDrawElements calls that were actually made
+            std::size_t vertexCount = 0;        //!< Amount of vertices that were uploaded to the GPU
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Constructs the render target and informs it to which window it is bound
         ///
@@ -66,6 +85,57 @@ namespace tgui
         SDL_Window* getWindow() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether draw calls are batched together
+        ///
+        /// @param enabled  Should draw calls be combined into as few OpenGL draw calls as possible?
+        ///
+        /// When batching is enabled, all vertices that are drawn inside drawGui are collected into a single buffer and only
+        /// send to OpenGL at the end of the frame. Consecutive draws that use the same texture and clipping rectangle are merged
+        /// into a single glDrawElements call. Batching is disabled by default.
+        ///
+        /// @warning This function should not be called while the gui is being drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setBatchingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether draw calls are batched together
+        ///
+        /// @return Are draw calls combined into as few OpenGL draw calls as possible?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isBatchingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether circles and rounded rectangles are drawn by the shader
+        ///
+        /// @param enabled  Should circles and rounded rectangles be drawn as a single quad?
+        ///
+        /// When enabled (default), drawCircle and drawRoundedRectangle send a single quad to the GPU and the fragment shader
+        /// calculates the distance to the edge of the shape, which also gives these shapes anti-aliased edges.
+        /// When disabled, the shapes are split into many triangles on the CPU like in the other backends. Rounded rectangles
+        /// with borders that aren't the same on all sides are always drawn with triangles.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setAnalyticShapesEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether circles and rounded rectangles are drawn by the shader
+        ///
+        /// @return Are circles and rounded rectangles drawn as a single quad?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isAnalyticShapesEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of draw calls that were made while drawing the last frame
+        ///
+        /// @return Amount of draw calls before and after batching
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        DrawStatistics getDrawStatistics() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Informs the render target about which part of the window is used for rendering
         ///
@@ -83,6 +153,32 @@ namespace tgui
         void drawGui(const std::shared_ptr<RootContainer>& root) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redraws only the part of the gui that lies inside the given region
+        ///
+        /// @param root    Root container that holds all widgets in the gui
+        /// @param region  Part of the view that has to be redrawn, which is rounded to the nearest pixels
+        ///
+        /// Drawing is limited to the region with a scissor rect on the current framebuffer. The region isn't cleared, the widgets
+        /// are drawn on top of whatever the region currently contains.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redraws the damaged regions of the gui in a framebuffer that keeps the previous frame and copies it to the window
+        ///
+        /// @param root     Root container that holds all widgets in the gui
+        /// @param regions  Parts of the view that changed since the previous call
+        ///
+        /// Only the regions are cleared (with the current OpenGL clear color) and redrawn, the rest of the framebuffer still
+        /// contains the gui from the previous call. Afterwards the entire viewport is copied to the current framebuffer (normally
+        /// the window), replacing its contents, even when there were no regions to redraw.
+        /// The first call and calls after the window was resized always redraw the entire gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawDamagedRegions(const std::shared_ptr<RootContainer>& root, const std::vector<FloatRect>& regions);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws a widget, if the widget is visible
         ///
@@ -145,19 +241,101 @@ namespace tgui
         void drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a circle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Diameter of the circle
+        /// @param backgroundColor  Color to fill the circle with
+        /// @param borderThickness  Thickness of the border to draw around the circle (outside given size if thickness is positive)
+        /// @param borderColor      Color of the border, if borderThickness differs from 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness = 0, const Color& borderColor = {}) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a rounded rectangle
+        ///
+        /// @param states           Render states to use for drawing
+        /// @param size             Size of the rectangle (includes borders)
+        /// @param backgroundColor  Fill color of the rectangle
+        /// @param radius           Radius of the rounded corners
+        /// @param borders          Optional borders on the sides of the rectangle (must be the same on all sides)
+        /// @param borderColor      Color of the borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor, float radius,
+                                  const Borders& borders = {0}, const Color& borderColor = Color::Black) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a display list in an offscreen framebuffer and returns its pixels
+        ///
+        /// @param displayList  Draw calls to execute, e.g. recorded with BackendRenderTargetRecorder
+        /// @param region       Part of the coordinate system of the draw calls that has to end up in the image
+        /// @param size         Size of the image in pixels
+        ///
+        /// @return Array of size.x * size.y * 4 bytes with RGBA pixels that aren't premultiplied with their alpha
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<std::uint8_t[]> drawOffscreen(const DisplayList& displayList, FloatRect region, Vector2u size) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        /// Part of the batch that can be drawn with a single draw call
+        struct BatchCommand
+        {
+            GLuint textureId;
+            std::array<int, 4> clipRectGL;
+            std::size_t indexOffset;
+            std::size_t indexCount;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws vertices directly or adds them to the batch, depending on whether batching is enabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawVertices(const Transform& transform, GLuint textureId, const Vertex* vertices, std::size_t vertexCount,
+                          const int* indices, std::size_t indexCount);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Fills the vertex and index buffers
+        // Draws indices that were appended to the staging buffers directly or adds them to the batch
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void prepareVerticesAndIndices(const Sprite& sprite);
+        void drawStagedIndices(GLuint textureId, std::size_t indexOffset, std::size_t indexCount);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Fills the vertex and index buffers
+        // Adds indices that were appended to the staging buffers to the batch, merging them with the previous draw call when possible
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void prepareVerticesAndIndices(const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount, Vector2u textureSize = {1,1});
+        void addToBatch(GLuint textureId, std::size_t indexOffset, std::size_t indexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws a rounded rectangle with optional borders as a single quad, the fragment shader determines the shape
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawAnalyticShape(const Transform& transform, Vector2f position, Vector2f size, float radius, float borderWidth,
+                               const Color& backgroundColor, const Color& borderColor);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uploads the batch to the GPU and draws it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void flushBatch();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Transforms the vertices, converts them to the format used by the shader and appends them to the staging buffers
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void appendToStagingBuffers(const Transform& transform, const Vertex* vertices, std::size_t vertexCount,
+                                    const int* indices, std::size_t indexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Copies the staging buffers into free space of the vertex and index buffers and clears the staging buffers.
+        // Returns the position in the index buffer where the first index was placed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t uploadStagingBuffers();
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -167,15 +345,16 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Updates the matrix in the shader that will transform each vertex
+        // Draws a single line of text
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateTransformation(const Transform& transform);
+        void drawTextLine(const Transform& transform, const SDL_Rect& bounding, GLuint textureId);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Draws a single line of text
+        // Redraws the part of the gui inside the region, rounded to pixels, with the region as outer clipping layer.
+        // The scissor test has to be enabled when the region should first be cleared.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void drawTextLine(const SDL_Rect& bounding, GLuint textureId);
+        void redrawRegion(const std::shared_ptr<RootContainer>& root, FloatRect region, bool clearRegion);
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -186,8 +365,10 @@ namespace tgui
         GLuint m_vertexBuffer = 0;
         GLuint m_indexBuffer = 0;
         GLuint m_emptyTexture = 0;
-        std::size_t m_vertexBufferSize = 0;
-        std::size_t m_indexBufferSize = 0;
+        std::size_t m_vertexBufferSize = 0; // Capacity of the vertex buffer in vertices
+        std::size_t m_indexBufferSize = 0; // Capacity of the index buffer in indices
+        std::size_t m_vertexBufferOffset = 0; // Position in the vertex buffer from where free space starts
+        std::size_t m_indexBufferOffset = 0; // Position in the index buffer from where free space starts
 
         SDL_Window* m_window = nullptr;
         int m_windowWidth = 0;
@@ -199,6 +380,21 @@ namespace tgui
 
         Transform m_projectionTransform;
         GLint m_projectionMatrixUniformLocation = 0;
+
+        bool m_batchingEnabled = false;
+        bool m_analyticShapesEnabled = true;
+        std::vector<BatchCommand> m_batchCommands;
+        std::vector<VertexGL> m_stagingVertices;
+        std::vector<GLuint> m_stagingIndices;
+        DrawStatistics m_drawStatistics;
+
+        GLuint m_offscreenFramebuffer = 0; // Used by drawOffscreen, only grows so that it can be reused for smaller images
+        GLuint m_offscreenTexture = 0;
+        Vector2i m_offscreenFramebufferSize;
+
+        GLuint m_retainedFramebuffer = 0; // Keeps the gui from the previous frame for drawDamagedRegions
+        GLuint m_retainedTexture = 0;
+        Vector2i m_retainedFramebufferSize;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
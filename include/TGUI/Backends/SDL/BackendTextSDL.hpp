@@ -27,6 +27,7 @@
 #define TGUI_BACKEND_TEXT_SDL_HPP
 
 #include <TGUI/BackendText.hpp>
+#include <TGUI/Vertex.hpp>
 #include <vector>
 
 #include <SDL.h>
@@ -144,6 +145,50 @@ namespace tgui
         const std::vector<LineTexture>& getInternalOutlineTextures();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether texts are rendered with quads from the glyph atlas of the font
+        ///
+        /// @param enabled  Should texts be drawn per glyph from a shared atlas instead of with a texture per line?
+        ///
+        /// When enabled, each glyph is only rasterized once per font, size, style and outline. Changing the text then only
+        /// requires new vertices to be generated instead of new textures to be created. Since all texts with the same font use
+        /// the same texture, they can also be batched together by the render target. The glyph atlas is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setGlyphAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether texts are rendered with quads from the glyph atlas of the font
+        ///
+        /// @return Are texts drawn per glyph from a shared atlas instead of with a texture per line?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isGlyphAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the vertices of the glyph quads, with texture coordinates in pixels inside the glyph atlas
+        ///
+        /// @return Vertices to draw, outline glyphs are placed in front of the filled glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Vertex>& getGlyphVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the glyph quads
+        ///
+        /// @return Indices into the vertices returned by getGlyphVertices
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<int>& getGlyphIndices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the texture of the glyph atlas that is used by the glyph vertices
+        ///
+        /// @return Atlas texture of the font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GLuint getGlyphAtlasTexture() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -159,6 +204,18 @@ namespace tgui
         LineTexture createLineTexture(TTF_Font* font, int verticalOffset, std::string line, const SDL_Color& color, int outline);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the glyph vertices and indices
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateGlyphVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a quad for every glyph in the text, either for the filled glyphs or for their outline
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addGlyphQuads(float lineSpacing, const SDL_Color& color, int outline);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -173,8 +230,14 @@ namespace tgui
         SDL_Color m_outlineColor = {0, 0, 0, 255};
         std::vector<String> m_lines;
 
+        std::vector<Vertex> m_glyphVertices;
+        std::vector<int> m_glyphIndices;
+
         Vector2f m_size;
         bool m_texturesValid = false;
+        bool m_glyphVerticesValid = false;
+
+        static bool m_glyphAtlasEnabled;
     };
 }
 
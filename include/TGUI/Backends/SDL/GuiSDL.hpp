@@ -70,6 +70,16 @@ namespace tgui
         void setWindow(SDL_Window* window);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the render target that is used to draw the gui
+        ///
+        /// @return Render target of the gui, or nullptr when no window was set yet
+        ///
+        /// The render target can e.g. be used to enable batching of draw calls.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendRenderTargetSDL> getRenderTarget() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Passes the event to the widgets
         ///
@@ -92,6 +102,11 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui
+        ///
+        /// When damage tracking is enabled, the gui is kept in a framebuffer that still contains the previous frame. Only the
+        /// regions that changed since the previous call are cleared (with the current OpenGL clear color) and redrawn, with a
+        /// scissor rect. Afterwards the gui replaces the contents of the window inside the viewport.
+        /// @see setDamageTrackingEnabled
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw() override;
 
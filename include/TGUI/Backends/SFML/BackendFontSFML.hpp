@@ -27,6 +27,7 @@
 #define TGUI_BACKEND_FONT_SFML_HPP
 
 #include <TGUI/BackendFont.hpp>
+#include <TGUI/FontFileCache.hpp>
 #include <SFML/Graphics/Font.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -114,10 +115,20 @@ namespace tgui
         sf::Font& getInternalFont();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Loads the SFML font from file contents that may be shared with other fonts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFileContents(std::shared_ptr<const FontFileCache::FileContents> fileContents);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
         sf::Font m_font;
+        std::shared_ptr<const FontFileCache::FileContents> m_fileContents; // SFML reads from this memory while the font exists
     };
 }
 
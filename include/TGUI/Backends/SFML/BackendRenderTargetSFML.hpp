@@ -36,6 +36,7 @@
 namespace sf
 {
     class RenderTarget;
+    class RenderTexture;
 }
 
 namespace tgui
@@ -80,6 +81,19 @@ namespace tgui
         void drawGui(const std::shared_ptr<RootContainer>& root) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redraws the damaged regions of the gui in a render texture that keeps the previous frame and draws it on the target
+        ///
+        /// @param root     Root container that holds all widgets in the gui
+        /// @param regions  Parts of the view that changed since the previous call
+        ///
+        /// Only the regions are cleared and redrawn, the rest of the render texture still contains the gui from the previous call.
+        /// Afterwards the render texture is drawn on top of the target, even when there were no regions to redraw.
+        /// The first call and calls after the target was resized always redraw the entire gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawDamagedRegions(const std::shared_ptr<RootContainer>& root, const std::vector<FloatRect>& regions);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws a widget, if the widget is visible
         ///
@@ -142,6 +156,18 @@ namespace tgui
         void drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a display list in an offscreen render texture and returns its pixels
+        ///
+        /// @param displayList  Draw calls to execute, e.g. recorded with BackendRenderTargetRecorder
+        /// @param region       Part of the coordinate system of the draw calls that has to end up in the image
+        /// @param size         Size of the image in pixels
+        ///
+        /// @return Array of size.x * size.y * 4 bytes with RGBA pixels that aren't premultiplied with their alpha
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<std::uint8_t[]> drawOffscreen(const DisplayList& displayList, FloatRect region, Vector2u size) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -158,6 +184,8 @@ namespace tgui
         sf::View m_view;
         FloatRect m_viewRect;
         std::vector<std::pair<FloatRect, sf::View>> m_clippingLayers;
+        std::shared_ptr<sf::RenderTexture> m_offscreenTarget; // Used by drawOffscreen, only grows so that it can be reused for smaller images
+        std::shared_ptr<sf::RenderTexture> m_retainedTarget; // Keeps the gui from the previous frame for drawDamagedRegions
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
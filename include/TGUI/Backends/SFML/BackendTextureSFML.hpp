@@ -50,6 +50,16 @@ namespace tgui
         bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture
+        ///
+        /// @param position Position of the top-left pixel of the part to change
+        /// @param size     Width and height of the part to change
+        /// @param pixels   Array of size.x*size.y*4 bytes with the new RGBA pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool update(Vector2u position, Vector2u size, const std::uint8_t* pixels) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size of the entire image
         /// @return Texture size
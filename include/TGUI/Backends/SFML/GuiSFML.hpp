@@ -102,6 +102,11 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draws all the widgets that were added to the gui
+        ///
+        /// When damage tracking is enabled, the gui is kept in a render texture that still contains the previous frame. Only the
+        /// regions that changed since the previous call are cleared and redrawn. Afterwards the render texture is drawn on the
+        /// target, on top of what was already drawn on it.
+        /// @see setDamageTrackingEnabled
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void draw() override;
 
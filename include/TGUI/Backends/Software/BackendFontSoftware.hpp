@@ -0,0 +1,303 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_FONT_SOFTWARE_HPP
+#define TGUI_BACKEND_FONT_SOFTWARE_HPP
+
+#include <TGUI/BackendFont.hpp>
+#include <TGUI/FontFileCache.hpp>
+
+#include <unordered_map>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+struct FT_LibraryRec_;
+struct FT_FaceRec_;
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Font implementation that rasterizes glyphs with FreeType into an atlas in memory
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendFontSoftware : public BackendFontBase
+    {
+    public:
+
+        /// Glyph that was rasterized into the glyph atlas of the font
+        struct AtlasGlyph
+        {
+            UIntRect textureRect; //!< Part of the atlas that contains the glyph (width and height are 0 for whitespace)
+            Vector2f offset;      //!< Position of the top-left corner of the glyph, relative to the pen position at the top of the line
+            float    advance = 0; //!< Offset to move horizontally to the next character
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendFontSoftware();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~BackendFontSoftware();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // The object cannot be copied
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendFontSoftware(const BackendFontSoftware&) = delete;
+        BackendFontSoftware& operator=(const BackendFontSoftware&) = delete;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from a file
+        ///
+        /// @param filename  Filename of the font to load
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFromFile(const String& filename) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads a font from memory
+        ///
+        /// @param data         Pointer to the file data in memory
+        /// @param sizeInBytes  Size of the data to load, in bytes
+        ///
+        /// @return True if the font was loaded successfully, false otherwise
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFromMemory(const void* data, std::size_t sizeInBytes) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieve a glyph of the font
+        ///
+        /// If the font is a bitmap font, not all character sizes might be available. If the glyph is not available at the
+        /// requested size, an empty glyph is returned.
+        ///
+        /// @param codePoint        Unicode code point of the character to get
+        /// @param characterSize    Reference character size
+        /// @param bold             Retrieve the bold version or the regular one?
+        /// @param outlineThickness Thickness of outline (when != 0 the glyph will not be filled)
+        ///
+        /// @return The glyph corresponding to codePoint and characterSize
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FontGlyph getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness = 0) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the kerning offset of two glyphs
+        ///
+        /// The kerning is an extra offset (negative) to apply between two glyphs when rendering them, to make the pair look
+        /// more "natural". For example, the pair "AV" have a special kerning to make them closer than other characters.
+        /// Most of the glyphs pairs have a kerning offset of zero, though.
+        ///
+        /// @param first         Unicode code point of the first character
+        /// @param second        Unicode code point of the second character
+        /// @param characterSize Size of the characters
+        /// @param bold          Are the glyphs bold or regular?
+        ///
+        /// @return Kerning value for first and second, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold) override;
+        using BackendFontBase::getKerning; // Import version without bold parameter
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the line spacing
+        ///
+        /// Line spacing is the vertical offset to apply between two consecutive lines of text.
+        ///
+        /// @param characterSize Size of the characters
+        ///
+        /// @return Line spacing, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getLineSpacing(unsigned int characterSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the distance between the top of a line and the baseline
+        ///
+        /// @param characterSize Size of the characters
+        ///
+        /// @return Ascent of the font, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAscent(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the position of the underline, relative to the baseline
+        ///
+        /// @param characterSize Size of the characters
+        ///
+        /// @return Underline position, in pixels (positive values are below the baseline)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getUnderlinePosition(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the thickness of the underline
+        ///
+        /// @param characterSize Size of the characters
+        ///
+        /// @return Underline thickness, in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getUnderlineThickness(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Retrieves a glyph from the glyph atlas, rasterizing it into the atlas if it wasn't used before
+        ///
+        /// @param codePoint      Unicode code point of the character to get
+        /// @param characterSize  Size of the character
+        /// @param bold           Should the bold version of the glyph be returned?
+        /// @param italic         Should the glyph be slanted?
+        /// @param outline        Thickness of the outline, or 0 to get the filled glyph
+        ///
+        /// @return Glyph in the atlas, or nullptr if the glyph couldn't be rasterized
+        ///
+        /// Each combination of code point, character size, style and outline is only rasterized once. All glyphs are stored
+        /// in a single 8-bit coverage image that grows when it becomes full. The 2x2 pixels in the top-left corner of the
+        /// atlas are always fully covered, so that lines (e.g. for underlined text) can be drawn with the same image.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const AtlasGlyph* getAtlasGlyph(char32_t codePoint, unsigned int characterSize, bool bold, bool italic, unsigned int outline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the coverage values of the glyph atlas
+        ///
+        /// @return Pointer to getAtlasSize().x * getAtlasSize().y bytes, or nullptr when no glyph was added to the atlas yet
+        ///
+        /// @warning The pointer is invalidated when new glyphs are added to the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getAtlasPixels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the glyph atlas
+        ///
+        /// @return Size of the atlas in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getAtlasSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the glyph atlas to a file, so that it can be loaded again with loadGlyphCache on the next run
+        ///
+        /// @param filename  Filename of the cache file to create
+        ///
+        /// @return True if the file was written, false if no font was loaded or the file couldn't be opened for writing
+        ///
+        /// The cache is written automatically when the font is destroyed if GlyphAtlasCache::setDirectory was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveGlyphCache(const String& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the glyph atlas with the one stored in a file that was created with saveGlyphCache
+        ///
+        /// @param filename  Filename of the cache file to read
+        ///
+        /// @return True if the atlas was loaded, false if the file doesn't exist or was created for a different font file
+        ///         or TGUI version, in which case the atlas remains unchanged
+        ///
+        /// Glyphs that are found in the cache no longer have to be rasterized by FreeType. The font has to be loaded first.
+        /// The cache is loaded automatically when the font is loaded if GlyphAtlasCache::setDirectory was called.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadGlyphCache(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Releases the FreeType face and the glyphs that were rasterized with it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void cleanup();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the FreeType face from file contents that may be shared with other fonts
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool loadFileContents(std::shared_ptr<const FontFileCache::FileContents> fileContents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the pixel size of the FreeType face, returns false if the size couldn't be selected
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool setCurrentSize(unsigned int characterSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rasterizes a glyph and copies it into the atlas
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        AtlasGlyph rasterizeAtlasGlyph(char32_t codePoint, bool bold, bool italic, unsigned int outline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Finds a free spot in the atlas for a glyph of the given size, the atlas is enlarged when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u findAtlasSpace(unsigned int width, unsigned int height);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Changes the size of the atlas while keeping the glyphs that were already added to it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resizeAtlas(Vector2u newSize);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        FT_LibraryRec_* m_library = nullptr;
+        FT_FaceRec_* m_face = nullptr;
+        std::shared_ptr<const FontFileCache::FileContents> m_fileContents; // FreeType reads from this memory while the face exists
+        unsigned int m_currentSize = 0;
+
+        // Row in the atlas in which glyphs of a similar height are placed next to each other
+        struct AtlasRow
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int width;
+        };
+
+        Vector2u m_atlasSize;
+        std::vector<std::uint8_t> m_atlasPixels;
+        std::vector<AtlasRow> m_atlasRows;
+        std::unordered_map<std::uint64_t, AtlasGlyph> m_atlasGlyphs;
+
+        String m_glyphCacheFilename; // Cache file that is automatically loaded and saved, empty when the cache is disabled
+        bool m_glyphCacheOutdated = false; // Were glyphs added to the atlas since the cache file was loaded?
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_FONT_SOFTWARE_HPP
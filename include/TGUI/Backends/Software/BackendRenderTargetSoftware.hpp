@@ -0,0 +1,264 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
+#define TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
+
+#include <TGUI/BackendRenderTarget.hpp>
+
+#include <vector>
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Render target that rasterizes the gui on the CPU into an RGBA framebuffer
+    ///
+    /// No window or graphics driver is needed, which makes it possible to render the gui on a headless machine
+    /// (e.g. to compare screenshots in automated tests).
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendRenderTargetSoftware : public BackendRenderTargetBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor
+        ///
+        /// @param size  Size of the framebuffer in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendRenderTargetSoftware(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the framebuffer
+        ///
+        /// @param size  New size of the framebuffer in pixels
+        ///
+        /// The contents of the framebuffer are cleared to transparent black. setView has to be called again afterwards.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the framebuffer
+        ///
+        /// @return Size of the framebuffer in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getSize() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills the entire framebuffer with a single color
+        ///
+        /// @param color  Color to fill the framebuffer with
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear(Color color = Color::Black);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Fills part of the framebuffer with a single color
+        ///
+        /// @param color   Color to fill the region with
+        /// @param region  Part of the view to fill, which is rounded to the nearest pixels and limited to the viewport
+        ///
+        /// This can be used to restore the background inside the regions from GuiBase::getDamagedRegions before drawing the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear(Color color, FloatRect region);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels of the framebuffer
+        ///
+        /// @return Pointer to getSize().x * getSize().y * 4 bytes with RGBA pixels, stored row by row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getPixels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the contents of the framebuffer to a PNG file
+        ///
+        /// @param filename  Filename of the image to create
+        ///
+        /// @return True if the file was written, false if it couldn't be opened for writing
+        ///
+        /// The image data is stored without compression, the file is intended for inspection and comparing, not for distribution.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool saveToFile(const String& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Select the part of the framebuffer to which the gui will be rendered
+        ///
+        /// @param view     Defines which part of the gui will be drawn
+        /// @param viewport Defines which part of the framebuffer the gui will be drawn on
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setView(FloatRect view, FloatRect viewport) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws the gui and all of its widgets
+        ///
+        /// @param root  Root container that holds all widgets in the gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGui(const std::shared_ptr<RootContainer>& root) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Redraws only the part of the gui that lies inside the given region
+        ///
+        /// @param root    Root container that holds all widgets in the gui
+        /// @param region  Part of the view that has to be redrawn, which is rounded to the nearest pixels
+        ///
+        /// The widgets are drawn on top of the current contents of the region, the pixels outside the region are left untouched.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a widget, if the widget is visible
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param widget  The widget to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds another clipping region
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param rect    The clipping region
+        ///
+        /// If multiple clipping regions were added then contents is only shown in the intersection of all regions.
+        ///
+        /// @warning Every call must have a matching call to removeClippingLayer.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addClippingLayer(const RenderStates& states, FloatRect rect) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes the last added clipping region
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeClippingLayer() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a texture
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param sprite  Image to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawSprite(const RenderStates& states, const Sprite& sprite) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws some text
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param text    Text to draw
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawText(const RenderStates& states, const Text& text) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws one or more triangles
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices
+        /// @param indexCount   Amount of elements in the indices array
+        ///
+        /// If indices is a nullptr then vertexCount must be a multiple of 3 and each set of 3 vertices will be seen as a triangle.
+        /// Otherwise indexCount must be a multiple of 3 and each set of 3 indices will be seen as a triangle.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws a display list in an offscreen image and returns its pixels
+        ///
+        /// @param displayList  Draw calls to execute, e.g. recorded with BackendRenderTargetRecorder
+        /// @param region       Part of the coordinate system of the draw calls that has to end up in the image
+        /// @param size         Size of the image in pixels
+        ///
+        /// @return Array of size.x * size.y * 4 bytes with RGBA pixels that aren't premultiplied with their alpha
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::unique_ptr<std::uint8_t[]> drawOffscreen(const DisplayList& displayList, FloatRect region, Vector2u size) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Image from which the colors of the triangles are sampled, texture coordinates are in pixels
+        struct Sampler
+        {
+            const std::uint8_t* pixels = nullptr; // A nullptr means that only the vertex colors are used
+            Vector2u size;
+            unsigned int channels = 4; // 4 for RGBA images, 1 for coverage masks (e.g. the glyph atlas)
+            bool smooth = false;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Transforms the vertices to framebuffer coordinates and rasterizes the triangles
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawVertices(const Transform& transform, const Sampler& sampler, const Vertex* vertices, std::size_t vertexCount,
+                          const int* indices, std::size_t indexCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Rasterizes a single triangle of which the positions are already in framebuffer coordinates
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawTriangle(const Vertex& v0, const Vertex& v1, const Vertex& v2, const Sampler& sampler);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the pixels that a part of the view covers, rounded to the nearest pixels and limited to the viewport
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        IntRect getRegionPixels(FloatRect region) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        Vector2u m_size;
+        std::vector<std::uint8_t> m_pixels;
+        std::vector<Vertex> m_transformedVertices; // Scratch buffer for vertices in framebuffer coordinates
+        std::vector<std::uint8_t> m_spanColors; // Scratch buffer for colors of a span before they are blended
+
+        FloatRect m_viewRect;
+        IntRect m_viewport;
+        Transform m_viewTransform; // Maps view coordinates to framebuffer pixels
+        std::vector<std::pair<FloatRect, IntRect>> m_clippingLayers;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_RENDER_TARGET_SOFTWARE_HPP
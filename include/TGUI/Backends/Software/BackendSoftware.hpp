@@ -0,0 +1,155 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_SOFTWARE_HPP
+#define TGUI_BACKEND_SOFTWARE_HPP
+
+#include <TGUI/Backend.hpp>
+
+#include <set>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class GuiSoftware;
+    class BackendRenderTargetSoftware;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Backend that renders on the CPU and doesn't need a window or graphics driver
+    ///
+    /// There is no operating system interaction: events have to be passed to the gui manually,
+    /// mouse cursors and virtual keyboards are ignored and modifier keys are never pressed.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendSoftware : public BackendBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the backend that a new gui object has been created.
+        /// @param gui  Newly created gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void attachGui(GuiBase* gui) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the backend that a gui object is being destroyed.
+        /// @param gui  Gui object that is about to be deconstructed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void detatchGui(GuiBase* gui) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates and returns the default font for all widgets
+        /// @return Default font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Font createDefaultFont() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new font object
+        /// @return Font that is specific to the backend
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendFontBase> createFont() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new text object
+        /// @return Text that is specific to the backend
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTextBase> createText() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new texture object
+        /// @return Texture that is specific to the backend
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTextureBase> createTexture() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Does nothing, there is no mouse cursor without a window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseCursorStyle(Cursor::Type type, const std::uint8_t* pixels, Vector2u size, Vector2u hotspot) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Does nothing, there is no mouse cursor without a window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void resetMouseCursorStyle(Cursor::Type type) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Does nothing, there is no mouse cursor without a window
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setMouseCursor(GuiBase* gui, Cursor::Type type) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Does nothing, there is no virtual keyboard in this backend
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void openVirtualKeyboard(const FloatRect& inputRect) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Does nothing, there is no virtual keyboard in this backend
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void closeVirtualKeyboard() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks the state for one of the modifier keys
+        ///
+        /// @param modifierKey  The modifier key of which the state is being queried
+        ///
+        /// @return Always false, as the backend has no access to a keyboard
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isKeyboardModifierPressed(Event::KeyModifier modifierKey) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Creates a new render target for a gui
+        ///
+        /// @param gui   The gui for which the render target should be created
+        /// @param size  Size of the framebuffer in pixels
+        ///
+        /// @return Render target that contains the framebuffer in which the gui will be drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendRenderTargetSoftware> createGuiRenderTarget(GuiSoftware* gui, Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        std::set<GuiBase*> m_guis;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_SOFTWARE_HPP
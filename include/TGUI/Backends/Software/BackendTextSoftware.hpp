@@ -0,0 +1,188 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_TEXT_SOFTWARE_HPP
+#define TGUI_BACKEND_TEXT_SOFTWARE_HPP
+
+#include <TGUI/BackendText.hpp>
+#include <TGUI/Vertex.hpp>
+
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class BackendFontSoftware;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Text implementation that creates quads from the glyph atlas of a BackendFontSoftware
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendTextSoftware : public BackendTextBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        BackendTextSoftware();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the text
+        /// @return Size of the bounding box around the text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getSize() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text
+        /// @param string  Text that should be displayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setString(const String& string) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the size of the characters
+        /// @param characterSize  Maximum size available for characters above the baseline
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setCharacterSize(unsigned int characterSize) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color of the text
+        /// @param color  Text color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFillColor(const Color& color) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the color of the text outline
+        /// @param color  Outline color
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOutlineColor(const Color& color) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the thickness of the text outline
+        /// @param thickness  Outline thickness
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setOutlineThickness(float thickness) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the text style
+        /// @param style  New text style
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setStyle(TextStyles style) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the font used by the text
+        /// @param font  New text font
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setFont(const Font& font) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the top-left position of the character at the provided index
+        /// @param index  Index of the character for which the position should be returned
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f findCharacterPos(std::size_t index) const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the vertices of the glyph quads, with texture coordinates in pixels inside the glyph atlas
+        ///
+        /// @return Vertices to draw, outline glyphs are placed in front of the filled glyphs
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<Vertex>& getGlyphVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the glyph quads
+        ///
+        /// @return Indices into the vertices returned by getGlyphVertices
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::vector<int>& getGlyphIndices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the font of which the glyph atlas is used by the glyph vertices
+        ///
+        /// @return Font of the text, or nullptr if no font was set
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendFontSoftware> getFont() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Recreates the glyph quads, returns false when there is no font to create them with
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateGlyphVertices();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the quads for all glyphs in the text, either filled or as outline
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addGlyphQuads(float lineSpacing, const Vertex::Color& color, unsigned int outline);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a quad that covers a rectangle, used for underlined and strikethrough text
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addLineQuad(FloatRect rect, const Vertex::Color& color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns how far the pen moves after a character, a tab counts as 4 spaces
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        float getAdvance(char32_t character, bool bold, bool italic) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::shared_ptr<BackendFontSoftware> m_font;
+        std::vector<String> m_lines;
+        unsigned int m_characterSize = 32; // Same default as in the Text class, which doesn't pass its size until it is changed
+        Vertex::Color m_textColor{0, 0, 0, 255};
+        Vertex::Color m_outlineColor{0, 0, 0, 255};
+        unsigned int m_outlineThickness = 0;
+        unsigned int m_style = TextStyle::Regular;
+
+        std::vector<Vertex> m_glyphVertices;
+        std::vector<int> m_glyphIndices;
+        Vector2f m_size;
+        bool m_glyphVerticesValid = false;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_TEXT_SOFTWARE_HPP
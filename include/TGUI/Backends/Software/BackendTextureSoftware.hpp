@@ -0,0 +1,102 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
+#define TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
+
+#include <TGUI/BackendTexture.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Texture implementation that keeps its pixels in memory, to be used by the software renderer
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API BackendTextureSoftware : public BackendTextureBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Loads the texture from an array of 32-bits RGBA pixels
+        ///
+        /// @param size   Width and height of the image to create
+        /// @param pixels Moved pointer to array of size.x*size.y*4 bytes with RGBA pixels, or nullptr to create an empty texture
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the pixels in a part of the texture
+        ///
+        /// @param position Position of the top-left pixel of the part to change
+        /// @param size     Width and height of the part to change
+        /// @param pixels   Array of size.x*size.y*4 bytes with the new RGBA pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool update(Vector2u position, Vector2u size, const std::uint8_t* pixels) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the entire image
+        /// @return Texture size
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2u getSize() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether the smooth filter is enabled or not
+        ///
+        /// @param smooth  True if smoothing should be enabled, false if it should be disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSmooth(bool smooth) override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the smooth filter is enabled or not
+        ///
+        /// @return True if smoothing is enabled, false if it is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSmooth() const override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the pixels of the texture
+        /// @return Pointer to getSize().x * getSize().y * 4 bytes with RGBA pixels, or nullptr if no image was loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getPixels() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        bool m_isSmooth = true;
+        std::unique_ptr<std::uint8_t[]> m_pixels;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_TEXTURE_SOFTWARE_HPP
@@ -0,0 +1,126 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_BACKEND_GUI_SOFTWARE_HPP
+#define TGUI_BACKEND_GUI_SOFTWARE_HPP
+
+#include <TGUI/GuiBase.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    class BackendRenderTargetSoftware;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Gui class for the software backend, which draws the gui into a framebuffer in memory
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GuiSoftware : public GuiBase
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor
+        ///
+        /// @warning If you use this constructor then you will still have to call setSize before using the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiSoftware();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructs the gui and creates the framebuffer in which the gui will be drawn
+        ///
+        /// @param size  Size of the framebuffer in pixels
+        ///
+        /// If you use this constructor then you will no longer have to call setSize yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        GuiSoftware(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the size of the framebuffer in which the gui is drawn
+        ///
+        /// @param size  New size of the framebuffer in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSize(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the render target that contains the framebuffer
+        ///
+        /// @return Render target of the gui, or nullptr when no size was set yet
+        ///
+        /// The render target gives access to the rendered pixels, e.g. to save them to a file.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendRenderTargetSoftware> getRenderTarget() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Draws all the widgets that were added to the gui
+        ///
+        /// The widgets are drawn on top of the current contents of the framebuffer. When damage tracking is enabled, only the
+        /// regions that changed since the previous call are redrawn. The regions aren't cleared, so the background has to be
+        /// restored first, e.g. by calling getRenderTarget()->clear(color, region) for each region in getDamagedRegions().
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void draw() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Clears the framebuffer and draws the gui once
+        ///
+        /// There is no window that could provide events, so unlike in other backends this function returns immediately.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void mainLoop() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Function that is called when constructing the Gui
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void init() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the view and changes the size of the root container when needed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateContainerSize() override;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::shared_ptr<BackendRenderTargetSoftware> m_renderTarget = nullptr;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_BACKEND_GUI_SOFTWARE_HPP
@@ -50,6 +50,14 @@ namespace tgui
         typedef std::shared_ptr<Container> Ptr; //!< Shared widget pointer
         typedef std::shared_ptr<const Container> ConstPtr; //!< Shared constant widget pointer
 
+        /// @brief Statistics about the render caches, which can be enabled with setRenderCacheEnabled
+        struct RenderCacheStatistics
+        {
+            std::size_t hits = 0;          //!< Amount of times that a container was drawn from its cached texture
+            std::size_t misses = 0;        //!< Amount of times that the cached texture had to be redrawn
+            std::size_t textureMemory = 0; //!< Bytes of pixel data in the textures of all render caches together
+        };
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
@@ -212,6 +220,15 @@ namespace tgui
         }
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Get the absolute position of the top-left point of the container
+        ///
+        /// @return Absolute position of the container, which includes the position of the widget that owns it if the container
+        ///         is used internally by a widget (e.g. the group inside a TabContainer)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Vector2f getAbsolutePosition() const override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the character size of all existing and future child widgets
         ///
@@ -406,6 +423,43 @@ namespace tgui
         void setFocused(bool focused) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether the child widgets are drawn into a texture that is reused until they change
+        ///
+        /// @param enabled  Should the child widgets be cached in a texture?
+        ///
+        /// This is intended for containers with contents that rarely changes, like toolbars or side menus. The child widgets are
+        /// only drawn into the texture again after something changed (e.g. a property, the layout, the renderer or a child that
+        /// was added or removed), as long as nothing changed they are drawn as a single image.
+        ///
+        /// The cache is only used when the container isn't rotated or scaled and when the render target supports drawing
+        /// offscreen, the widgets are drawn directly otherwise. Caching is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setRenderCacheEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the child widgets are drawn into a texture that is reused until they change
+        ///
+        /// @return Is the render cache enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isRenderCacheEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the render caches of all containers
+        ///
+        /// @return Amount of cache hits and misses since the last reset and the texture memory that is currently in use
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static RenderCacheStatistics getRenderCacheStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the amount of cache hits and misses that is returned by getRenderCacheStatistics to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetRenderCacheStatistics();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Inform the container about a mouse move event
         /// @param pos  Mouse position
@@ -550,6 +604,24 @@ namespace tgui
         void setParentGui(GuiBase* gui);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Returns the widget that uses this container internally (e.g. a TabContainer), or nullptr if there is no such widget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Widget* getSubwidgetOwner() const
+        {
+            return m_subwidgetOwner;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// Marks the texture of the render cache as outdated, so that the child widgets are drawn into it again on the next draw.
+        /// This is called by Widget::invalidate for every container in which the widget is located.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidateRenderCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -627,6 +699,19 @@ namespace tgui
         void loadWidgetsImpl(const std::unique_ptr<DataIO::Node>& rootNode, bool replaceExisting);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets, which is what the draw function does when the render cache isn't used
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void drawWidgets(BackendRenderTargetBase& target, const RenderStates& states) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Draws the child widgets via the render cache, updating the cached texture when needed.
+        // Returns false when the cache can't be used, in which case nothing was drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool drawWidgetsFromRenderCache(BackendRenderTargetBase& target, const RenderStates& states) const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
@@ -642,6 +727,15 @@ namespace tgui
         // Does focusing the next widget always keep a widget from this container focused (e.g. in a ChildWindow)?
         bool m_isolatedFocus = false;
 
+        // Widget that draws this container as part of itself when the container doesn't have a parent (set by SubwidgetContainer)
+        Widget* m_subwidgetOwner = nullptr;
+
+        // Contains the texture with the child widgets when the render cache is enabled, nullptr otherwise
+        struct RenderCache;
+        std::unique_ptr<RenderCache> m_renderCache;
+
+        static RenderCacheStatistics m_renderCacheStatistics;
+
 
         friend class SubwidgetContainer; // Needs access to save and load functions
 
@@ -0,0 +1,290 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_DISPLAY_LIST_HPP
+#define TGUI_DISPLAY_LIST_HPP
+
+#include <TGUI/BackendRenderTarget.hpp>
+
+#include <vector>
+#include <cstdint>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief List of draw commands that were recorded from a render target and that can be replayed later
+    ///
+    /// The commands are usually recorded with a BackendRenderTargetRecorder. Comparing the display lists of two frames
+    /// makes it possible to detect that nothing changed and skip drawing the frame.
+    ///
+    /// Display lists can be saved to a binary file. Textures and fonts are stored by their id, so only images and fonts
+    /// that were loaded from a file can be restored when the display list is loaded again.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API DisplayList
+    {
+    public:
+
+        /// Type of each recorded command
+        enum class CommandType : std::uint8_t
+        {
+            AddClippingLayer,    //!< Call to addClippingLayer
+            RemoveClippingLayer, //!< Call to removeClippingLayer
+            DrawBorders,         //!< Call to drawBorders
+            DrawFilledRect,      //!< Call to drawFilledRect
+            DrawSprite,          //!< Call to drawSprite
+            DrawText,            //!< Call to drawText
+            DrawTriangles        //!< Call to drawTriangles
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all commands from the display list
+        ///
+        /// The memory is kept, so that recording the next frame doesn't require new allocations.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void clear();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of commands in the display list
+        ///
+        /// @return Number of recorded commands
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getCommandCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the type of one of the commands
+        ///
+        /// @param index  Index of the command, which has to be smaller than getCommandCount()
+        ///
+        /// @return Type of the command
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        CommandType getCommandType(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the area in which replaying the display list could draw
+        ///
+        /// @return Bounding rectangle of all commands, or an empty rectangle if the display list doesn't draw anything
+        ///
+        /// The bounds are calculated without taking clipping into account, so they may be larger than the drawn area.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getBounds() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to add a clipping layer
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param rect    The clipping region
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addClippingLayer(const RenderStates& states, FloatRect rect);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to remove the last added clipping layer
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void removeClippingLayer();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to draw borders
+        ///
+        /// @param states   Render states to use for drawing
+        /// @param borders  Size of the borders on each side
+        /// @param size     Size of the rectangle that is formed by the borders
+        /// @param color    Color of the borders
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to draw a filled rectangle
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param size    Size of the rectangle
+        /// @param color   Color of the rectangle
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addFilledRect(const RenderStates& states, Vector2f size, Color color);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to draw a texture
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param sprite  Image to draw, a copy of it is stored in the display list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addSprite(const RenderStates& states, const Sprite& sprite);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to draw some text
+        ///
+        /// @param states  Render states to use for drawing
+        /// @param text    Text to draw, a copy of it is stored in the display list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addText(const RenderStates& states, const Text& text);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds a command to draw one or more triangles
+        ///
+        /// @param states       Render states to use for drawing
+        /// @param vertices     Pointer to first element in array of vertices
+        /// @param vertexCount  Amount of elements in the vertex array
+        /// @param indices      Pointer to first element in array of indices, or nullptr if each 3 vertices form a triangle
+        /// @param indexCount   Amount of elements in the indices array
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices = nullptr, std::size_t indexCount = 0);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Executes all commands on a render target
+        ///
+        /// @param target  Render target to draw on
+        ///
+        /// The commands are passed to the target as-is, so this function has to be called at a moment where the target
+        /// accepts draw calls (e.g. from inside a widget or from the drawGui function of a render target).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void replay(BackendRenderTargetBase& target) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Saves the commands to a binary file
+        ///
+        /// @param filename  Filename of the file to create
+        ///
+        /// @throw Exception when file could not be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void saveToFile(const String& filename) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Replaces the commands with the ones stored in a binary file
+        ///
+        /// @param filename  Filename of the file that was created with saveToFile
+        ///
+        /// @throw Exception when file could not be read or doesn't contain a valid display list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void loadFromFile(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether two display lists contain the same commands
+        ///
+        /// @param other  Display list to compare with
+        ///
+        /// @return True when replaying both display lists would result in the same draw calls
+        ///
+        /// Sprites and texts are considered equal when all their properties are equal and they share the same texture or font.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool operator==(const DisplayList& other) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Checks whether two display lists contain different commands
+        ///
+        /// @param other  Display list to compare with
+        ///
+        /// @return True when replaying both display lists could result in different draw calls
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool operator!=(const DisplayList& other) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        // Each command refers to its transform and to the data in the vector that belongs to its type.
+        // Consecutive commands that use the same transform share it, which is common as widgets draw multiple parts.
+        struct Command
+        {
+            CommandType type;
+            std::uint32_t transformIndex;
+            std::uint32_t dataIndex;
+        };
+
+        struct BordersData
+        {
+            Borders borders;
+            Vector2f size;
+            Color color;
+        };
+
+        struct FilledRectData
+        {
+            Vector2f size;
+            Color color;
+        };
+
+        struct TrianglesData
+        {
+            std::uint32_t firstVertex;
+            std::uint32_t vertexCount;
+            std::uint32_t firstIndex;
+            std::uint32_t indexCount; // 0 when the vertices weren't indexed
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds a command, the data index is the current size of the vector that the data will be added to
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addCommand(CommandType type, const Transform& transform, std::size_t dataIndex);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Checks whether a command in this list would draw the same as a command in another list
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isCommandEqual(std::size_t index, const DisplayList& other, std::size_t otherIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the area in which a command could draw, ignoring the clipping layers that are active at that point
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        FloatRect getCommandBounds(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    protected:
+
+        std::vector<Command> m_commands;
+        std::vector<Transform> m_transforms;
+        std::vector<FloatRect> m_clippingRects;
+        std::vector<BordersData> m_borders;
+        std::vector<FilledRectData> m_filledRects;
+        std::vector<Sprite> m_sprites;
+        std::vector<Text> m_texts;
+        std::vector<TrianglesData> m_triangles;
+        std::vector<Vertex> m_vertices;
+        std::vector<int> m_indices;
+    };
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_DISPLAY_LIST_HPP
@@ -0,0 +1,134 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#ifndef TGUI_FONT_FILE_CACHE_HPP
+#define TGUI_FONT_FILE_CACHE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/MemoryMappedFile.hpp>
+#include <TGUI/String.hpp>
+#include <cstdint>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Keeps the contents of font files in memory so that all fonts that load the same file can share them
+    ///
+    /// Font files are memory-mapped when possible, so that only the parts of the file that are actually read take up memory.
+    /// Fonts that are loaded from the same filename share the same mapping. Fonts that are loaded from memory share a single
+    /// copy of the data when the bytes are identical. The contents are released once the last font using them is destroyed.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API FontFileCache
+    {
+    public:
+
+        /// @brief Information about the font files that are currently kept in memory
+        struct Statistics
+        {
+            std::size_t fileCount = 0;   //!< Amount of distinct font files that are being used
+            std::size_t mappedBytes = 0; //!< Size of the files that are memory-mapped, only the parts that are read are resident
+            std::size_t copiedBytes = 0; //!< Bytes of font data that had to be copied into memory
+            std::size_t sharedLoads = 0; //!< Amount of times that a font reused the contents of a file that was already loaded
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Bytes of a font file, which remain valid for as long as a font holds on to this object
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        class TGUI_API FileContents
+        {
+        public:
+
+            /// @brief Returns a pointer to the bytes of the font file
+            const std::uint8_t* getData() const
+            {
+                return m_data;
+            }
+
+            /// @brief Returns the size of the font file in bytes
+            std::size_t getSize() const
+            {
+                return m_size;
+            }
+
+            /// @brief Returns whether the file is memory-mapped instead of copied into memory
+            bool isMapped() const
+            {
+                return m_file.isMapped();
+            }
+
+            /// @brief Returns a hash of the bytes of the font file, which is calculated the first time it is requested
+            std::uint64_t getHash() const;
+
+        private:
+            MemoryMappedFile m_file;
+            std::unique_ptr<std::uint8_t[]> m_copy; // Only used when the font was loaded from memory
+            const std::uint8_t* m_data = nullptr;
+            std::size_t m_size = 0;
+            mutable std::uint64_t m_hash = 0;
+            mutable bool m_hashCalculated = false;
+
+            friend class FontFileCache;
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the contents of a font file, reusing them if another font already loaded the same file
+        ///
+        /// @param filename  Filename of the font
+        ///
+        /// @return Contents of the file, or nullptr if the file couldn't be read
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<const FileContents> loadFromFile(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a copy of font data, reusing an earlier copy if another font was loaded from identical data
+        ///
+        /// @param data         Pointer to the file data in memory
+        /// @param sizeInBytes  Size of the data, in bytes
+        ///
+        /// @return Contents of the font, or nullptr if the data is empty
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::shared_ptr<const FileContents> loadFromMemory(const void* data, std::size_t sizeInBytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how many font files are loaded and how much memory they use
+        ///
+        /// @return Statistics about the font files that are still in use
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static Statistics getStatistics();
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_FONT_FILE_CACHE_HPP
@@ -0,0 +1,147 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_GLYPH_ATLAS_CACHE_HPP
+#define TGUI_GLYPH_ATLAS_CACHE_HPP
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#include <TGUI/String.hpp>
+#include <TGUI/Rect.hpp>
+#include <TGUI/Vector2.hpp>
+#include <cstdint>
+#include <vector>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Stores the glyph atlas of a font on disk, so that the glyphs don't have to be rasterized again on the next run
+    ///
+    /// The cache is disabled by default. When a directory is set, fonts of backends that rasterize their own glyphs will look
+    /// for a cache file when the font is loaded and will write the cache file when the font is destroyed if glyphs were added
+    /// to the atlas. A cache file is only used when it was written by the same TGUI version for a font with identical contents.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API GlyphAtlasCache
+    {
+    public:
+
+        /// @brief Row in the atlas in which glyphs of a similar height are placed next to each other
+        struct Row
+        {
+            unsigned int top = 0;    //!< Vertical position of the row in the atlas
+            unsigned int height = 0; //!< Height of the row, including padding
+            unsigned int width = 0;  //!< Horizontal space in the row that is already taken by glyphs
+        };
+
+        /// @brief Glyph that was rasterized into the atlas
+        struct Glyph
+        {
+            std::uint64_t key = 0; //!< Backend-specific key that identifies the code point, size and style of the glyph
+            UIntRect textureRect;  //!< Part of the atlas that contains the glyph
+            Vector2f offset;       //!< Position of the top-left corner of the glyph, relative to the pen position
+            float    advance = 0;  //!< Offset to move horizontally to the next character
+        };
+
+        /// @brief Everything that is stored in a cache file
+        struct Contents
+        {
+            Vector2u atlasSize;               //!< Size of the atlas in pixels
+            std::vector<std::uint8_t> pixels; //!< Coverage values of the atlas, atlasSize.x * atlasSize.y bytes
+            std::vector<Row> rows;            //!< Rows in the atlas, needed to add more glyphs to the atlas afterwards
+            std::vector<Glyph> glyphs;        //!< Glyphs that are located in the atlas
+        };
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets the directory in which fonts automatically store their glyph atlas
+        ///
+        /// @param directory  Existing directory in which the cache files are placed, or an empty string to disable the cache
+        ///
+        /// The directory has to be set before the fonts are loaded. By default the cache is disabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setDirectory(const String& directory);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the directory in which fonts automatically store their glyph atlas
+        ///
+        /// @return Directory that contains the cache files, or an empty string when the cache is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static const String& getDirectory();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the filename of the cache file that belongs to a font
+        ///
+        /// @param backendName  Name of the font backend, since each backend stores its glyphs differently
+        /// @param fontHash     Hash of the contents of the font file
+        ///
+        /// @return Path to the cache file inside the cache directory, or an empty string when the cache is disabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static String getFilename(const String& backendName, std::uint64_t fontHash);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Writes the glyph atlas of a font to a file
+        ///
+        /// @param filename     Filename of the cache file to create
+        /// @param backendName  Name of the font backend that created the glyphs
+        /// @param fontHash     Hash of the contents of the font file
+        /// @param contents     Atlas and glyphs to store
+        ///
+        /// @return True when the file was written, false if the file couldn't be opened for writing
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool saveToFile(const String& filename, const String& backendName, std::uint64_t fontHash, const Contents& contents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Reads the glyph atlas of a font from a file that was created with saveToFile
+        ///
+        /// @param filename     Filename of the cache file to read
+        /// @param backendName  Name of the font backend that is going to use the glyphs
+        /// @param fontHash     Hash of the contents of the font file
+        /// @param contents     Atlas and glyphs that were read, only changed when the function returns true
+        ///
+        /// @return True when the file was loaded. False is returned when the file doesn't exist, is corrupt, or was created
+        ///         by a different TGUI version, font backend or font file.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool loadFromFile(const String& filename, const String& backendName, std::uint64_t fontHash, Contents& contents);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        static String m_directory;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_GLYPH_ATLAS_CACHE_HPP
@@ -540,6 +540,61 @@ namespace tgui
         bool updateTime(Duration elapsedTime);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets whether only the parts of the gui that changed since the previous frame should be redrawn
+        ///
+        /// @param enabled  True to only redraw the damaged regions, false to redraw the entire gui each frame (default)
+        ///
+        /// When enabled, widgets mark the area they cover as damaged when they change (e.g. only the edit box that has a
+        /// blinking caret) and draw() only redraws the widgets inside the damaged regions.
+        /// The SDL and SFML backends keep the gui in a framebuffer or render texture that still contains the previous frame and
+        /// copy it to the window each time draw() is called. The Software backend redraws the regions directly on top of what
+        /// its render target already contains, so the background has to be restored inside getDamagedRegions() first.
+        /// The mainLoop() function skips frames in which nothing changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setDamageTrackingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether only the parts of the gui that changed since the previous frame are redrawn
+        ///
+        /// @return Is damage tracking enabled?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isDamageTrackingEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Forces the entire gui to be redrawn the next time it is drawn, when damage tracking is enabled
+        ///
+        /// Widgets mark themselves as damaged when they change, this function is only needed when something other than the gui
+        /// has overwritten the pixels that the gui was drawn on.
+        /// @see Widget::invalidate
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the parts of the view that will be redrawn by the next call to draw(), when damage tracking is enabled
+        ///
+        /// @return Damaged regions in the coordinate system of the view, which don't overlap and line up with whole pixels
+        ///
+        /// The list is empty when nothing changed since the previous frame and contains the entire view when everything has to
+        /// be redrawn (e.g. during the first frame or after the view was changed).
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<FloatRect> getDamagedRegions() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Marks a part of the view as changed, so that it gets redrawn when damage tracking is enabled
+        ///
+        /// @param region  Part of the view that changed
+        ///
+        /// This function is called by widgets when they are invalidated. You should not call this function yourself.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addDamagedRegion(FloatRect region);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// @brief Converts the pixel coordinate to a position within the view
@@ -575,6 +630,13 @@ namespace tgui
         virtual void updateContainerSize();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the regions that have to be redrawn in the frame that is about to be drawn and starts tracking damage for
+        // the next frame. This function should only be called when damage tracking is enabled.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<FloatRect> takeDamagedRegions();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     public:
 
@@ -601,6 +663,11 @@ namespace tgui
         bool m_drawUpdatesTime = true;
         bool m_tabKeyUsageEnabled = true;
 
+        bool m_damageTrackingEnabled = false;
+        bool m_fullRedrawRequired = true;
+        bool m_regionsRedrawnSinceFullRedraw = false; // Images drawn in those regions may have been hidden again
+        std::vector<FloatRect> m_damagedRegions; // Non-overlapping regions that changed since the last frame
+
         Cursor::Type m_requestedMouseCursor = Cursor::Type::Arrow;
         std::stack<Cursor::Type> m_overrideMouseCursors;
     };
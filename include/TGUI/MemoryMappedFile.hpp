@@ -0,0 +1,159 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#ifndef TGUI_MEMORY_MAPPED_FILE_HPP
+#define TGUI_MEMORY_MAPPED_FILE_HPP
+
+#include <TGUI/String.hpp>
+#include <cstdint>
+#include <memory>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    /// @brief Read-only view on the contents of a file
+    ///
+    /// The file is mapped into memory when the operating system supports it, so that its contents are only paged in when
+    /// they are actually accessed and no copy of the file has to be allocated. When the file can't be mapped (e.g. an asset
+    /// on android) then the file is read into memory instead, so the caller never has to care about which method was used.
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    class TGUI_API MemoryMappedFile
+    {
+    public:
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Default constructor that doesn't open any file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryMappedFile() = default;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Constructor that immediately opens a file
+        ///
+        /// @param filename  Path to the file to open
+        ///
+        /// Call isOpen() afterwards to find out whether the file could be opened.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        explicit MemoryMappedFile(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Destructor that unmaps the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        ~MemoryMappedFile();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryMappedFile(MemoryMappedFile&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Opens a file, closing the file that was previously opened by this object
+        ///
+        /// @param filename  Path to the file to open
+        ///
+        /// @return True when the file was opened, false when it couldn't be read or when it was empty
+        ///
+        /// On android, the file will be read using the asset manager if a relative filename is passed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool open(const String& filename);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Releases the contents of the file
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void close();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether a file is currently opened
+        ///
+        /// @return Is a file opened?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isOpen() const
+        {
+            return m_data != nullptr;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the opened file is mapped into memory or whether it had to be read instead
+        ///
+        /// @return True when the file is memory-mapped, false when it was read into memory or when no file is opened
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMapped() const
+        {
+            return m_mapped;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns a pointer to the contents of the file
+        ///
+        /// @return Bytes of the file, or nullptr when no file is opened
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        const std::uint8_t* getData() const
+        {
+            return m_data;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the size of the file
+        ///
+        /// @return Amount of bytes that can be accessed via getData()
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getSize() const
+        {
+            return m_size;
+        }
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+    private:
+
+        const std::uint8_t* m_data = nullptr;
+        std::size_t m_size = 0;
+        bool m_mapped = false;
+        std::unique_ptr<std::uint8_t[]> m_fileContents; // Only used when the file couldn't be mapped
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#endif // TGUI_MEMORY_MAPPED_FILE_HPP
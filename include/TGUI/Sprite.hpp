@@ -124,6 +124,8 @@ namespace tgui
         ///
         /// @return Has a valid texture been assigned to this sprite?
         ///
+        /// A texture that is still being loaded in the background isn't considered set until it has finished loading.
+        ///
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool isSet() const;
 
@@ -29,6 +29,8 @@
 #include <TGUI/String.hpp>
 #include <TGUI/Vector2.hpp>
 
+#include <memory>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -46,6 +48,16 @@ namespace tgui
     {
     public:
 
+        /// @brief Statistics about the cache of rasterized images that is shared by all sprites
+        struct RasterCacheStatistics
+        {
+            std::size_t hits = 0;          //!< Amount of times that an image was already rasterized at the requested size
+            std::size_t misses = 0;        //!< Amount of times that an image had to be rasterized
+            std::size_t textureCount = 0;  //!< Amount of textures that are currently in the cache
+            std::size_t textureMemory = 0; //!< Bytes of pixel data in the textures that are currently in the cache
+        };
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Default constructor
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -66,6 +78,18 @@ namespace tgui
         ~SvgImage();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move constructor
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SvgImage(SvgImage&& other) noexcept;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Move assignment operator
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        SvgImage& operator=(SvgImage&& other) noexcept;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the object stores an svg that was successfully loaded
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +114,63 @@ namespace tgui
         void rasterize(BackendTextureBase& texture, Vector2u size);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns a texture containing the image rasterized at a given size
+        ///
+        /// @param size  Size that the texture should have
+        ///
+        /// @return Texture that is shared with everyone that requested this image at the same size
+        ///
+        /// The texture is taken from the raster cache if the image was already rasterized at this size.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTextureBase> getRasterizedTexture(Vector2u size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much memory the raster cache may keep for textures that are no longer used
+        ///
+        /// @param bytes  Maximum amount of pixel data in unused textures, defaults to 8MB
+        ///
+        /// Textures that are still used by a sprite are always kept. When a texture is no longer used, it stays in the cache
+        /// so that it can be reused when the same image is shown again at the same size. The least recently used textures
+        /// are removed once the unused textures together take more memory than this limit. Setting it to 0 removes textures
+        /// as soon as possible.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setRasterCacheMemoryLimit(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory the raster cache may keep for textures that are no longer used
+        ///
+        /// @return Maximum amount of pixel data in unused textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getRasterCacheMemoryLimit();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns statistics about the raster cache
+        ///
+        /// @return Amount of cache hits and misses since the last reset and the textures that are currently in the cache
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static RasterCacheStatistics getRasterCacheStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the amount of cache hits and misses that is returned by getRasterCacheStatistics to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetRasterCacheStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Removes all textures from the raster cache
+        ///
+        /// Sprites that are currently showing an svg image keep their texture, but it will no longer be shared with new sprites.
+        /// This function is called automatically when the backend is destroyed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void clearRasterCache();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     private:
         NSVGimage* m_svg = nullptr;
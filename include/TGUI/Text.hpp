@@ -31,6 +31,7 @@
 #include <TGUI/Vector2.hpp>
 #include <TGUI/TextStyle.hpp>
 #include <TGUI/RenderStates.hpp>
+#include <vector>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -78,6 +79,41 @@ namespace tgui
         static float getLineWidth(const String &text, Font font, unsigned int characterSize, TextStyles textStyle = {});
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of multiple lines of text that share the same font, character size and style
+        ///
+        /// @param texts               Pointer to the first string to measure
+        /// @param count               Amount of strings to measure
+        /// @param font                Font of the texts
+        /// @param characterSize       Character size of the texts
+        /// @param textStyle           Style of the texts
+        /// @param allowMultithreading Can the texts be measured on multiple threads when there are a lot of characters?
+        ///
+        /// @return Width of each string, the same value that getLineWidth would return for it
+        ///
+        /// This is faster than calling getLineWidth for each string, because the advance and kerning of ASCII characters are
+        /// only requested from the font once. When multithreading is allowed and the input is very large, the strings that only
+        /// contain ASCII characters are divided over multiple threads.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<float> getLineWidths(const String* texts, std::size_t count, Font font, unsigned int characterSize,
+                                                TextStyles textStyle = {}, bool allowMultithreading = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width of multiple lines of text that share the same font, character size and style
+        ///
+        /// @param texts               Strings to measure
+        /// @param font                Font of the texts
+        /// @param characterSize       Character size of the texts
+        /// @param textStyle           Style of the texts
+        /// @param allowMultithreading Can the texts be measured on multiple threads when there are a lot of characters?
+        ///
+        /// @return Width of each string, the same value that getLineWidth would return for it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::vector<float> getLineWidths(const std::vector<String>& texts, Font font, unsigned int characterSize,
+                                                TextStyles textStyle = {}, bool allowMultithreading = false);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Finds the best character size for the text
         ///
@@ -233,6 +233,17 @@ namespace tgui
         std::shared_ptr<TextureData> getData() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Returns the backend texture for drawing
+        ///
+        /// @return Backend texture of the data, or nullptr if the texture has no data
+        ///
+        /// The image is loaded again if the texture manager evicted it to stay within its memory budget.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::shared_ptr<BackendTextureBase> getBackendTexture() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns the size that the loaded image, or the size of the part if only a part of the image is loaded
         ///
@@ -319,6 +330,18 @@ namespace tgui
         bool isTransparentPixel(Vector2u pos) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the image is still being loaded in the background
+        ///
+        /// @return True when the texture data is a placeholder that will be replaced once the image is decoded
+        ///
+        /// Images are only loaded in the background when this was enabled with TextureManager::setAsyncLoadingEnabled.
+        /// While loading, the texture has no size (unless a part rect was specified) and sprites using it don't draw anything.
+        ///
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isLoading() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Sets a callback function for when this texture is copied
         ///
@@ -451,6 +474,10 @@ namespace tgui
         UIntRect m_middleRect;
         String  m_id;
 
+        // When the data was still loading when it was set, m_partRect and m_middleRect contain the requested rects and the
+        // actual rects can only be calculated once the size of the image is known.
+        bool m_rectsPending = false;
+
         CallbackFunc m_copyCallback;
         CallbackFunc m_destructCallback;
 
@@ -34,22 +34,18 @@
 
 #include <TGUI/BackendTexture.hpp>
 
+#include <functional>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <list>
+#include <map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    // Used by the Texture class
-    struct TGUI_API TextureData
-    {
-        // Either svgImage or backendTexture MUST have a value
-        Optional<SvgImage> svgImage;
-        std::shared_ptr<BackendTextureBase> backendTexture;
-    };
+    struct TextureData;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -60,6 +56,36 @@ namespace tgui
         String  filename;
         bool smooth = true;
         unsigned int users = 0;
+        std::function<bool(BackendTextureBase&, const String&)> loader; // Used to reload the image after it was evicted
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Used by the Texture class
+    struct TGUI_API TextureData
+    {
+        // Either svgImage or backendTexture MUST have a value, unless loading the image in the background failed
+        Optional<SvgImage> svgImage;
+        std::shared_ptr<BackendTextureBase> backendTexture;
+
+        // Part of backendTexture that contains the image when it was packed into an atlas page, empty otherwise
+        UIntRect atlasRect;
+
+        // True while the image is being decoded in the background, backendTexture is only a placeholder until then
+        bool loading = false;
+
+        // True when the texture manager released the image to stay within its memory budget, backendTexture then only
+        // knows the size of the image until it is reloaded
+        bool evicted = false;
+
+        // Frame in which the texture was last drawn, used by the texture manager to evict the least recently used images
+        std::uint64_t lastUsedFrame = 0;
+
+        // Position of the data inside the texture manager, so that it doesn't have to search for the data when a texture is
+        // copied or removed. The iterators are only valid while managed is true.
+        bool managed = false;
+        std::map<String, std::list<TextureDataHolder>>::iterator imageMapIt;
+        std::list<TextureDataHolder>::iterator holderIt;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,7 +29,9 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include <TGUI/TextureData.hpp>
+#include <functional>
 #include <memory>
+#include <vector>
 #include <list>
 #include <map>
 
@@ -44,6 +46,15 @@ namespace tgui
     class TGUI_API TextureManager
     {
     public:
+
+        /// @brief Information about the memory used by the images of the texture manager
+        struct MemoryStatistics
+        {
+            std::size_t residentBytes = 0; //!< Bytes of pixel data in loaded images and atlas pages, excluding evicted images
+            std::size_t evictions = 0;     //!< Amount of times that an image was released to stay within the memory budget
+            std::size_t reloads = 0;       //!< Amount of times that an evicted image had to be loaded again
+        };
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Loads a texture
         ///
@@ -90,10 +101,240 @@ namespace tgui
         static std::size_t getCachedImagesCount();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether small images are packed together into shared atlas textures
+        ///
+        /// @param enabled  Should images that are loaded from now on be packed into atlas pages?
+        ///
+        /// When enabled, each image that covers at most a quarter of an atlas page is copied into a large shared texture
+        /// instead of getting a texture of its own. Widgets that use different images can then be drawn with the same texture,
+        /// which reduces the amount of texture switches while rendering. The Texture and Sprite classes hide where the image
+        /// is located inside the page, the part rect of a texture is still relative to the original image.
+        ///
+        /// Changing this setting only affects images that are loaded afterwards. Atlas mode is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether small images are packed together into shared atlas textures
+        ///
+        /// @return Are images packed into atlas pages when they are loaded?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAtlasEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the width and height of atlas pages that are created from now on
+        ///
+        /// @param size  Width and height of a new atlas page in pixels, defaults to 1024
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAtlasPageSize(unsigned int size);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the width and height of atlas pages that are created from now on
+        ///
+        /// @return Width and height of a new atlas page in pixels
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static unsigned int getAtlasPageSize();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of atlas pages that currently exist
+        ///
+        /// @return Number of atlas textures
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getAtlasPageCount();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns which fraction of the atlas pages is covered by images that are still in use
+        ///
+        /// @return Used area of all atlas pages divided by their total area, or 0 when there are no atlas pages
+        ///
+        /// Space that was used by an image that has since been removed is only reclaimed once its entire page becomes empty.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static float getAtlasFillRatio();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether images are decoded on background threads
+        ///
+        /// @param enabled  Should images that are loaded from now on be decoded in the background?
+        ///
+        /// When enabled, loading a texture from a file returns immediately with a placeholder. The file is read and decoded
+        /// on a pool of worker threads, and the image is uploaded to the GPU on the gui thread during the next frame.
+        /// Widgets are updated automatically once the image is ready. Until then, Texture::isLoading returns true and
+        /// the texture has no size (unless a part rect was specified), so widgets draw as if no texture was set.
+        ///
+        /// Because the image is only loaded later, Texture::load no longer throws when the file doesn't exist.
+        /// Use setAsyncLoadFinishedCallback to find out whether the image was loaded successfully.
+        ///
+        /// The backend texture loader (see Texture::setBackendTextureLoader) is called on a worker thread in this mode,
+        /// so a custom loader should only read the file and pass the pixels to the BackendTextureBase::load function.
+        ///
+        /// Changing this setting only affects images that are loaded afterwards. Async loading is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncLoadingEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether images are decoded on background threads
+        ///
+        /// @return Are images that are loaded from now on decoded in the background?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool isAsyncLoadingEnabled();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Sets a function that is called on the gui thread each time an image that was loaded in the background is ready
+        ///
+        /// @param func  Function that is passed the filename of the image and whether it could be loaded
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setAsyncLoadFinishedCallback(const std::function<void(const String& filename, bool success)>& func);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the amount of images that are still being loaded in the background
+        ///
+        /// @return Number of images that aren't ready yet
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getAsyncLoadsPending();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finishes the images that were decoded in the background since the last call
+        ///
+        /// @param wait  Should the function block until all images that are still being decoded are finished?
+        ///
+        /// @return True when at least one image was finished
+        ///
+        /// This function is called by the gui every frame, you only need to call it yourself if you want to wait for images.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool updateAsyncLoads(bool wait = false);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes how much memory the loaded images may use before unused images are evicted
+        ///
+        /// @param bytes  Maximum amount of pixel data in loaded images, or 0 to never evict images (default)
+        ///
+        /// When the images together take more memory than the budget, the images that weren't drawn in the last frame are
+        /// released in least recently used order until the budget is met again. The textures that use an evicted image
+        /// remain valid and keep their size. The image is loaded again from its file the next time it gets drawn.
+        ///
+        /// Only images that have a texture of their own can be evicted, svg images and images in atlas pages remain loaded.
+        /// With damage tracking, images only count as unused when they weren't drawn since everything was last redrawn, as
+        /// widgets outside the damaged regions are still visible. Widgets with a render cache don't draw their images, so
+        /// they count as unused. Setting the budget too low can cause images to be reloaded often.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void setMemoryBudget(std::size_t bytes);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory the loaded images may use before unused images are evicted
+        ///
+        /// @return Maximum amount of pixel data in loaded images, or 0 if images are never evicted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static std::size_t getMemoryBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns how much memory the images currently use and how often they were evicted and reloaded
+        ///
+        /// @return Resident memory and the amount of evictions and reloads since the last reset
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static MemoryStatistics getMemoryStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Resets the amount of evictions and reloads that is returned by getMemoryStatistics to 0
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void resetMemoryStatistics();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Evicts images that weren't drawn in the current frame when the memory budget is exceeded
+        ///
+        /// @return True when the images still take more memory than the budget allows, because they were all drawn recently
+        ///
+        /// This function is called by the gui every frame, you only need to call it yourself if you don't use the gui.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static bool enforceMemoryBudget();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Starts a new frame, after which images that aren't drawn again can be evicted
+        ///
+        /// This function is called by the gui each time everything is drawn, you only need to call it yourself if you don't use
+        /// the gui. Time passing without anything being drawn, or only redrawing the damaged regions, doesn't make images older.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void startFrame();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /// @brief Marks the texture as used in the current frame and reloads its image if it was evicted
+        ///
+        /// @param data  Texture data that is about to be drawn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        static void useTexture(TextureData& data);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
     protected:
 
+        // Tries to load the image into an atlas page and returns true on success
+        static bool loadIntoAtlas(Texture& texture, TextureData& data, const String& filename, bool smooth);
+
+        // Finds a free spot of the given size in one of the atlas pages, creating a new page if needed
+        static std::size_t findAtlasSpace(Vector2u size, bool smooth, Vector2u& position);
+
+        // Informs the atlas page that one of its images is no longer used, so that its space can be reused
+        static void removeFromAtlas(const TextureData& data);
+
+        // Copies the pixels of an image into an atlas page, or into its own texture if it is too large for a page
+        static bool addToAtlas(TextureData& data, Vector2u imageSize, std::unique_ptr<std::uint8_t[]> imagePixels, bool smooth);
+
+        // Loads an image again after it was evicted
+        static void reloadTexture(TextureData& data);
+
+        struct AtlasRow
+        {
+            unsigned int top;
+            unsigned int height;
+            unsigned int width;
+        };
+
+        struct AtlasPage
+        {
+            std::shared_ptr<BackendTextureBase> texture;
+            unsigned int size = 0;
+            bool smooth = true;
+            std::vector<AtlasRow> rows;
+            std::vector<UIntRect> freeRects; // Space of removed images that can be reused by images of the same or a smaller size
+            std::size_t usedArea = 0;
+            unsigned int imageCount = 0;
+        };
+
+        // Marks a part of an atlas page as free, merging it with the free space around it
+        static void addFreeAtlasSpace(AtlasPage& page, UIntRect rect);
+
         static std::map<String, std::list<TextureDataHolder>> m_imageMap;
+
+        static bool m_atlasEnabled;
+        static unsigned int m_atlasPageSize;
+        static std::vector<AtlasPage> m_atlasPages;
+
+        static bool m_asyncLoadingEnabled;
+        static std::function<void(const String& filename, bool success)> m_asyncLoadFinishedCallback;
+
+        static std::size_t m_memoryBudget;
+        static std::size_t m_residentBytes; // Memory used by the images and atlas pages that are currently loaded
+        static std::uint64_t m_frameCounter;
+        static std::size_t m_evictionCount;
+        static std::size_t m_reloadCount;
     };
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -633,6 +633,19 @@ namespace tgui
         void moveToBack();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Tells the gui that the part of the screen covered by the widget has to be redrawn
+        ///
+        /// Widgets call this function themselves whenever something changes that affects how they look. It only has to be
+        /// called manually from custom widgets when their appearance changes outside the functions of the Widget base class.
+        /// The render caches of the containers in which the widget is located are marked as outdated, the region on the screen
+        /// is only remembered when damage tracking is enabled in the gui.
+        ///
+        /// @see GuiBase::setDamageTrackingEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void invalidate();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Stores some data into the widget
         /// @param userData  Data to store
@@ -1147,6 +1160,9 @@ namespace tgui
         float m_opacityCached = 1;
         bool m_transparentTextureCached = false;
 
+        // Renderer properties containing a texture that was still being loaded in the background when it was set
+        std::vector<String> m_loadingTextureProperties;
+
         Any m_userData;
         Cursor::Type m_mouseCursor = Cursor::Type::Arrow;
 
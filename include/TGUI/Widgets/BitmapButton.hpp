@@ -155,6 +155,12 @@ namespace tgui
         void rendererChanged(const String& property) override;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Saves the widget as a tree node in order to save it to a file
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -212,6 +218,7 @@ namespace tgui
         std::shared_ptr<priv::dev::ImageComponent> m_imageComponent;
 
         float m_relativeGlyphHeight = 0;
+        bool m_imageLoading = false;
 
         std::uint64_t m_textStyleChangedCallbackId = 0;
     };
@@ -185,6 +185,17 @@ namespace tgui
         std::size_t addItem(const String& itemName, const String& id = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple items to the list
+        ///
+        /// @param itemNames  The names of the items you want to add
+        /// @param ids        Optional ids for the items, the item at index i gets the id at index i (if there is one)
+        ///
+        /// This is faster than calling addItem for each item, the size of the list is only recalculated once.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addMultipleItems(const std::vector<String>& itemNames, const std::vector<String>& ids = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item from the list
         ///
@@ -524,6 +535,44 @@ namespace tgui
         bool getChangeItemOnScroll() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether an index is kept to quickly find items by their text or id
+        ///
+        /// @param enabled  Should the search index be used?
+        ///
+        /// @see ListBox::setSearchIndexEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSearchIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether an index is kept to quickly find items by their text or id
+        ///
+        /// @return Is the search index used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSearchIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether typing selects the item that starts with the typed text
+        ///
+        /// @param enabled  Should typed text select the item that starts with it?
+        ///
+        /// Typing works both while the list is open and while the combo box is focused with the list closed.
+        ///
+        /// @see ListBox::setTypeAheadEnabled
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTypeAheadEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether typing selects the item that starts with the typed text
+        ///
+        /// @return Does typed text select the item that starts with it?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTypeAheadEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @internal
         /// This function is called when the widget is added to a container.
@@ -550,6 +599,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool mouseWheelScrolled(float delta, Vector2f pos) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textEntered(char32_t key) override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
@@ -627,6 +681,12 @@ namespace tgui
         void initListBox();
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // This function is called every frame with the time passed since the last frame.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateTime(Duration elapsedTime) override;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Makes a copy of the widget
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListBoxRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <unordered_map>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -126,6 +127,18 @@ namespace tgui
         std::size_t addItem(const String& itemName, const String& id = "");
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Adds multiple items to the list
+        ///
+        /// @param itemNames  The names of the items you want to add
+        /// @param ids        Optional ids for the items, the item at index i gets the id at index i (if there is one)
+        ///
+        /// This is faster than calling addItem for each item. When a maximum amount of items is set then only the items
+        /// that still fit in the list are added.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addMultipleItems(const std::vector<String>& itemNames, const std::vector<String>& ids = {});
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Selects an item in the list box
         ///
@@ -509,6 +522,61 @@ namespace tgui
         bool containsId(const String& id) const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether an index is kept to quickly find items by their text or id
+        ///
+        /// @param enabled  Should the search index be used?
+        ///
+        /// Without search index, functions like setSelectedItem, getIndexById and contains have to compare the given string with
+        /// every item and findItemByPrefix has to check every item. The index makes these lookups fast in lists with many items,
+        /// at the cost of extra memory and some extra work when items are added, changed or removed.
+        ///
+        /// The search index is disabled by default.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSearchIndexEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether an index is kept to quickly find items by their text or id
+        ///
+        /// @return Is the search index used?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSearchIndexEnabled() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Finds an item that starts with the given text, ignoring the case of ASCII characters
+        ///
+        /// @param prefix      Text with which the item should start
+        /// @param startIndex  Index of the first item to check. Items before it are only checked when no item after it matches.
+        ///
+        /// @return Index of the first matching item at or after startIndex, or -1 when no item starts with the prefix
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemByPrefix(const String& prefix, std::size_t startIndex = 0) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes whether typing while the list box is focused selects an item
+        ///
+        /// @param enabled  Should typed text select the item that starts with it?
+        ///
+        /// When enabled, the typed characters are collected and the first item that starts with them will be selected.
+        /// The collected text is cleared when nothing is typed for a second. Typing the same character repeatedly cycles
+        /// through the items that start with that character.
+        ///
+        /// Type-ahead is disabled by default. Enable the search index when the list contains many items.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setTypeAheadEnabled(bool enabled);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether typing while the list box is focused selects an item
+        ///
+        /// @return Does typed text select the item that starts with it?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isTypeAheadEnabled() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the thumb position of the scrollbar
         ///
@@ -568,6 +636,11 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         void keyPressed(const Event::KeyEvent& event) override;
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @internal
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void textEntered(char32_t key) override;
+
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Draw the widget to a render target
@@ -622,9 +695,53 @@ namespace tgui
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        // Update the colors and text style of the selected and hovered items
+        // Returns the color and text style that the text of an item should have
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getItemTextColor(std::size_t index) const;
+        TextStyles getItemTextStyle(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Creates the text object that is used to draw an item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Text createItemText(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes certain that m_visibleItemTexts contains the texts of the items in the range [firstItem, lastItem)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update the color and text style of an item if its text currently exists
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        void updateSelectedAndHoveringItemColorsAndStyle();
+        void updateVisibleItemColorAndStyle(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the first item with the given text, or -1 if there is no such item
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int findItemIndex(const String& itemName) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds an item to the search index or removes it from the index
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void addItemToSearchIndex(std::size_t index);
+        void removeItemFromSearchIndex(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Fills the prefix index with the lowercase texts of all items and sorts it
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updatePrefixIndex() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item with the given serial number
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getIndexOfSerial(std::size_t serial) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -674,13 +791,34 @@ namespace tgui
 
         struct Item
         {
-            Text text;
+            String text;
             Any data;
             String id;
+            std::size_t serial = 0; // Increases with every added item, so the items are always sorted on it
         };
 
         std::vector<Item> m_items;
 
+        // Text objects are only created for the items that are visible, the other items are only stored as strings
+        mutable std::vector<Text> m_visibleItemTexts; // Texts of the items starting at m_visibleItemTextsFirstIndex
+        mutable std::size_t m_visibleItemTextsFirstIndex = 0;
+        mutable bool m_visibleItemTextsOutdated = false; // Set when the texts have to be recreated
+
+        std::size_t m_nextItemSerial = 0;
+
+        // Optional index to find items without comparing with every item. It stores the serial numbers of the items instead
+        // of their indices, so that removing an item doesn't require updating the index of every item that comes after it.
+        // The vectors of serial numbers are kept sorted.
+        bool m_searchIndexEnabled = false;
+        std::unordered_map<std::u32string, std::vector<std::size_t>> m_itemSerialsByText;
+        std::unordered_map<std::u32string, std::vector<std::size_t>> m_itemSerialsById;
+        mutable std::vector<std::pair<std::u32string, std::size_t>> m_prefixIndex; // Lowercase text and serial of each item, sorted
+        mutable bool m_prefixIndexOutdated = false; // Set when items change, the prefix index is only sorted again when searching
+
+        bool m_typeAheadEnabled = false;
+        String m_typeAheadText;
+        Duration m_typeAheadTimeElapsed;
+
         // What is the index of the selected item?
         // This is also used by combo box, so it can't just be changed to a pointer!
         int m_selectedItem = -1;
@@ -31,6 +31,7 @@
 #include <TGUI/Widgets/Scrollbar.hpp>
 #include <TGUI/Renderers/ListViewRenderer.hpp>
 #include <TGUI/Text.hpp>
+#include <map>
 #include <set>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -49,6 +50,8 @@ namespace tgui
         typedef std::shared_ptr<ListView> Ptr; //!< Shared widget pointer
         typedef std::shared_ptr<const ListView> ConstPtr; //!< Shared constant widget pointer
 
+        using CellProvider = std::function<String(std::size_t row, std::size_t column)>; //!< Returns the text of a cell in virtual mode
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief The text alignment for all texts within a column
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -511,6 +514,126 @@ namespace tgui
         void sort(std::size_t index, const std::function<bool(const String&, const String&)>& cmp);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Lets the list view show rows of which the texts are provided by a callback function instead of storing them
+        ///
+        /// @param itemCount     Amount of rows in the list view
+        /// @param cellProvider  Function that returns the text for a given row and column index, or nullptr to leave virtual mode
+        ///
+        /// In virtual mode the list view only creates Text objects for the rows that are visible, so the memory usage depends on
+        /// the size of the list view instead of on the amount of rows. The cell provider is called when a row becomes visible and
+        /// by functions such as getItemCell and getItemRow.
+        ///
+        /// Any existing items are removed when calling this function. While in virtual mode, the rows can't be added, changed
+        /// or removed with functions such as addItem, nor can they have data or an icon. Calling sort has no effect: the
+        /// application should sort its own data (e.g. when onHeaderClick is triggered) and call refreshVirtualItems afterwards.
+        /// The width of the rows isn't measured, so when there are no columns or when the last column is expanded, the
+        /// horizontal scrollbar won't take the texts into account. Virtual rows are not saved to a file.
+        ///
+        /// Calling removeAllItems also leaves virtual mode.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItems(std::size_t itemCount, CellProvider cellProvider);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Changes the amount of rows while in virtual mode
+        ///
+        /// @param itemCount  Amount of rows in the list view
+        ///
+        /// Selected items with an index that no longer exists are deselected.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setVirtualItemCount(std::size_t itemCount);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Informs the list view that the texts returned by the cell provider have changed
+        ///
+        /// The cell provider will be called again for all visible rows the next time the list view is drawn.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void refreshVirtualItems();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the list view is in virtual mode
+        ///
+        /// @return Are the texts of the rows provided by a callback function that was passed to setVirtualItems?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool hasVirtualItems() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Displays the items sorted on the texts in a column, without changing the item indices
+        ///
+        /// @param columnIndex  Index of the column to sort on, or -1 to display the items in the order in which they were added
+        /// @param ascending    Should the items be sorted from low to high (true) or from high to low (false)?
+        ///
+        /// Cells that contain a number are compared by their value and are placed before cells containing text, which are
+        /// compared with the collation rules of the global locale (std::locale). Items with equal cells keep their relative order.
+        ///
+        /// Unlike sort, the items themselves are not moved: the indices passed to and returned by the other functions keep
+        /// referring to the same items, only the order in which they are displayed changes. When there are many items, the
+        /// sorting happens on a background thread and the new order is shown from the next frame after it finished.
+        /// Items that are added or changed while sorted are immediately moved to their correct place, or once the background
+        /// thread finished if it is still running.
+        ///
+        /// Sorting is not supported in virtual mode, the application should sort its own data instead.
+        ///
+        /// @see setItemFilter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setSortColumn(int columnIndex, bool ascending = true);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the index of the column on which the displayed items are sorted
+        ///
+        /// @return Column index passed to setSortColumn, or -1 when the items aren't sorted
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        int getSortColumn() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the displayed items are sorted from low to high or from high to low
+        ///
+        /// @return Value of the ascending parameter that was passed to setSortColumn
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool getSortAscending() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Only displays the items that contain a given text in one of their cells
+        ///
+        /// @param filter  Text to search for, ignoring the case of ASCII letters, or an empty string to display all items
+        ///
+        /// Just like with setSortColumn, the item indices don't change and filtering many items happens on a background thread.
+        /// Items that are hidden by the filter remain selected when they were selected before.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void setItemFilter(const String& filter);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the text that all displayed items must contain
+        ///
+        /// @return Text passed to setItemFilter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        String getItemFilter() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns the indices of the items that are displayed, in the order in which they are displayed
+        ///
+        /// @return Item indices, taking setSortColumn and setItemFilter into account
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::vector<std::size_t> getDisplayedItemIndices() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the items are still being sorted or filtered in the background
+        ///
+        /// @return Will the displayed order still change in a future frame because of setSortColumn or setItemFilter?
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isSortingOrFiltering() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Changes the height of the items in the list view
         ///
@@ -857,7 +980,7 @@ namespace tgui
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Create a Text object for an item from the given caption, using the preset color, font, text size and opacity
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-        Text createText(const String& caption);
+        Text createText(const String& caption) const;
 
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -872,6 +995,85 @@ namespace tgui
         virtual void setItemColor(std::size_t index, const Color& color);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the color that the texts of an item should have, based on whether it is selected and hovered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        Color getItemTextColor(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Makes sure the virtual items between firstItem and lastItem exist, reusing Text objects of rows that are no longer visible
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateVirtualItems(std::size_t firstItem, std::size_t lastItem) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns whether the items are sorted or filtered, which means that the rows and item indices might not match
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isItemOrderRequired() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the amount of rows that are displayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRowCount() const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the index of the item that is displayed at the given row
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getItemIndexAtRow(std::size_t row) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the row at which an item is displayed, or String::npos when the item is hidden by the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::size_t getRowOfItem(std::size_t index) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Returns the indices of the items that are displayed between two items (including the items themselves)
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        std::set<std::size_t> getItemsBetween(int firstIndex, int secondIndex) const;
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sorts and filters the items again, either directly or by starting a background thread
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void startItemOrderJob(bool allowBackgroundThread);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Uses the result of a finished job as the new order in which the items are displayed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void finishItemOrderJob();
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the item order after items were inserted, only the new items are sorted and filtered
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemOrderWithInsertedItems(std::size_t index, std::size_t count);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Moves an item to its new row after its texts were changed, or hides it when it no longer matches the filter
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemOrderWithChangedItem(std::size_t index);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Adds the rows of items that aren't part of the item order yet, skipping those that don't match the filter.
+        // The new rows are placed with a binary search, so the other items don't have to be sorted again.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void insertItemsInOrder(std::vector<std::size_t> items);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Updates the item order after an item was removed
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        void updateItemOrderWithRemovedItem(std::size_t index);
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Calculate the width of the column based on its caption when no column width was provided
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -910,6 +1112,7 @@ namespace tgui
 
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Update the maximum item width of the last column by recalculating all items' widths.
+        // This is only needed when the widths of all items change, e.g. when the font changes.
         // Returns whether the max item width was changed.
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         bool updateLastColumnMaxItemWidth();
@@ -929,6 +1132,20 @@ namespace tgui
         bool updateLastColumnMaxItemWidthWithModifiedItem(const Item& modifiedItem, float oldDesiredWidthInLastColumn);
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Update the maximum item width of the last column based on the removal of an Item.
+        // Returns true if the maximum item width was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateLastColumnMaxItemWidthWithRemovedItem(float oldDesiredWidthInLastColumn);
+
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        // Sets the maximum item width of the last column to the largest width in m_lastColumnItemWidths.
+        // Returns true if the maximum item width was changed.
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool updateLastColumnMaxItemWidthFromItemWidths();
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         // Add item to selected set
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1044,6 +1261,7 @@ namespace tgui
         unsigned int m_iconCount = 0;
         float m_maxIconWidth = 0;
         float m_maxItemWidth = 0; // If there are no columns, this is the maximum width from all items
+        std::map<float, std::size_t> m_lastColumnItemWidths; // Amount of items for each width in the last column, used to find the maximum item width without checking all items
         bool m_headerVisible = true;
         bool m_showHorizontalGridLines = false;
         bool m_showVerticalGridLines = true;
@@ -1060,6 +1278,42 @@ namespace tgui
         int m_possibleDoubleClick = false; // Will be set to true after the first click, but gets reset to false when the second click does not occur soon after
         bool m_autoScroll = true; // Should the list view scroll to the bottom when a new item is added?
 
+        // Virtual mode, where m_items remains empty and only the visible rows are created
+        CellProvider m_virtualCellProvider;
+        std::size_t m_virtualItemCount = 0;
+        mutable std::vector<Item> m_virtualItems; // Rows starting at m_virtualItemsFirstIndex that were visible when last drawn
+        mutable std::size_t m_virtualItemsFirstIndex = 0;
+        mutable bool m_virtualItemsOutdated = false; // Set when the texts have to be requested again from the cell provider
+
+        // Order in which items are displayed when they are sorted or filtered
+        struct ItemOrderJob;
+        class ItemOrderWorker;
+
+        // Owns the thread that sorts and filters the items of this list view in the background, which is joined when the list
+        // view is destroyed. A copy of the list view doesn't share the thread, it starts its own one when it needs it.
+        struct TGUI_API ItemOrderWorkerHolder
+        {
+            ItemOrderWorkerHolder();
+            ItemOrderWorkerHolder(const ItemOrderWorkerHolder&);
+            ItemOrderWorkerHolder& operator=(const ItemOrderWorkerHolder&);
+            ~ItemOrderWorkerHolder();
+
+            std::unique_ptr<ItemOrderWorker> worker;
+        };
+
+        int m_sortColumn = -1;
+        bool m_sortAscending = true;
+        String m_itemFilter;
+        std::vector<std::size_t> m_itemOrder; // Item index for each displayed row, only used when m_useItemOrder is true
+        bool m_useItemOrder = false;
+        bool m_itemOrderOutdated = false; // Set when items were added or changed after the order was calculated
+        std::size_t m_itemOrderGeneration = 0; // Changes when items are inserted or removed, which invalidates a running job
+        std::shared_ptr<ItemOrderJob> m_itemOrderJob;
+        ItemOrderWorkerHolder m_itemOrderWorker;
+        std::vector<std::size_t> m_itemsChangedDuringOrderJob; // Items that have to be placed again when the running job finishes
+        mutable std::vector<std::size_t> m_itemRows; // Row for each item index, calculated from m_itemOrder when needed
+        mutable bool m_itemRowsOutdated = true;
+
         // Cached renderer properties
         Borders   m_bordersCached;
         Borders   m_paddingCached;
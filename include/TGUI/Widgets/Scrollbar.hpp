@@ -429,6 +429,12 @@ namespace tgui
         bool isMouseDownOnThumb() const;
 
 
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        /// @brief Returns whether the mouse is currently on top of the scrollbar
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        bool isMouseHovered() const;
+
+
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
         /// @brief Returns whether the scrollbar is currently visible
         /// @return Is the scrollbar visible?
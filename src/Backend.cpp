@@ -27,6 +27,7 @@
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Timer.hpp>
 #include <TGUI/Font.hpp>
+#include <TGUI/SvgImage.hpp>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -64,6 +65,9 @@ namespace tgui
             // Destroy the global font
             Font::setGlobalFont(nullptr);
 
+            // Destroy the rasterized svg images that are no longer used by any widget
+            SvgImage::clearRasterCache();
+
             // Destroy the global theme
             Theme::setDefault(nullptr);
         }
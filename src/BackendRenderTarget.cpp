@@ -24,6 +24,7 @@
 
 
 #include <TGUI/BackendRenderTarget.hpp>
+#include <algorithm>
 #include <array>
 #include <cmath>
 
@@ -287,6 +288,92 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> BackendRenderTargetBase::drawOffscreen(const DisplayList&, FloatRect, Vector2u)
+    {
+        return nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetBase::getCulledPrimitiveCount() const
+    {
+        return m_culledPrimitiveCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect BackendRenderTargetBase::getSpriteBounds(const Sprite& sprite)
+    {
+        if (sprite.getRotation() == 0)
+            return {sprite.getPosition(), sprite.getSize()};
+
+        Transform transform;
+        transform.translate(-Transform().rotate(sprite.getRotation()).transformRect({{}, sprite.getSize()}).getPosition());
+        transform.rotate(sprite.getRotation());
+        return transform.transformRect({sprite.getPosition(), sprite.getSize()});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect BackendRenderTargetBase::getTextBounds(const Text& text)
+    {
+        const float margin = text.getOutlineThickness() + (text.getCharacterSize() / 2.f);
+        return {text.getPosition() - Vector2f{margin, margin}, text.getSize() + Vector2f{2 * margin, 2 * margin}};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect BackendRenderTargetBase::getVertexBounds(const Vertex* vertices, std::size_t vertexCount)
+    {
+        if (vertexCount == 0)
+            return {};
+
+        Vector2f minPos = vertices[0].position;
+        Vector2f maxPos = minPos;
+        for (std::size_t i = 1; i < vertexCount; ++i)
+        {
+            const Vector2f& pos = vertices[i].position;
+            minPos.x = std::min(minPos.x, pos.x);
+            minPos.y = std::min(minPos.y, pos.y);
+            maxPos.x = std::max(maxPos.x, pos.x);
+            maxPos.y = std::max(maxPos.y, pos.y);
+        }
+
+        return {minPos, maxPos - minPos};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetBase::unpremultiplyAlpha(std::uint8_t* pixels, std::size_t pixelCount)
+    {
+        for (std::size_t i = 0; i < pixelCount * 4; i += 4)
+        {
+            const unsigned int alpha = pixels[i + 3];
+            if ((alpha == 0) || (alpha == 255))
+                continue;
+
+            for (std::size_t c = 0; c < 3; ++c)
+                pixels[i + c] = static_cast<std::uint8_t>(std::min(255u, (pixels[i + c] * 255u + (alpha / 2)) / alpha));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetBase::isCulled(const Transform& transform, const FloatRect& bounds, const FloatRect& clipRect)
+    {
+        const FloatRect transformedBounds = transform.transformRect(bounds);
+        if ((transformedBounds.left > clipRect.left + clipRect.width) || (transformedBounds.top > clipRect.top + clipRect.height)
+         || (transformedBounds.left + transformedBounds.width < clipRect.left) || (transformedBounds.top + transformedBounds.height < clipRect.top))
+        {
+            ++m_culledPrimitiveCount;
+            return true;
+        }
+
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
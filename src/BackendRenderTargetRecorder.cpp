@@ -0,0 +1,148 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/BackendRenderTargetRecorder.hpp>
+#include <TGUI/Container.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    const DisplayList& BackendRenderTargetRecorder::getDisplayList() const
+    {
+        return m_displayList;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::clear()
+    {
+        m_displayList.clear();
+        m_clippingLayers.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::setView(FloatRect view, FloatRect)
+    {
+        m_viewRect = view;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::drawGui(const std::shared_ptr<RootContainer>& root)
+    {
+        clear();
+        root->draw(*this, {});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
+    {
+        // Widgets that lie outside of the clip rect wouldn't be drawn by the other render targets either
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back();
+        if (m_clippingLayers.empty() && ((m_viewRect.width <= 0) || (m_viewRect.height <= 0)))
+        {
+            widget->draw(*this, states);
+            return;
+        }
+
+        const Vector2f widgetBottomRight{states.transform.transformPoint(widget->getWidgetOffset() + widget->getFullSize())};
+        const Vector2f widgetTopLeft = states.transform.transformPoint(widget->getWidgetOffset());
+        if ((widgetTopLeft.x > clipRect.left + clipRect.width) || (widgetTopLeft.y > clipRect.top + clipRect.height)
+         || (widgetBottomRight.x < clipRect.left) || (widgetBottomRight.y < clipRect.top))
+            return;
+
+        widget->draw(*this, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::addClippingLayer(const RenderStates& states, FloatRect rect)
+    {
+        const Vector2f bottomRight{states.transform.transformPoint(rect.getPosition() + rect.getSize())};
+        const Vector2f topLeft = states.transform.transformPoint(rect.getPosition());
+        m_clippingLayers.push_back({topLeft, bottomRight - topLeft});
+
+        m_displayList.addClippingLayer(states, rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::removeClippingLayer()
+    {
+        TGUI_ASSERT(!m_clippingLayers.empty(), "BackendRenderTargetRecorder::removeClippingLayer was called when there were no clipping layers");
+        m_clippingLayers.pop_back();
+
+        m_displayList.removeClippingLayer();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::drawBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color)
+    {
+        m_displayList.addBorders(states, borders, size, color);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::drawFilledRect(const RenderStates& states, Vector2f size, Color color)
+    {
+        m_displayList.addFilledRect(states, size, color);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::drawSprite(const RenderStates& states, const Sprite& sprite)
+    {
+        if (!sprite.isSet())
+            return;
+
+        m_displayList.addSprite(states, sprite);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::drawText(const RenderStates& states, const Text& text)
+    {
+        m_displayList.addText(states, text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetRecorder::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    {
+        if (vertexCount == 0)
+            return;
+
+        m_displayList.addTriangles(states, vertices, vertexCount, indices, indexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -29,10 +29,45 @@
 
 namespace tgui
 {
+    bool BackendTextureBase::m_defaultAlphaMaskEnabled = true;
+    std::size_t BackendTextureBase::m_totalCpuMemoryUsage = 0;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTextureBase::BackendTextureBase() :
+        m_alphaMaskEnabled{m_defaultAlphaMaskEnabled}
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendTextureBase::~BackendTextureBase()
+    {
+        // Textures that never kept memory don't touch the total, they may be used to decode images on other threads
+        if (m_cpuMemoryUsage > 0)
+            m_totalCpuMemoryUsage -= m_cpuMemoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendTextureBase::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels)
     {
-        m_pixels = std::move(pixels);
         m_imageSize = size;
+        createAlphaMask(pixels.get());
+        setCpuMemoryUsage(m_alphaMaskSize);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureBase::update(Vector2u position, Vector2u size, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT((position.x + size.x <= m_imageSize.x) && (position.y + size.y <= m_imageSize.y),
+                    "BackendTextureBase::update called with a part that doesn't lie inside the texture");
+
+        const std::size_t oldAlphaMaskSize = m_alphaMaskSize;
+        updateAlphaMask(position, size, pixels);
+        setCpuMemoryUsage(m_cpuMemoryUsage - oldAlphaMaskSize + m_alphaMaskSize);
         return true;
     }
 
@@ -40,13 +75,157 @@ namespace tgui
 
     bool BackendTextureBase::isTransparentPixel(Vector2u pixel) const
     {
-        if (!m_pixels)
+        if (!m_alphaMask)
             return false;
 
         TGUI_ASSERT((pixel.x < m_imageSize.x) && (pixel.y < m_imageSize.y), "Pixel out of range in BackendTextureBase::isTransparentPixel");
 
-        const auto pixelOffset = (pixel.y * m_imageSize.x + pixel.x) * 4;
-        return (m_pixels[pixelOffset + 3] == 0);
+        const std::size_t pixelIndex = static_cast<std::size_t>(pixel.y) * m_imageSize.x + pixel.x;
+        return (m_alphaMask[pixelIndex / 8] & (1u << (pixelIndex % 8))) != 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureBase::setAlphaMaskEnabled(bool enabled)
+    {
+        m_alphaMaskEnabled = enabled;
+        if (!enabled && m_alphaMask)
+        {
+            setCpuMemoryUsage(m_cpuMemoryUsage - m_alphaMaskSize);
+            m_alphaMask = nullptr;
+            m_alphaMaskSize = 0;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureBase::isAlphaMaskEnabled() const
+    {
+        return m_alphaMaskEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureBase::setDefaultAlphaMaskEnabled(bool enabled)
+    {
+        m_defaultAlphaMaskEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureBase::getDefaultAlphaMaskEnabled()
+    {
+        return m_defaultAlphaMaskEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureBase::takeAlphaMask(BackendTextureBase& other)
+    {
+        TGUI_ASSERT(other.m_imageSize == m_imageSize, "BackendTextureBase::takeAlphaMask called with a texture of a different size");
+
+        const std::size_t alphaMaskSize = other.m_alphaMaskSize;
+        other.setCpuMemoryUsage(other.m_cpuMemoryUsage - alphaMaskSize);
+        setCpuMemoryUsage(m_cpuMemoryUsage - m_alphaMaskSize + alphaMaskSize);
+
+        m_alphaMask = std::move(other.m_alphaMask);
+        m_alphaMaskSize = alphaMaskSize;
+        other.m_alphaMaskSize = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendTextureBase::getCpuMemoryUsage()
+    {
+        return m_totalCpuMemoryUsage;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureBase::setCpuMemoryUsage(std::size_t bytes)
+    {
+        m_totalCpuMemoryUsage = m_totalCpuMemoryUsage - m_cpuMemoryUsage + bytes;
+        m_cpuMemoryUsage = bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureBase::createAlphaMask(const std::uint8_t* pixels)
+    {
+        m_alphaMask = nullptr;
+        m_alphaMaskSize = 0;
+
+        const std::size_t pixelCount = static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y;
+        if (!m_alphaMaskEnabled || !pixels || (pixelCount == 0))
+            return;
+
+        // Pack the alpha channel of 8 pixels into each byte. The inner loop has no branches and a fixed length,
+        // so that the compiler can vectorize it.
+        const std::size_t maskSize = (pixelCount + 7) / 8;
+        auto mask = std::make_unique<std::uint8_t[]>(maskSize);
+        std::uint8_t transparentPixelsFound = 0;
+        const std::size_t fullBytes = pixelCount / 8;
+        for (std::size_t i = 0; i < fullBytes; ++i)
+        {
+            const std::uint8_t* alpha = &pixels[i * 8 * 4 + 3];
+            std::uint8_t bits = 0;
+            for (unsigned int bit = 0; bit < 8; ++bit)
+                bits |= static_cast<std::uint8_t>((alpha[bit * 4] == 0) << bit);
+
+            mask[i] = bits;
+            transparentPixelsFound |= bits;
+        }
+
+        for (std::size_t pixelIndex = fullBytes * 8; pixelIndex < pixelCount; ++pixelIndex)
+        {
+            const std::uint8_t bit = static_cast<std::uint8_t>((pixels[pixelIndex * 4 + 3] == 0) << (pixelIndex % 8));
+            mask[pixelIndex / 8] |= bit;
+            transparentPixelsFound |= bit;
+        }
+
+        // A mask without transparent pixels gives the same answers as not having a mask at all
+        if (transparentPixelsFound)
+        {
+            m_alphaMask = std::move(mask);
+            m_alphaMaskSize = maskSize;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureBase::updateAlphaMask(Vector2u position, Vector2u size, const std::uint8_t* pixels)
+    {
+        if (!m_alphaMaskEnabled || !pixels)
+            return;
+
+        // Without a mask all pixels are opaque, so a mask is only needed when the new part contains transparent pixels
+        if (!m_alphaMask)
+        {
+            const std::size_t partPixelCount = static_cast<std::size_t>(size.x) * size.y;
+            std::size_t i = 0;
+            while ((i < partPixelCount) && (pixels[i * 4 + 3] != 0))
+                ++i;
+
+            if (i == partPixelCount)
+                return;
+
+            m_alphaMaskSize = (static_cast<std::size_t>(m_imageSize.x) * m_imageSize.y + 7) / 8;
+            m_alphaMask = std::make_unique<std::uint8_t[]>(m_alphaMaskSize);
+        }
+
+        for (unsigned int y = 0; y < size.y; ++y)
+        {
+            const std::uint8_t* alpha = &pixels[static_cast<std::size_t>(y) * size.x * 4 + 3];
+            std::size_t pixelIndex = (static_cast<std::size_t>(position.y) + y) * m_imageSize.x + position.x;
+            for (unsigned int x = 0; x < size.x; ++x, ++pixelIndex)
+            {
+                const std::uint8_t bit = static_cast<std::uint8_t>(1u << (pixelIndex % 8));
+                if (alpha[x * 4] == 0)
+                    m_alphaMask[pixelIndex / 8] |= bit;
+                else
+                    m_alphaMask[pixelIndex / 8] &= static_cast<std::uint8_t>(~bit);
+            }
+        }
     }
 }
 
@@ -25,18 +25,32 @@
 
 #include <TGUI/Backends/SDL/BackendFontSDL.hpp>
 #include <TGUI/Backends/SDL/FontCacheSDL.hpp>
+#include <TGUI/Backends/SDL/BackendSDL.hpp>
+#include <TGUI/GlyphAtlasCache.hpp>
 #include <TGUI/Global.hpp>
+#include <TGUI/OpenGL.hpp>
 
+#include <algorithm>
 #include <cstring> // memcpy
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    static const unsigned int InitialAtlasSize = 256;
+    static const unsigned int AtlasGlyphPadding = 1; // Empty pixels between glyphs to prevent bleeding when interpolating
+    static const char* const GlyphCacheBackendName = "sdl"; // Keys of the atlas glyphs are specific to this backend
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     BackendFontSDL::~BackendFontSDL()
     {
+        if (m_glyphCacheOutdated && !m_glyphCacheFilename.empty())
+            saveGlyphCache(m_glyphCacheFilename);
+
+        if (m_atlasTexture != 0)
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_atlasTexture));
+
         if (m_lastCharacterSize != 0)
             FontCacheSDL::unregisterFontSize(this, m_lastCharacterSize);
 
@@ -47,63 +61,79 @@ namespace tgui
 
     bool BackendFontSDL::loadFromFile(const String& filename)
     {
-        std::size_t fileSize;
-        auto fileContents = readFileToMemory(filename, fileSize);
+        auto fileContents = FontFileCache::loadFromFile(filename);
         if (!fileContents)
             return false;
 
-        m_fileContents = std::move(fileContents);
-        m_fileSize = fileSize;
-
-        return (getInternalFont(getGlobalTextSize()) != nullptr);
+        return loadFileContents(std::move(fileContents));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendFontSDL::loadFromMemory(const void* data, std::size_t sizeInBytes)
     {
-        m_fileSize = sizeInBytes;
-        m_fileContents = std::make_unique<std::uint8_t[]>(sizeInBytes);
-        std::memcpy(m_fileContents.get(), data, sizeInBytes);
+        return loadFileContents(FontFileCache::loadFromMemory(data, sizeInBytes));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSDL::loadFileContents(std::shared_ptr<const FontFileCache::FileContents> fileContents)
+    {
+        if (m_glyphCacheOutdated && !m_glyphCacheFilename.empty())
+            saveGlyphCache(m_glyphCacheFilename);
 
-        return (getInternalFont(getGlobalTextSize()) != nullptr);
+        m_glyphCacheFilename.clear();
+        m_glyphCacheOutdated = false;
+
+        m_fileContents = std::move(fileContents);
+        m_glyphMetrics.clear();
+        m_lastGlyphMetricsTable = nullptr;
+
+        if (getInternalFont(getGlobalTextSize()) == nullptr)
+            return false;
+
+        if (!GlyphAtlasCache::getDirectory().empty())
+        {
+            m_glyphCacheFilename = GlyphAtlasCache::getFilename(GlyphCacheBackendName, m_fileContents->getHash());
+            loadGlyphCache(m_glyphCacheFilename);
+        }
+
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     FontGlyph BackendFontSDL::getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
     {
-        FontGlyph glyph;
-
-        TTF_Font* font = getInternalFont(characterSize);
-        if (!font)
-            return glyph;
+        const int style = bold ? TTF_STYLE_BOLD : TTF_STYLE_NORMAL;
+        const int outline = static_cast<int>(outlineThickness);
+        GlyphMetricsTable& table = getGlyphMetricsTable(characterSize, style, outline);
 
-        if (bold)
-            TTF_SetFontStyle(font, TTF_STYLE_BOLD);
+        if (codePoint < table.asciiGlyphs.size())
+        {
+            if (!table.asciiGlyphsLoaded[codePoint])
+            {
+                TTF_Font* font = getInternalFont(characterSize);
+                if (!font)
+                    return {};
 
-        if (outlineThickness != 0)
-            TTF_SetFontOutline(font, static_cast<int>(outlineThickness));
+                table.asciiGlyphs[codePoint] = loadGlyphMetrics(font, codePoint, style, outline);
+                table.asciiGlyphsLoaded[codePoint] = true;
+            }
 
-        int minX;
-        int maxX;
-        int minY;
-        int maxY;
-        int advance;
-        if (TTF_GlyphMetrics(font, static_cast<std::uint16_t>(codePoint), &minX, &maxX, &minY, &maxY, &advance) != 0)
-            return glyph;
+            return table.asciiGlyphs[codePoint];
+        }
 
-        if (bold)
-            TTF_SetFontStyle(font, TTF_STYLE_NORMAL);
+        const auto it = table.otherGlyphs.find(codePoint);
+        if (it != table.otherGlyphs.end())
+            return it->second;
 
-        if (outlineThickness != 0)
-            TTF_SetFontOutline(font, 0);
+        TTF_Font* font = getInternalFont(characterSize);
+        if (!font)
+            return {};
 
-        glyph.advance = static_cast<float>(advance);
-        glyph.bounds.left = static_cast<float>(minX);
-        glyph.bounds.top = static_cast<float>(-maxY);
-        glyph.bounds.width = static_cast<float>(maxX - minX);
-        glyph.bounds.height = static_cast<float>(maxY - minY);
+        const FontGlyph glyph = loadGlyphMetrics(font, codePoint, style, outline);
+        table.otherGlyphs[codePoint] = glyph;
         return glyph;
     }
 
@@ -111,6 +141,13 @@ namespace tgui
 
     float BackendFontSDL::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool bold)
     {
+        GlyphMetricsTable& table = getGlyphMetricsTable(characterSize, bold ? TTF_STYLE_BOLD : TTF_STYLE_NORMAL, 0);
+
+        const std::uint64_t key = (static_cast<std::uint64_t>(first) << 32) | static_cast<std::uint64_t>(second);
+        const auto it = table.kernings.find(key);
+        if (it != table.kernings.end())
+            return it->second;
+
         TTF_Font* font = getInternalFont(characterSize);
         if (!font)
             return 0;
@@ -123,6 +160,7 @@ namespace tgui
         if (bold)
             TTF_SetFontStyle(font, TTF_STYLE_NORMAL);
 
+        table.kernings[key] = static_cast<float>(kerning);
         return static_cast<float>(kerning);
     }
 
@@ -164,10 +202,11 @@ namespace tgui
 
     TTF_Font* BackendFontSDL::loadInternalFont(unsigned int characterSize) const
     {
-        if (!m_fileContents || (m_fileSize == 0))
+        if (!m_fileContents)
             return nullptr;
 
-        SDL_RWops* handle = SDL_RWFromConstMem(m_fileContents.get(), static_cast<int>(m_fileSize));
+        // Every character size opens its own TTF_Font, but they all read from the same shared file contents
+        SDL_RWops* handle = SDL_RWFromConstMem(m_fileContents->getData(), static_cast<int>(m_fileContents->getSize()));
         if (!handle)
             return nullptr;
 
@@ -175,6 +214,301 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontSDL::GlyphMetricsTable& BackendFontSDL::getGlyphMetricsTable(unsigned int characterSize, int style, int outline)
+    {
+        // Style uses 4 bits, outline 12 bits and the character size takes the upper 32 bits (same layout as the atlas keys)
+        const std::uint64_t key = (static_cast<std::uint64_t>(style & 0xF) << 16)
+                                | (static_cast<std::uint64_t>(outline & 0xFFF) << 20)
+                                | (static_cast<std::uint64_t>(characterSize) << 32);
+
+        // Texts usually request many glyphs in a row with the same settings
+        if (m_lastGlyphMetricsTable && (key == m_lastGlyphMetricsKey))
+            return *m_lastGlyphMetricsTable;
+
+        m_lastGlyphMetricsTable = &m_glyphMetrics[key];
+        m_lastGlyphMetricsKey = key;
+        return *m_lastGlyphMetricsTable;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontGlyph BackendFontSDL::loadGlyphMetrics(TTF_Font* font, char32_t codePoint, int style, int outline)
+    {
+        FontGlyph glyph;
+
+        if (style != TTF_STYLE_NORMAL)
+            TTF_SetFontStyle(font, style);
+        if (outline != 0)
+            TTF_SetFontOutline(font, outline);
+
+        int minX;
+        int maxX;
+        int minY;
+        int maxY;
+        int advance;
+        const bool glyphFound = (TTF_GlyphMetrics(font, static_cast<std::uint16_t>(codePoint), &minX, &maxX, &minY, &maxY, &advance) == 0);
+
+        // Restore the font so that we can always assume that a font from the cache has no special style or outline
+        if (style != TTF_STYLE_NORMAL)
+            TTF_SetFontStyle(font, TTF_STYLE_NORMAL);
+        if (outline != 0)
+            TTF_SetFontOutline(font, 0);
+
+        if (!glyphFound)
+            return glyph;
+
+        glyph.advance = static_cast<float>(advance);
+        glyph.bounds.left = static_cast<float>(minX);
+        glyph.bounds.top = static_cast<float>(-maxY);
+        glyph.bounds.width = static_cast<float>(maxX - minX);
+        glyph.bounds.height = static_cast<float>(maxY - minY);
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendFontSDL::AtlasGlyph* BackendFontSDL::getAtlasGlyph(char32_t codePoint, unsigned int characterSize, int style, int outline)
+    {
+        if (codePoint > 0xFFFF)
+            return nullptr; // SDL_ttf only supports characters from the Basic Multilingual Plane
+
+        // Code point uses 16 bits, style 4 bits, outline 12 bits and the character size takes the upper 32 bits
+        const std::uint64_t key = static_cast<std::uint64_t>(codePoint)
+                                | (static_cast<std::uint64_t>(style & 0xF) << 16)
+                                | (static_cast<std::uint64_t>(outline & 0xFFF) << 20)
+                                | (static_cast<std::uint64_t>(characterSize) << 32);
+
+        const auto it = m_atlasGlyphs.find(key);
+        if (it != m_atlasGlyphs.end())
+            return &it->second;
+
+        TTF_Font* font = getInternalFont(characterSize);
+        if (!font)
+            return nullptr;
+
+        m_glyphCacheOutdated = true;
+        return &m_atlasGlyphs.emplace(key, rasterizeAtlasGlyph(codePoint, characterSize, style, outline)).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GLuint BackendFontSDL::getAtlasTexture() const
+    {
+        return m_atlasTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontSDL::getAtlasSize() const
+    {
+        return m_atlasSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSDL::saveGlyphCache(const String& filename) const
+    {
+        if (!m_fileContents)
+            return false;
+
+        GlyphAtlasCache::Contents contents;
+        contents.atlasSize = m_atlasSize;
+        contents.pixels = m_atlasPixels;
+
+        contents.rows.reserve(m_atlasRows.size());
+        for (const auto& row : m_atlasRows)
+            contents.rows.push_back({row.top, row.height, row.width});
+
+        contents.glyphs.reserve(m_atlasGlyphs.size());
+        for (const auto& pair : m_atlasGlyphs)
+            contents.glyphs.push_back({pair.first, pair.second.textureRect, pair.second.offset, pair.second.advance});
+
+        return GlyphAtlasCache::saveToFile(filename, GlyphCacheBackendName, m_fileContents->getHash(), contents);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSDL::loadGlyphCache(const String& filename)
+    {
+        if (!m_fileContents)
+            return false;
+
+        GlyphAtlasCache::Contents contents;
+        if (!GlyphAtlasCache::loadFromFile(filename, GlyphCacheBackendName, m_fileContents->getHash(), contents))
+            return false;
+
+        m_atlasRows.clear();
+        for (const auto& row : contents.rows)
+            m_atlasRows.push_back({row.top, row.height, row.width});
+
+        m_atlasGlyphs.clear();
+        for (const auto& glyph : contents.glyphs)
+            m_atlasGlyphs[glyph.key] = {glyph.textureRect, glyph.offset, glyph.advance};
+
+        // Resizing the atlas to its own size uploads the loaded pixels to the texture
+        m_atlasSize = contents.atlasSize;
+        m_atlasPixels = std::move(contents.pixels);
+        if ((m_atlasSize.x > 0) && (m_atlasSize.y > 0))
+            resizeAtlas(m_atlasSize);
+
+        m_glyphCacheOutdated = false;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontSDL::AtlasGlyph BackendFontSDL::rasterizeAtlasGlyph(char32_t codePoint, unsigned int characterSize, int style, int outline)
+    {
+        AtlasGlyph glyph;
+
+        TTF_Font* font = getInternalFont(characterSize);
+        if (style != TTF_STYLE_NORMAL)
+            TTF_SetFontStyle(font, style);
+        if (outline != 0)
+            TTF_SetFontOutline(font, outline);
+
+        int minX = 0;
+        int advance = 0;
+        SDL_Surface* surface = nullptr;
+        if (TTF_GlyphMetrics(font, static_cast<std::uint16_t>(codePoint), &minX, nullptr, nullptr, nullptr, &advance) == 0)
+            surface = TTF_RenderGlyph_Blended(font, static_cast<std::uint16_t>(codePoint), SDL_Color{255, 255, 255, 255});
+
+        // Restore the font so that we can always assume that a font from the cache has no special style or outline
+        if (style != TTF_STYLE_NORMAL)
+            TTF_SetFontStyle(font, TTF_STYLE_NORMAL);
+        if (outline != 0)
+            TTF_SetFontOutline(font, 0);
+
+        if (!surface)
+            return glyph;
+
+        // The surface is positioned in the same way as when the character would be rendered as a single line of text
+        glyph.advance = static_cast<float>(advance);
+        glyph.offset = {static_cast<float>(std::min(0, minX) - outline), static_cast<float>(-outline)};
+
+        const unsigned int width = static_cast<unsigned int>(surface->w);
+        const unsigned int height = static_cast<unsigned int>(surface->h);
+        Vector2u position;
+        if ((width > 0) && (height > 0) && findAtlasSpace(width, height, position))
+        {
+            // Blended glyphs are rendered as ARGB8888, only the alpha channel is stored in the atlas
+            std::vector<std::uint8_t> alpha(width * height);
+            const auto* pixels = static_cast<const std::uint8_t*>(surface->pixels);
+            for (unsigned int y = 0; y < height; ++y)
+            {
+                const auto* row = reinterpret_cast<const std::uint32_t*>(pixels + y * static_cast<unsigned int>(surface->pitch));
+                for (unsigned int x = 0; x < width; ++x)
+                {
+                    alpha[y * width + x] = static_cast<std::uint8_t>(row[x] >> 24);
+                    m_atlasPixels[(position.y + y) * m_atlasSize.x + position.x + x] = alpha[y * width + x];
+                }
+            }
+
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendSDL>(getBackend()), "BackendFontSDL::rasterizeAtlasGlyph requires backend of type BackendSDL");
+            std::static_pointer_cast<BackendSDL>(getBackend())->changeTexture(m_atlasTexture, true);
+
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+            TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(position.x), static_cast<GLint>(position.y),
+                                          static_cast<GLsizei>(width), static_cast<GLsizei>(height), GL_RED, GL_UNSIGNED_BYTE, alpha.data()));
+            TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+
+            glyph.textureRect = {position.x, position.y, width, height};
+        }
+
+        SDL_FreeSurface(surface);
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSDL::findAtlasSpace(unsigned int width, unsigned int height, Vector2u& position)
+    {
+        if (m_atlasTexture == 0)
+            resizeAtlas({InitialAtlasSize, InitialAtlasSize});
+
+        const unsigned int paddedWidth = width + AtlasGlyphPadding;
+        const unsigned int paddedHeight = height + AtlasGlyphPadding;
+
+        // Find the row that fits the glyph best, rows that are much higher than the glyph would waste too much space
+        AtlasRow* bestRow = nullptr;
+        for (auto& row : m_atlasRows)
+        {
+            if ((row.height < paddedHeight) || (row.height > paddedHeight + paddedHeight / 4) || (row.width + paddedWidth > m_atlasSize.x))
+                continue;
+
+            if (!bestRow || (row.height < bestRow->height))
+                bestRow = &row;
+        }
+
+        // Create a new row if there was no suitable one, enlarging the texture when there is no more space
+        if (!bestRow)
+        {
+            const unsigned int rowTop = m_atlasRows.empty() ? 0 : m_atlasRows.back().top + m_atlasRows.back().height;
+            Vector2u newSize = m_atlasSize;
+            while (newSize.x < paddedWidth)
+                newSize.x *= 2;
+            while (rowTop + paddedHeight > newSize.y)
+                newSize.y *= 2;
+
+            if (newSize != m_atlasSize)
+            {
+                GLint maxTextureSize;
+                TGUI_GL_CHECK(glGetIntegerv(GL_MAX_TEXTURE_SIZE, &maxTextureSize));
+                if ((newSize.x > static_cast<unsigned int>(maxTextureSize)) || (newSize.y > static_cast<unsigned int>(maxTextureSize)))
+                    return false;
+
+                resizeAtlas(newSize);
+            }
+
+            m_atlasRows.push_back({rowTop, paddedHeight, 0});
+            bestRow = &m_atlasRows.back();
+        }
+
+        position = {bestRow->width, bestRow->top};
+        bestRow->width += paddedWidth;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontSDL::resizeAtlas(Vector2u newSize)
+    {
+        std::vector<std::uint8_t> newPixels(newSize.x * newSize.y, 0);
+        for (unsigned int y = 0; y < m_atlasSize.y; ++y)
+            std::memcpy(&newPixels[y * newSize.x], &m_atlasPixels[y * m_atlasSize.x], m_atlasSize.x);
+
+        m_atlasPixels = std::move(newPixels);
+        m_atlasSize = newSize;
+
+        TGUI_ASSERT(std::dynamic_pointer_cast<BackendSDL>(getBackend()), "BackendFontSDL::resizeAtlas requires backend of type BackendSDL");
+        if (m_atlasTexture == 0)
+        {
+            TGUI_GL_CHECK(glGenTextures(1, &m_atlasTexture));
+            std::static_pointer_cast<BackendSDL>(getBackend())->changeTexture(m_atlasTexture, true);
+
+            // The texture only contains the alpha channel, the color channels are always white
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_R, GL_ONE));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_G, GL_ONE));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_B, GL_ONE));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_A, GL_RED));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE));
+        }
+        else
+            std::static_pointer_cast<BackendSDL>(getBackend())->changeTexture(m_atlasTexture, true);
+
+        // The texture keeps the same id, so texts that were already using it don't need to be informed about the change.
+        // Their texture coordinates are in pixels, which remain valid because existing glyphs keep their position.
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 1));
+        TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_R8, static_cast<GLsizei>(m_atlasSize.x), static_cast<GLsizei>(m_atlasSize.y),
+                                   0, GL_RED, GL_UNSIGNED_BYTE, m_atlasPixels.data()));
+        TGUI_GL_CHECK(glPixelStorei(GL_UNPACK_ALIGNMENT, 4));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
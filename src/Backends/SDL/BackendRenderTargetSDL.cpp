@@ -28,20 +28,24 @@
 #include <TGUI/Backends/SDL/BackendTextureSDL.hpp>
 #include <TGUI/Backends/SDL/BackendSDL.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DisplayList.hpp>
 #include <TGUI/OpenGL.hpp>
 
 #include <SDL.h>
 
 #include <algorithm>
-#include <numeric>
 #include <vector>
+#include <cstddef> // offsetof
+#include <cstring> // memcpy
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
-    static const GLsizei NrVertexElements = 8; // position (2) + color (4) + texture coordinate (2)
+    // Initial sizes of the streaming buffers, they grow when a single draw (or batch) doesn't fit
+    static const std::size_t MinStreamBufferVertexCount = 16384;
+    static const std::size_t MinStreamBufferIndexCount = 32768;
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -55,15 +59,25 @@ namespace tgui
             "#version 330 core\n"
 #endif
             "uniform mat4 projectionMatrix;"
+            "uniform sampler2D uTexture;"
             "layout(location=0) in vec2 inPosition;\n"
             "layout(location=1) in vec4 inColor;\n"
             "layout(location=2) in vec2 inTexCoord;\n"
+            "layout(location=3) in vec2 inShapePosition;\n"
+            "layout(location=4) in vec4 inShapeSize;\n"
+            "layout(location=5) in vec4 inBorderColor;\n"
             "out vec4 color;\n"
             "out vec2 texCoord;\n"
+            "out vec2 shapePosition;\n"
+            "out vec4 shapeSize;\n"
+            "out vec4 borderColor;\n"
             "void main() {\n"
             "    gl_Position = projectionMatrix * vec4(inPosition.x, inPosition.y, 0, 1);\n"
             "    color = inColor;\n"
-            "    texCoord = inTexCoord;\n"
+            "    texCoord = inTexCoord / vec2(textureSize(uTexture, 0));\n"
+            "    shapePosition = inShapePosition;\n"
+            "    shapeSize = inShapeSize;\n"
+            "    borderColor = inBorderColor;\n"
             "}"
         };
 
@@ -78,9 +92,25 @@ namespace tgui
             "uniform sampler2D uTexture;"
             "in vec4 color;"
             "in vec2 texCoord;"
+            "in vec2 shapePosition;"
+            "in vec4 shapeSize;"
+            "in vec4 borderColor;"
             "out vec4 outColor;\n"
             "void main() {\n"
-            "    outColor = texture(uTexture, texCoord) * color;\n"
+            // Signed distance to the edge of the rounded rectangle, negative values lie inside the shape.
+            // Derivatives are calculated outside the branch as they are undefined in non-uniform control flow.
+            "    vec2 q = abs(shapePosition) - shapeSize.xy + shapeSize.z;\n"
+            "    float dist = length(max(q, 0.0)) + min(max(q.x, q.y), 0.0) - shapeSize.z;\n"
+            "    float pixelSize = max(fwidth(dist), 0.0001);\n"
+            "    vec4 texColor = texture(uTexture, texCoord);\n"
+            "    if (shapeSize.x > 0.0) {\n"
+            "        float coverage = clamp(0.5 - dist / pixelSize, 0.0, 1.0);\n"
+            "        float fill = (shapeSize.w > 0.0) ? clamp(0.5 - (dist + shapeSize.w) / pixelSize, 0.0, 1.0) : 1.0;\n"
+            "        vec4 shapeColor = mix(borderColor, color, fill);\n"
+            "        outColor = vec4(shapeColor.rgb, shapeColor.a * coverage);\n"
+            "    }\n"
+            "    else\n"
+            "        outColor = texColor * color;\n"
             "}"
         };
 
@@ -134,16 +164,24 @@ namespace tgui
         glEnableVertexAttribArray(0); // inPosition
         glEnableVertexAttribArray(1); // inColor
         glEnableVertexAttribArray(2); // inTexCoord
+        glEnableVertexAttribArray(3); // inShapePosition
+        glEnableVertexAttribArray(4); // inShapeSize
+        glEnableVertexAttribArray(5); // inBorderColor
 
         // Create the vertex buffer
         // Position is stored as x,y in the first 2 floats
-        // Color is stored as r,g,b,a in the next 4 floats
-        // Texture coordinate is stored as u,v in the last 2 floats
+        // Color is stored as r,g,b,a in the next 4 bytes, which are normalized to values between 0 and 1 by OpenGL
+        // Texture coordinate is stored as u,v in the next 2 floats
+        // The remaining attributes are only used for shapes drawn by the fragment shader and are 0 for other vertices
+        using VertexGL = BackendRenderTargetSDL::VertexGL;
         TGUI_GL_CHECK(glGenBuffers(1, &vertexBuffer));
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, vertexBuffer));
-        TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, NrVertexElements * sizeof(GLfloat), reinterpret_cast<GLvoid*>(0)));
-        TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_FLOAT, GL_FALSE, NrVertexElements * sizeof(GLfloat), reinterpret_cast<GLvoid*>(2 * sizeof(GLfloat))));
-        TGUI_GL_CHECK(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, NrVertexElements * sizeof(GLfloat), reinterpret_cast<GLvoid*>(6 * sizeof(GLfloat))));
+        TGUI_GL_CHECK(glVertexAttribPointer(0, 2, GL_FLOAT, GL_FALSE, sizeof(VertexGL), reinterpret_cast<GLvoid*>(offsetof(VertexGL, position))));
+        TGUI_GL_CHECK(glVertexAttribPointer(1, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(VertexGL), reinterpret_cast<GLvoid*>(offsetof(VertexGL, color))));
+        TGUI_GL_CHECK(glVertexAttribPointer(2, 2, GL_FLOAT, GL_FALSE, sizeof(VertexGL), reinterpret_cast<GLvoid*>(offsetof(VertexGL, texCoords))));
+        TGUI_GL_CHECK(glVertexAttribPointer(3, 2, GL_FLOAT, GL_FALSE, sizeof(VertexGL), reinterpret_cast<GLvoid*>(offsetof(VertexGL, shapePosition))));
+        TGUI_GL_CHECK(glVertexAttribPointer(4, 4, GL_FLOAT, GL_FALSE, sizeof(VertexGL), reinterpret_cast<GLvoid*>(offsetof(VertexGL, shapeSize))));
+        TGUI_GL_CHECK(glVertexAttribPointer(5, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(VertexGL), reinterpret_cast<GLvoid*>(offsetof(VertexGL, borderColor))));
 
         // Create the index buffer
         TGUI_GL_CHECK(glGenBuffers(1, &indexBuffer));
@@ -183,6 +221,18 @@ namespace tgui
 
     BackendRenderTargetSDL::~BackendRenderTargetSDL()
     {
+        if (m_retainedFramebuffer)
+        {
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_retainedFramebuffer));
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_retainedTexture));
+        }
+
+        if (m_offscreenFramebuffer)
+        {
+            TGUI_GL_CHECK(glDeleteFramebuffers(1, &m_offscreenFramebuffer));
+            TGUI_GL_CHECK(glDeleteTextures(1, &m_offscreenTexture));
+        }
+
         TGUI_GL_CHECK(glDeleteTextures(1, &m_emptyTexture));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_vertexBuffer));
         TGUI_GL_CHECK(glDeleteBuffers(1, &m_indexBuffer));
@@ -198,6 +248,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetSDL::setBatchingEnabled(bool enabled)
+    {
+        m_batchingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSDL::isBatchingEnabled() const
+    {
+        return m_batchingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::setAnalyticShapesEnabled(bool enabled)
+    {
+        m_analyticShapesEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSDL::isAnalyticShapesEnabled() const
+    {
+        return m_analyticShapesEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTargetSDL::DrawStatistics BackendRenderTargetSDL::getDrawStatistics() const
+    {
+        return m_drawStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSDL::setView(FloatRect view, FloatRect viewport)
     {
         if (!m_window)
@@ -253,17 +338,27 @@ namespace tgui
         TGUI_GL_CHECK(glGetIntegerv(GL_VIEWPORT, oldViewport));
 
         // Change the state that we need while drawing the gui
+        // The scissor rect is normally the viewport, unless drawGuiRegion already added a clipping layer for the damaged region
+        const std::array<int, 4>& rootClipRectGL = m_clippingLayers.empty() ? m_viewportGL : m_clippingLayers.back().second;
         TGUI_GL_CHECK(glViewport(m_viewportGL[0], m_viewportGL[1], m_viewportGL[2], m_viewportGL[3]));
-        TGUI_GL_CHECK(glScissor(m_viewportGL[0], m_viewportGL[1], m_viewportGL[2], m_viewportGL[3]));
+        TGUI_GL_CHECK(glScissor(rootClipRectGL[0], rootClipRectGL[1], rootClipRectGL[2], rootClipRectGL[3]));
         TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
         TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
 
+        // Vertices are transformed on the CPU, so the shader only has to apply the projection
+        TGUI_GL_CHECK(glUniformMatrix4fv(m_projectionMatrixUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix()));
+
         // Don't make any assumptions about the currently set texture
         changeTexture(m_emptyTexture, true);
 
         // Draw the widgets
+        m_drawStatistics = {};
+        m_culledPrimitiveCount = 0;
         root->draw(*this, {});
 
+        if (m_batchingEnabled)
+            flushBatch();
+
         // Restore the old state
         TGUI_GL_CHECK(glBindVertexArray(0));
         TGUI_GL_CHECK(glUseProgram(0));
@@ -285,6 +380,115 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetSDL::drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region)
+    {
+        m_culledPrimitiveCount = 0;
+        if (!m_window)
+            return;
+
+        redrawRegion(root, region, false);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::drawDamagedRegions(const std::shared_ptr<RootContainer>& root, const std::vector<FloatRect>& regions)
+    {
+        m_culledPrimitiveCount = 0;
+        if (!m_window)
+            return;
+
+        GLint oldFramebuffer = 0;
+        TGUI_GL_CHECK(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &oldFramebuffer));
+
+        const GLboolean oldScissorEnabled = glIsEnabled(GL_SCISSOR_TEST);
+        GLint oldClipRect[4];
+        if (oldScissorEnabled)
+            TGUI_GL_CHECK(glGetIntegerv(GL_SCISSOR_BOX, oldClipRect));
+
+        // The back buffer of the window can't be relied on to still contain the previous frame after swapping buffers,
+        // so the gui is kept in a framebuffer of our own, which is recreated (and fully redrawn) when the window resizes.
+        bool fullRedrawRequired = false;
+        if (!m_retainedFramebuffer || (m_retainedFramebufferSize != Vector2i{m_windowWidth, m_windowHeight}))
+        {
+            if (!m_retainedFramebuffer)
+            {
+                TGUI_GL_CHECK(glGenFramebuffers(1, &m_retainedFramebuffer));
+                TGUI_GL_CHECK(glGenTextures(1, &m_retainedTexture));
+            }
+
+            m_retainedFramebufferSize = {m_windowWidth, m_windowHeight};
+            changeTexture(m_retainedTexture, true);
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+            TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_windowWidth, m_windowHeight, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_retainedFramebuffer));
+            TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_retainedTexture, 0));
+            fullRedrawRequired = true;
+        }
+        else
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_retainedFramebuffer));
+
+        TGUI_GL_CHECK(glEnable(GL_SCISSOR_TEST));
+        if (fullRedrawRequired)
+            redrawRegion(root, m_viewRect, true);
+        else
+        {
+            for (const auto& region : regions)
+                redrawRegion(root, region, true);
+        }
+
+        // Copy the gui to the window. The scissor test also applies to blitting, so it has to be disabled first.
+        TGUI_GL_CHECK(glDisable(GL_SCISSOR_TEST));
+        TGUI_GL_CHECK(glBindFramebuffer(GL_DRAW_FRAMEBUFFER, static_cast<GLuint>(oldFramebuffer)));
+        TGUI_GL_CHECK(glBlitFramebuffer(m_viewportGL[0], m_viewportGL[1], m_viewportGL[0] + m_viewportGL[2], m_viewportGL[1] + m_viewportGL[3],
+                                        m_viewportGL[0], m_viewportGL[1], m_viewportGL[0] + m_viewportGL[2], m_viewportGL[1] + m_viewportGL[3],
+                                        GL_COLOR_BUFFER_BIT, GL_NEAREST));
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(oldFramebuffer)));
+
+        if (oldScissorEnabled)
+        {
+            TGUI_GL_CHECK(glEnable(GL_SCISSOR_TEST));
+            TGUI_GL_CHECK(glScissor(oldClipRect[0], oldClipRect[1], oldClipRect[2], oldClipRect[3]));
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::redrawRegion(const std::shared_ptr<RootContainer>& root, FloatRect region, bool clearRegion)
+    {
+        // Round the region to whole pixels
+        const float scaleX = static_cast<float>(m_viewport.width) / m_viewRect.width;
+        const float scaleY = static_cast<float>(m_viewport.height) / m_viewRect.height;
+        const int left = std::max(static_cast<int>(std::round(static_cast<float>(m_viewport.left) + (region.left - m_viewRect.left) * scaleX)), m_viewport.left);
+        const int top = std::max(static_cast<int>(std::round(static_cast<float>(m_viewport.top) + (region.top - m_viewRect.top) * scaleY)), m_viewport.top);
+        const int right = std::min(static_cast<int>(std::round(static_cast<float>(m_viewport.left) + (region.left + region.width - m_viewRect.left) * scaleX)),
+                                   m_viewport.left + m_viewport.width);
+        const int bottom = std::min(static_cast<int>(std::round(static_cast<float>(m_viewport.top) + (region.top + region.height - m_viewRect.top) * scaleY)),
+                                    m_viewport.top + m_viewport.height);
+        if ((left >= right) || (top >= bottom))
+            return;
+
+        const std::array<int, 4> regionGL = {left, m_windowHeight - bottom, right - left, bottom - top};
+        if (clearRegion)
+        {
+            TGUI_GL_CHECK(glScissor(regionGL[0], regionGL[1], regionGL[2], regionGL[3]));
+            TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        }
+
+        // The region acts as the outer clipping layer, so widgets that don't intersect with it aren't drawn at all and
+        // drawGui uses it as scissor rect. The rect used for culling must cover all pixels that are redrawn, so it is
+        // calculated from the rounded pixel rect.
+        const FloatRect clipRect = {m_viewRect.left + static_cast<float>(left - m_viewport.left) / scaleX,
+                                    m_viewRect.top + static_cast<float>(top - m_viewport.top) / scaleY,
+                                    static_cast<float>(right - left) / scaleX, static_cast<float>(bottom - top) / scaleY};
+        m_clippingLayers.push_back({clipRect, regionGL});
+        drawGui(root);
+        m_clippingLayers.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSDL::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
     {
         // If the widget lies outside of the clip rect then we can skip drawing it
@@ -318,16 +522,26 @@ namespace tgui
         const Vector2f bottomRight{states.transform.transformPoint(rect.getPosition() + rect.getSize())};
         const Vector2f topLeft = states.transform.transformPoint(rect.getPosition());
 
-        const int clipLeft = std::max(static_cast<int>(topLeft.x), oldClipRectGL[0]);
-        const int clipRight = std::max(clipLeft, std::min(static_cast<int>(bottomRight.x), oldClipRectGL[0] + oldClipRectGL[2]));
-        const int clipBottom = std::max(static_cast<int>(m_windowHeight - bottomRight.y), oldClipRectGL[1]);
-        const int clipTop = std::max(clipBottom, std::min(static_cast<int>(m_windowHeight - topLeft.y), oldClipRectGL[1] + oldClipRectGL[3]));
+        // Convert the rect from view coordinates to pixels, with the origin of the pixels in the bottom left corner
+        const float scaleX = static_cast<float>(m_viewport.width) / m_viewRect.width;
+        const float scaleY = static_cast<float>(m_viewport.height) / m_viewRect.height;
+        const float pixelLeft = static_cast<float>(m_viewport.left) + (topLeft.x - m_viewRect.left) * scaleX;
+        const float pixelRight = static_cast<float>(m_viewport.left) + (bottomRight.x - m_viewRect.left) * scaleX;
+        const float pixelTop = static_cast<float>(m_windowHeight - m_viewport.top) - (topLeft.y - m_viewRect.top) * scaleY;
+        const float pixelBottom = static_cast<float>(m_windowHeight - m_viewport.top) - (bottomRight.y - m_viewRect.top) * scaleY;
+
+        const int clipLeft = std::max(static_cast<int>(pixelLeft), oldClipRectGL[0]);
+        const int clipRight = std::max(clipLeft, std::min(static_cast<int>(pixelRight), oldClipRectGL[0] + oldClipRectGL[2]));
+        const int clipBottom = std::max(static_cast<int>(pixelBottom), oldClipRectGL[1]);
+        const int clipTop = std::max(clipBottom, std::min(static_cast<int>(pixelTop), oldClipRectGL[1] + oldClipRectGL[3]));
 
         const FloatRect clipRect = {topLeft, bottomRight - topLeft};
         const std::array<int, 4> clipRectGL = {clipLeft, clipBottom, clipRight - clipLeft, clipTop - clipBottom};
         m_clippingLayers.push_back({clipRect, clipRectGL});
 
-        TGUI_GL_CHECK(glScissor(clipRectGL[0], clipRectGL[1], clipRectGL[2], clipRectGL[3]));
+        // When batching, the clipping rectangle is stored with each batch command and only applied when the batch is flushed
+        if (!m_batchingEnabled)
+            TGUI_GL_CHECK(glScissor(clipRectGL[0], clipRectGL[1], clipRectGL[2], clipRectGL[3]));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -337,6 +551,9 @@ namespace tgui
         TGUI_ASSERT(!m_clippingLayers.empty(), "BackendRenderTargetSDL::removeClippingLayer was called when there were no clipping layers");
         m_clippingLayers.pop_back();
 
+        if (m_batchingEnabled)
+            return;
+
         const std::array<int, 4>& clipRectGL = m_clippingLayers.empty() ? m_viewportGL : m_clippingLayers.back().second;
         TGUI_GL_CHECK(glScissor(clipRectGL[0], clipRectGL[1], clipRectGL[2], clipRectGL[3]));
     }
@@ -348,6 +565,11 @@ namespace tgui
         if (!sprite.isSet())
             return;
 
+        // Skip the sprite when it lies entirely outside the clipping area
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getSpriteBounds(sprite), clipRect))
+            return;
+
         RenderStates transformedStates = states;
         if (sprite.getRotation() != 0)
         {
@@ -371,16 +593,14 @@ namespace tgui
         }
         else
         {
-            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSDL>(sprite.getTexture().getData()->backendTexture),
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSDL>(sprite.getTexture().getBackendTexture()),
                         "BackendRenderTargetSDL::drawSprite requires backend texture of type BackendTextureSDL");
-            backendTexture = std::static_pointer_cast<BackendTextureSDL>(sprite.getTexture().getData()->backendTexture);
+            backendTexture = std::static_pointer_cast<BackendTextureSDL>(sprite.getTexture().getBackendTexture());
         }
 
-        changeTexture(backendTexture->getInternalTexture());
-        prepareVerticesAndIndices(sprite);
-        updateTransformation(transformedStates.transform);
-
-        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(sprite.getIndices().size()), GL_UNSIGNED_INT, NULL));
+        const std::vector<Vertex>& vertices = sprite.getVertices();
+        const std::vector<int>& indices = sprite.getIndices();
+        drawVertices(transformedStates.transform, backendTexture->getInternalTexture(), vertices.data(), vertices.size(), indices.data(), indices.size());
 
         if (clippingRequired)
             removeClippingLayer();
@@ -390,103 +610,448 @@ namespace tgui
 
     void BackendRenderTargetSDL::drawText(const RenderStates& states, const Text& text)
     {
+        // Skip the text when it lies entirely outside the clipping area, e.g. lines that were scrolled out of view
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getTextBounds(text), clipRect))
+            return;
+
         RenderStates movedStates = states;
         movedStates.transform.translate(text.getPosition());
-        updateTransformation(movedStates.transform);
 
         TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextSDL>(text.getBackendText()), "BackendRenderTargetSDL::drawText requires backend text of type BackendTextSDL");
 
+        if (BackendTextSDL::isGlyphAtlasEnabled())
+        {
+            // The vertices have to be retrieved before the texture, because new glyphs may still have to be added to the atlas
+            const auto backendText = std::static_pointer_cast<BackendTextSDL>(text.getBackendText());
+            const std::vector<Vertex>& vertices = backendText->getGlyphVertices();
+            const std::vector<int>& indices = backendText->getGlyphIndices();
+            drawVertices(movedStates.transform, backendText->getGlyphAtlasTexture(), vertices.data(), vertices.size(), indices.data(), indices.size());
+            return;
+        }
+
         if (text.getOutlineThickness() != 0)
         {
             const auto& linesOutline = std::static_pointer_cast<BackendTextSDL>(text.getBackendText())->getInternalOutlineTextures();
             for (const auto& line : linesOutline)
-                drawTextLine(line.bounding, line.textureId);
+                drawTextLine(movedStates.transform, line.bounding, line.textureId);
         }
 
         const auto& lines = std::static_pointer_cast<BackendTextSDL>(text.getBackendText())->getInternalTextures();
         for (const auto& line : lines)
-            drawTextLine(line.bounding, line.textureId);
+            drawTextLine(movedStates.transform, line.bounding, line.textureId);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void BackendRenderTargetSDL::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
     {
+        // Skip the triangles when they lie entirely outside the clipping area
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getVertexBounds(vertices, vertexCount), clipRect))
+            return;
+
         if (!indices)
             indexCount = vertexCount;
 
-        changeTexture(m_emptyTexture);
-        prepareVerticesAndIndices(vertices, vertexCount, indices, indexCount);
-        updateTransformation(states.transform);
+        drawVertices(states.transform, m_emptyTexture, vertices, vertexCount, indices, indexCount);
+    }
 
-        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT, NULL));
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::drawCircle(const RenderStates& states, float size, const Color& backgroundColor, float borderThickness, const Color& borderColor)
+    {
+        if (!m_analyticShapesEnabled)
+        {
+            BackendRenderTargetBase::drawCircle(states, size, backgroundColor, borderThickness, borderColor);
+            return;
+        }
+
+        // A circle is a rounded rectangle where the radius is half of the size. A positive border lies outside the circle.
+        if (borderThickness > 0)
+        {
+            const float outerSize = size + 2 * borderThickness;
+            drawAnalyticShape(states.transform, {-borderThickness, -borderThickness}, {outerSize, outerSize}, outerSize / 2.f,
+                              borderThickness, backgroundColor, borderColor);
+        }
+        else
+            drawAnalyticShape(states.transform, {0, 0}, {size, size}, size / 2.f, -borderThickness, backgroundColor, borderColor);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendRenderTargetSDL::prepareVerticesAndIndices(const Sprite& sprite)
+    void BackendRenderTargetSDL::drawRoundedRectangle(const RenderStates& states, const Vector2f& size, const Color& backgroundColor,
+                                                      float radius, const Borders& borders, const Color& borderColor)
     {
-        const std::vector<tgui::Vertex>& vertices = sprite.getVertices();
-        const std::vector<int>& indices = sprite.getIndices();
+        // The shader only supports a single border width, so borders that differ between the sides are drawn with triangles
+        if (!m_analyticShapesEnabled || (borders.getTop() != borders.getLeft()) || (borders.getRight() != borders.getLeft())
+         || (borders.getBottom() != borders.getLeft()))
+        {
+            BackendRenderTargetBase::drawRoundedRectangle(states, size, backgroundColor, radius, borders, borderColor);
+            return;
+        }
 
-        Vector2u textureSize;
-        if (sprite.getTexture().getData()->svgImage)
-            textureSize = sprite.getSvgTexture()->getSize();
+        // Radius can never be larger than half the width or height
+        radius = std::min({radius, size.x / 2.f, size.y / 2.f});
+        drawAnalyticShape(states.transform, {0, 0}, size, radius, borders.getLeft(), backgroundColor, borderColor);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> BackendRenderTargetSDL::drawOffscreen(const DisplayList& displayList, FloatRect region, Vector2u size)
+    {
+        if (!m_window || (size.x == 0) || (size.y == 0))
+            return nullptr;
+
+        // Anything that is still waiting in the batch belongs in the framebuffer that is currently bound
+        if (m_batchingEnabled)
+            flushBatch();
+
+        const GLsizei width = static_cast<GLsizei>(size.x);
+        const GLsizei height = static_cast<GLsizei>(size.y);
+
+        // Get some values from the current state so that we can restore them when we are done drawing
+        GLint oldFramebuffer = 0;
+        TGUI_GL_CHECK(glGetIntegerv(GL_DRAW_FRAMEBUFFER_BINDING, &oldFramebuffer));
+        GLint oldViewport[4];
+        TGUI_GL_CHECK(glGetIntegerv(GL_VIEWPORT, oldViewport));
+        GLint oldClipRect[4];
+        TGUI_GL_CHECK(glGetIntegerv(GL_SCISSOR_BOX, oldClipRect));
+        const GLboolean oldScissorEnabled = glIsEnabled(GL_SCISSOR_TEST);
+        const GLboolean oldBlendEnabled = glIsEnabled(GL_BLEND);
+        GLint oldBlendFunc[4];
+        TGUI_GL_CHECK(glGetIntegerv(GL_BLEND_SRC_RGB, &oldBlendFunc[0]));
+        TGUI_GL_CHECK(glGetIntegerv(GL_BLEND_DST_RGB, &oldBlendFunc[1]));
+        TGUI_GL_CHECK(glGetIntegerv(GL_BLEND_SRC_ALPHA, &oldBlendFunc[2]));
+        TGUI_GL_CHECK(glGetIntegerv(GL_BLEND_DST_ALPHA, &oldBlendFunc[3]));
+        GLfloat oldClearColor[4];
+        TGUI_GL_CHECK(glGetFloatv(GL_COLOR_CLEAR_VALUE, oldClearColor));
+        GLint oldProgram = 0;
+        TGUI_GL_CHECK(glGetIntegerv(GL_CURRENT_PROGRAM, &oldProgram));
+        GLint oldVertexArray = 0;
+        TGUI_GL_CHECK(glGetIntegerv(GL_VERTEX_ARRAY_BINDING, &oldVertexArray));
+
+        // The framebuffer is only recreated when it is too small, smaller images are drawn in its bottom left corner
+        if (!m_offscreenFramebuffer)
+        {
+            TGUI_GL_CHECK(glGenFramebuffers(1, &m_offscreenFramebuffer));
+            TGUI_GL_CHECK(glGenTextures(1, &m_offscreenTexture));
+        }
+
+        if ((m_offscreenFramebufferSize.x < width) || (m_offscreenFramebufferSize.y < height))
+        {
+            m_offscreenFramebufferSize = {std::max(m_offscreenFramebufferSize.x, width), std::max(m_offscreenFramebufferSize.y, height)};
+            changeTexture(m_offscreenTexture, true);
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST));
+            TGUI_GL_CHECK(glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST));
+            TGUI_GL_CHECK(glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA8, m_offscreenFramebufferSize.x, m_offscreenFramebufferSize.y, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr));
+
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer));
+            TGUI_GL_CHECK(glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, m_offscreenTexture, 0));
+        }
         else
-            textureSize = sprite.getTexture().getData()->backendTexture->getSize();
+            TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, m_offscreenFramebuffer));
+
+        // Temporarily replace the view by one that maps the region onto the image
+        const int oldWindowWidth = m_windowWidth;
+        const int oldWindowHeight = m_windowHeight;
+        const FloatRect oldViewRect = m_viewRect;
+        const IntRect oldViewportRect = m_viewport;
+        const std::array<int, 4> oldViewportGL = m_viewportGL;
+        const Transform oldProjectionTransform = m_projectionTransform;
+        std::vector<std::pair<FloatRect, std::array<int, 4>>> oldClippingLayers;
+        oldClippingLayers.swap(m_clippingLayers);
+
+        m_windowWidth = width;
+        m_windowHeight = height;
+        m_viewRect = region;
+        m_viewport = {0, 0, width, height};
+        m_viewportGL = {0, 0, width, height};
+        m_projectionTransform = Transform();
+        m_projectionTransform.translate({-1 - (2.f * (region.left / region.width)), 1 + (2.f * (region.top / region.height))});
+        m_projectionTransform.scale({2.f / region.width, -2.f / region.height});
+
+        // Blending the alpha channel like the color channels would make semi-transparent pixels lose opacity when they are
+        // drawn on top of each other. The colors still get multiplied with their alpha, this is undone after reading them.
+        TGUI_GL_CHECK(glEnable(GL_BLEND));
+        TGUI_GL_CHECK(glBlendFuncSeparate(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA, GL_ONE, GL_ONE_MINUS_SRC_ALPHA));
+        TGUI_GL_CHECK(glEnable(GL_SCISSOR_TEST));
+        TGUI_GL_CHECK(glViewport(0, 0, width, height));
+        TGUI_GL_CHECK(glScissor(0, 0, width, height));
+        TGUI_GL_CHECK(glClearColor(0, 0, 0, 0));
+        TGUI_GL_CHECK(glClear(GL_COLOR_BUFFER_BIT));
+        TGUI_GL_CHECK(glUseProgram(m_shaderProgram));
+        TGUI_GL_CHECK(glBindVertexArray(m_vertexArray));
+        TGUI_GL_CHECK(glUniformMatrix4fv(m_projectionMatrixUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix()));
+
+        displayList.replay(*this);
+        if (m_batchingEnabled)
+            flushBatch();
+
+        // OpenGL returns the bottom row first, so the rows are flipped while copying them
+        std::vector<std::uint8_t> pixelsGL(static_cast<std::size_t>(width) * static_cast<std::size_t>(height) * 4);
+        TGUI_GL_CHECK(glPixelStorei(GL_PACK_ALIGNMENT, 1));
+        TGUI_GL_CHECK(glReadPixels(0, 0, width, height, GL_RGBA, GL_UNSIGNED_BYTE, pixelsGL.data()));
+
+        const std::size_t rowSize = static_cast<std::size_t>(width) * 4;
+        auto pixels = std::make_unique<std::uint8_t[]>(pixelsGL.size());
+        for (std::size_t y = 0; y < size.y; ++y)
+            std::memcpy(&pixels[y * rowSize], &pixelsGL[(size.y - y - 1) * rowSize], rowSize);
 
-        prepareVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(), textureSize);
+        unpremultiplyAlpha(pixels.get(), static_cast<std::size_t>(width) * static_cast<std::size_t>(height));
+
+        // Restore the old state
+        m_windowWidth = oldWindowWidth;
+        m_windowHeight = oldWindowHeight;
+        m_viewRect = oldViewRect;
+        m_viewport = oldViewportRect;
+        m_viewportGL = oldViewportGL;
+        m_projectionTransform = oldProjectionTransform;
+        m_clippingLayers.swap(oldClippingLayers);
+
+        TGUI_GL_CHECK(glUniformMatrix4fv(m_projectionMatrixUniformLocation, 1, GL_FALSE, m_projectionTransform.getMatrix()));
+        TGUI_GL_CHECK(glUseProgram(static_cast<GLuint>(oldProgram)));
+        TGUI_GL_CHECK(glBindVertexArray(static_cast<GLuint>(oldVertexArray)));
+        TGUI_GL_CHECK(glBindFramebuffer(GL_FRAMEBUFFER, static_cast<GLuint>(oldFramebuffer)));
+        TGUI_GL_CHECK(glViewport(oldViewport[0], oldViewport[1], static_cast<GLsizei>(oldViewport[2]), static_cast<GLsizei>(oldViewport[3])));
+        TGUI_GL_CHECK(glScissor(oldClipRect[0], oldClipRect[1], static_cast<GLsizei>(oldClipRect[2]), static_cast<GLsizei>(oldClipRect[3])));
+        TGUI_GL_CHECK(glClearColor(oldClearColor[0], oldClearColor[1], oldClearColor[2], oldClearColor[3]));
+        TGUI_GL_CHECK(glBlendFuncSeparate(static_cast<GLenum>(oldBlendFunc[0]), static_cast<GLenum>(oldBlendFunc[1]),
+                                          static_cast<GLenum>(oldBlendFunc[2]), static_cast<GLenum>(oldBlendFunc[3])));
+        if (!oldScissorEnabled)
+            TGUI_GL_CHECK(glDisable(GL_SCISSOR_TEST));
+        if (!oldBlendEnabled)
+            TGUI_GL_CHECK(glDisable(GL_BLEND));
+
+        return pixels;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendRenderTargetSDL::prepareVerticesAndIndices(const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount, Vector2u textureSize)
+    void BackendRenderTargetSDL::drawVertices(const Transform& transform, GLuint textureId, const Vertex* vertices, std::size_t vertexCount,
+                                              const int* indices, std::size_t indexCount)
     {
-        // Construct the array of vertices
-        std::vector<GLfloat> vertexData;
-        vertexData.reserve(NrVertexElements * vertexCount);
+        if ((vertexCount == 0) || (indexCount == 0))
+            return;
+
+        const std::size_t indexOffset = m_stagingIndices.size();
+        appendToStagingBuffers(transform, vertices, vertexCount, indices, indexCount);
+        drawStagedIndices(textureId, indexOffset, indexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::drawStagedIndices(GLuint textureId, std::size_t indexOffset, std::size_t indexCount)
+    {
+        ++m_drawStatistics.submittedDrawCalls;
+
+        if (m_batchingEnabled)
+        {
+            addToBatch(textureId, indexOffset, indexCount);
+            return;
+        }
+
+        // Without batching, the staging buffers only contain the indices that are being drawn
+        const std::size_t bufferIndexOffset = uploadStagingBuffers();
+
+        changeTexture(textureId);
+        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indexCount), GL_UNSIGNED_INT,
+                                     reinterpret_cast<const GLvoid*>(bufferIndexOffset * sizeof(GLuint))));
+        ++m_drawStatistics.executedDrawCalls;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::addToBatch(GLuint textureId, std::size_t indexOffset, std::size_t indexCount)
+    {
+        // Merge with the previous command when the state didn't change, otherwise a new draw call will be needed
+        const std::array<int, 4>& clipRectGL = m_clippingLayers.empty() ? m_viewportGL : m_clippingLayers.back().second;
+        if (!m_batchCommands.empty() && (m_batchCommands.back().textureId == textureId) && (m_batchCommands.back().clipRectGL == clipRectGL))
+            m_batchCommands.back().indexCount += indexCount;
+        else
+            m_batchCommands.push_back({textureId, clipRectGL, indexOffset, indexCount});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::drawAnalyticShape(const Transform& transform, Vector2f position, Vector2f size, float radius,
+                                                   float borderWidth, const Color& backgroundColor, const Color& borderColor)
+    {
+        if ((size.x <= 0) || (size.y <= 0))
+            return;
+
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(transform, {position, size}, clipRect))
+            return;
+
+        Transform finalTransform = transform;
+        finalTransform.roundPosition(); // Keep edges aligned with shapes that are made from triangles
+
+        // The shape coordinates are relative to the center, so that the shader can mirror them and only handle one corner
+        const Vector2f halfSize = size / 2.f;
+        const std::array<Vector2f, 4> corners = {{{0, 0}, {size.x, 0}, {0, size.y}, {size.x, size.y}}};
+
+        const GLuint firstVertexIndex = static_cast<GLuint>(m_stagingVertices.size());
+        for (const auto& corner : corners)
+        {
+            const Vector2f vertexPos = finalTransform.transformPoint(position + corner);
+            m_stagingVertices.push_back({
+                {vertexPos.x, vertexPos.y},
+                {backgroundColor.getRed(), backgroundColor.getGreen(), backgroundColor.getBlue(), backgroundColor.getAlpha()},
+                {0, 0},
+                {corner.x - halfSize.x, corner.y - halfSize.y},
+                {halfSize.x, halfSize.y, std::max(0.f, radius), std::max(0.f, borderWidth)},
+                {borderColor.getRed(), borderColor.getGreen(), borderColor.getBlue(), borderColor.getAlpha()}
+            });
+        }
+
+        const std::size_t indexOffset = m_stagingIndices.size();
+        for (const GLuint index : {0u, 1u, 2u, 1u, 3u, 2u})
+            m_stagingIndices.push_back(firstVertexIndex + index);
+
+        drawStagedIndices(m_emptyTexture, indexOffset, 6);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::flushBatch()
+    {
+        if (!m_batchCommands.empty())
+        {
+            const std::size_t firstIndexOffset = uploadStagingBuffers();
+
+            const std::array<int, 4> rootClipRectGL = m_clippingLayers.empty() ? m_viewportGL : m_clippingLayers.front().second;
+            std::array<int, 4> currentClipRectGL = rootClipRectGL;
+            for (const auto& command : m_batchCommands)
+            {
+                if (command.clipRectGL != currentClipRectGL)
+                {
+                    currentClipRectGL = command.clipRectGL;
+                    TGUI_GL_CHECK(glScissor(currentClipRectGL[0], currentClipRectGL[1], currentClipRectGL[2], currentClipRectGL[3]));
+                }
+
+                changeTexture(command.textureId);
+                TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(command.indexCount), GL_UNSIGNED_INT,
+                                             reinterpret_cast<const GLvoid*>((firstIndexOffset + command.indexOffset) * sizeof(GLuint))));
+                ++m_drawStatistics.executedDrawCalls;
+            }
+
+            if (currentClipRectGL != rootClipRectGL)
+                TGUI_GL_CHECK(glScissor(rootClipRectGL[0], rootClipRectGL[1], rootClipRectGL[2], rootClipRectGL[3]));
+        }
+
+        m_batchCommands.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSDL::appendToStagingBuffers(const Transform& transform, const Vertex* vertices, std::size_t vertexCount,
+                                                        const int* indices, std::size_t indexCount)
+    {
+        // The vertices are transformed on the CPU so that the shader only needs the projection matrix, which is set once per frame.
+        // Texture coordinates are passed in pixels, the shader normalizes them with the size of the bound texture.
+        Transform finalTransform = transform;
+        finalTransform.roundPosition(); // Avoid blurry texts
+
+        const GLuint firstVertexIndex = static_cast<GLuint>(m_stagingVertices.size());
         for (std::size_t i = 0; i < vertexCount; ++i)
         {
             const auto& vertex = vertices[i];
-            vertexData.push_back(vertex.position.x);
-            vertexData.push_back(vertex.position.y);
-            vertexData.push_back(vertex.color.red / 255.f);
-            vertexData.push_back(vertex.color.green / 255.f);
-            vertexData.push_back(vertex.color.blue / 255.f);
-            vertexData.push_back(vertex.color.alpha / 255.f);
-            vertexData.push_back(vertex.texCoords.x / textureSize.x);
-            vertexData.push_back(vertex.texCoords.y / textureSize.y);
+            const Vector2f position = finalTransform.transformPoint(vertex.position);
+            m_stagingVertices.push_back({
+                {position.x, position.y},
+                {vertex.color.red, vertex.color.green, vertex.color.blue, vertex.color.alpha},
+                {vertex.texCoords.x, vertex.texCoords.y},
+                {0, 0},
+                {0, 0, 0, 0},
+                {0, 0, 0, 0}
+            });
         }
 
-        // Create the array of indices
-        auto indexData = std::make_unique<GLuint[]>(indexCount);
         if (indices)
         {
             for (std::size_t i = 0; i < indexCount; ++i)
-                indexData[i] = static_cast<GLuint>(indices[i]);
+                m_stagingIndices.push_back(firstVertexIndex + static_cast<GLuint>(indices[i]));
+        }
+        else // Generate sequential indices
+        {
+            for (std::size_t i = 0; i < indexCount; ++i)
+                m_stagingIndices.push_back(firstVertexIndex + static_cast<GLuint>(i));
         }
-        else // Generate index buffer with sequential values 0, 1, 2, 3, ...
-            std::iota(&indexData[0], &indexData[0] + indexCount, 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t BackendRenderTargetSDL::uploadStagingBuffers()
+    {
+        const std::size_t vertexCount = m_stagingVertices.size();
+        const std::size_t indexCount = m_stagingIndices.size();
+        m_drawStatistics.vertexCount += vertexCount;
 
-        // Load the data into the vertex buffer
+        // Find free space in the vertex buffer. When the end of the buffer is reached, the buffer is orphaned: the driver gives
+        // us new storage while draw calls that are still using the old storage can finish without us having to wait for them.
         TGUI_GL_CHECK(glBindBuffer(GL_ARRAY_BUFFER, m_vertexBuffer));
-        if (vertexData.size() > m_vertexBufferSize)
+        if (m_vertexBufferOffset + vertexCount > m_vertexBufferSize)
         {
-            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, vertexData.size() * sizeof(GLfloat), vertexData.data(), GL_STREAM_DRAW));
-            m_vertexBufferSize = vertexData.size();
+            if (vertexCount > m_vertexBufferSize)
+                m_vertexBufferSize = std::max({vertexCount, 2 * m_vertexBufferSize, MinStreamBufferVertexCount});
+
+            TGUI_GL_CHECK(glBufferData(GL_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_vertexBufferSize * sizeof(VertexGL)), NULL, GL_STREAM_DRAW));
+            m_vertexBufferOffset = 0;
+        }
+
+        // The range that we write to isn't used by any previous draw call, so there is no need for OpenGL to synchronize
+        const GLbitfield mapFlags = GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT;
+        void* vertexDest = glMapBufferRange(GL_ARRAY_BUFFER, static_cast<GLintptr>(m_vertexBufferOffset * sizeof(VertexGL)),
+                                            static_cast<GLsizeiptr>(vertexCount * sizeof(VertexGL)), mapFlags);
+        if (vertexDest)
+        {
+            std::memcpy(vertexDest, m_stagingVertices.data(), vertexCount * sizeof(VertexGL));
+            TGUI_GL_CHECK(glUnmapBuffer(GL_ARRAY_BUFFER));
         }
         else
-            TGUI_GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, 0, vertexData.size() * sizeof(GLfloat), vertexData.data()));
+            TGUI_GL_CHECK(glBufferSubData(GL_ARRAY_BUFFER, static_cast<GLintptr>(m_vertexBufferOffset * sizeof(VertexGL)),
+                                          static_cast<GLsizeiptr>(vertexCount * sizeof(VertexGL)), m_stagingVertices.data()));
+
+        // The indices in the staging buffer start at 0, they have to be shifted to where the vertices were placed
+        const GLuint baseVertex = static_cast<GLuint>(m_vertexBufferOffset);
+        if (baseVertex != 0)
+        {
+            for (auto& index : m_stagingIndices)
+                index += baseVertex;
+        }
 
-        // Load the data into the index buffer
+        m_vertexBufferOffset += vertexCount;
+
+        // Do the same for the index buffer
         TGUI_GL_CHECK(glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, m_indexBuffer));
-        if (indexCount > m_indexBufferSize)
+        if (m_indexBufferOffset + indexCount > m_indexBufferSize)
         {
-            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, indexCount * sizeof(GLuint), indexData.get(), GL_STREAM_DRAW));
-            m_indexBufferSize = indexCount;
+            if (indexCount > m_indexBufferSize)
+                m_indexBufferSize = std::max({indexCount, 2 * m_indexBufferSize, MinStreamBufferIndexCount});
+
+            TGUI_GL_CHECK(glBufferData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLsizeiptr>(m_indexBufferSize * sizeof(GLuint)), NULL, GL_STREAM_DRAW));
+            m_indexBufferOffset = 0;
+        }
+
+        void* indexDest = glMapBufferRange(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLintptr>(m_indexBufferOffset * sizeof(GLuint)),
+                                           static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), mapFlags);
+        if (indexDest)
+        {
+            std::memcpy(indexDest, m_stagingIndices.data(), indexCount * sizeof(GLuint));
+            TGUI_GL_CHECK(glUnmapBuffer(GL_ELEMENT_ARRAY_BUFFER));
         }
         else
-            TGUI_GL_CHECK(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, 0, indexCount * sizeof(GLuint), indexData.get()));
+            TGUI_GL_CHECK(glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, static_cast<GLintptr>(m_indexBufferOffset * sizeof(GLuint)),
+                                          static_cast<GLsizeiptr>(indexCount * sizeof(GLuint)), m_stagingIndices.data()));
+
+        const std::size_t indexOffset = m_indexBufferOffset;
+        m_indexBufferOffset += indexCount;
+
+        // Clearing the vectors keeps their capacity, so no memory has to be allocated for the next draw
+        m_stagingVertices.clear();
+        m_stagingIndices.clear();
+        return indexOffset;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -499,18 +1064,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void BackendRenderTargetSDL::updateTransformation(const Transform& transform)
-    {
-        Transform finalTransform = transform;
-        finalTransform.roundPosition(); // Avoid blurry texts
-        finalTransform = m_projectionTransform * finalTransform;
-
-        glUniformMatrix4fv(m_projectionMatrixUniformLocation, 1, GL_FALSE, finalTransform.getMatrix());
-    }
-
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
-
-    void BackendRenderTargetSDL::drawTextLine(const SDL_Rect& bounding, GLuint textureId)
+    void BackendRenderTargetSDL::drawTextLine(const Transform& transform, const SDL_Rect& bounding, GLuint textureId)
     {
         const std::array<Vertex, 4> vertices = {{
             {
@@ -539,11 +1093,7 @@ namespace tgui
             1, 2, 3
         }};
 
-        changeTexture(textureId);
-        prepareVerticesAndIndices(vertices.data(), vertices.size(), indices.data(), indices.size(),
-                                  {static_cast<unsigned int>(bounding.w), static_cast<unsigned int>(bounding.h)});
-
-        TGUI_GL_CHECK(glDrawElements(GL_TRIANGLES, static_cast<GLsizei>(indices.size()), GL_UNSIGNED_INT, NULL));
+        drawVertices(transform, textureId, vertices.data(), vertices.size(), indices.data(), indices.size());
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -35,6 +35,10 @@
 
 namespace tgui
 {
+    bool BackendTextSDL::m_glyphAtlasEnabled = false;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     BackendTextSDL::BackendTextSDL()
     {
         // There must always be a single line of text, even when the text is empty
@@ -58,7 +62,12 @@ namespace tgui
 
     Vector2f BackendTextSDL::getSize()
     {
-        if (!m_texturesValid)
+        if (m_glyphAtlasEnabled)
+        {
+            if (!m_glyphVerticesValid && !updateGlyphVertices())
+                return {0, 0};
+        }
+        else if (!m_texturesValid)
         {
             if (!updateTextures())
                 return {0, 0};
@@ -73,6 +82,7 @@ namespace tgui
     {
         m_lines = string.split(U'\n');
         m_texturesValid = false;
+        m_glyphVerticesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -90,6 +100,7 @@ namespace tgui
 
         m_characterSize = characterSize;
         m_texturesValid = false;
+        m_glyphVerticesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -101,6 +112,7 @@ namespace tgui
         m_textColor.b = color.getBlue();
         m_textColor.a = color.getAlpha();
         m_texturesValid = false;
+        m_glyphVerticesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -112,6 +124,7 @@ namespace tgui
         m_outlineColor.b = color.getBlue();
         m_outlineColor.a = color.getAlpha();
         m_texturesValid = false;
+        m_glyphVerticesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,6 +133,7 @@ namespace tgui
     {
         m_fontOutline = static_cast<int>(thickness);
         m_texturesValid = false;
+        m_glyphVerticesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -128,6 +142,7 @@ namespace tgui
     {
         m_fontStyle = static_cast<int>(static_cast<unsigned int>(style));
         m_texturesValid = false;
+        m_glyphVerticesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -144,6 +159,7 @@ namespace tgui
         // Register the text to the new font
         FontCacheSDL::registerFontSize(m_font.get(), m_characterSize);
         m_texturesValid = false;
+        m_glyphVerticesValid = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -203,6 +219,50 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendTextSDL::setGlyphAtlasEnabled(bool enabled)
+    {
+        m_glyphAtlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextSDL::isGlyphAtlasEnabled()
+    {
+        return m_glyphAtlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vertex>& BackendTextSDL::getGlyphVertices()
+    {
+        if (!m_glyphVerticesValid)
+            updateGlyphVertices();
+
+        return m_glyphVertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<int>& BackendTextSDL::getGlyphIndices()
+    {
+        if (!m_glyphVerticesValid)
+            updateGlyphVertices();
+
+        return m_glyphIndices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GLuint BackendTextSDL::getGlyphAtlasTexture() const
+    {
+        if (!m_font)
+            return 0;
+
+        return m_font->getAtlasTexture();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool BackendTextSDL::updateTextures()
     {
         if (!m_font)
@@ -315,6 +375,103 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextSDL::updateGlyphVertices()
+    {
+        if (!m_font || !m_font->getInternalFont(m_characterSize))
+            return false;
+
+        const float lineSpacing = m_font->getLineSpacing(m_characterSize);
+
+        // Clearing the vectors keeps their capacity, so changing the text usually doesn't need new allocations
+        m_glyphVertices.clear();
+        m_glyphIndices.clear();
+
+        m_size.x = 0;
+        m_size.y = m_lines.size() * lineSpacing;
+
+        // The outline is added first so that the filled glyphs are drawn on top of it
+        if (m_fontOutline != 0)
+            addGlyphQuads(lineSpacing, m_outlineColor, m_fontOutline);
+
+        addGlyphQuads(lineSpacing, m_textColor, 0);
+
+        m_glyphVerticesValid = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSDL::addGlyphQuads(float lineSpacing, const SDL_Color& color, int outline)
+    {
+        const bool bold = ((m_fontStyle & TTF_STYLE_BOLD) == TTF_STYLE_BOLD);
+        const Vertex::Color vertexColor{color.r, color.g, color.b, color.a};
+
+        for (std::size_t lineNr = 0; lineNr < m_lines.size(); ++lineNr)
+        {
+            const float lineTop = static_cast<float>(static_cast<int>(lineNr * lineSpacing));
+
+            float x = 0;
+            char32_t prevChar = U'\0';
+            for (const char32_t currentChar : m_lines[lineNr])
+            {
+                if (currentChar == U'\r')
+                    continue; // We shouldn't render a square if the line contains a '\r'
+
+                // The pen position is always based on the filled glyphs, the outline is placed around them
+                const BackendFontSDL::AtlasGlyph* glyph = m_font->getAtlasGlyph(currentChar, m_characterSize, m_fontStyle, 0);
+                if (!glyph)
+                    continue;
+
+                if (prevChar != U'\0')
+                    x += m_font->getKerning(prevChar, currentChar, m_characterSize, bold);
+                prevChar = currentChar;
+
+                const float advance = glyph->advance;
+                if (outline != 0)
+                {
+                    glyph = m_font->getAtlasGlyph(currentChar, m_characterSize, m_fontStyle, outline);
+                    if (!glyph)
+                    {
+                        x += advance;
+                        continue;
+                    }
+                }
+
+                const UIntRect& rect = glyph->textureRect;
+                if ((rect.width > 0) && (rect.height > 0))
+                {
+                    const float left = x + glyph->offset.x;
+                    const float top = lineTop + glyph->offset.y;
+                    const float right = left + rect.width;
+                    const float bottom = top + rect.height;
+                    const float texLeft = static_cast<float>(rect.left);
+                    const float texTop = static_cast<float>(rect.top);
+                    const float texRight = static_cast<float>(rect.left + rect.width);
+                    const float texBottom = static_cast<float>(rect.top + rect.height);
+
+                    const int firstIndex = static_cast<int>(m_glyphVertices.size());
+                    m_glyphVertices.push_back({{left, top}, vertexColor, {texLeft, texTop}});
+                    m_glyphVertices.push_back({{right, top}, vertexColor, {texRight, texTop}});
+                    m_glyphVertices.push_back({{left, bottom}, vertexColor, {texLeft, texBottom}});
+                    m_glyphVertices.push_back({{right, bottom}, vertexColor, {texRight, texBottom}});
+
+                    m_glyphIndices.push_back(firstIndex);
+                    m_glyphIndices.push_back(firstIndex + 2);
+                    m_glyphIndices.push_back(firstIndex + 1);
+                    m_glyphIndices.push_back(firstIndex + 1);
+                    m_glyphIndices.push_back(firstIndex + 2);
+                    m_glyphIndices.push_back(firstIndex + 3);
+
+                    m_size.x = std::max(m_size.x, right + outline);
+                }
+
+                x += advance;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
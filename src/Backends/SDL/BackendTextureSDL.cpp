@@ -47,7 +47,7 @@ namespace tgui
 
     bool BackendTextureSDL::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels)
     {
-        TGUI_ASSERT(pixels.get() && (size.x > 0) && (size.y > 0), "BackendTextureSDL::loadFromPixelDataImpl needs valid parameters");
+        TGUI_ASSERT((size.x > 0) && (size.y > 0), "BackendTextureSDL::load needs a valid size");
 
         releaseResources(); // Delete existing texture if one was previously loaded
 
@@ -67,6 +67,19 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BackendTextureSDL::update(Vector2u position, Vector2u size, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT(m_textureId && pixels, "BackendTextureSDL::update needs a loaded texture and valid pixels");
+
+        std::static_pointer_cast<BackendSDL>(getBackend())->changeTexture(m_textureId, true);
+        TGUI_GL_CHECK(glTexSubImage2D(GL_TEXTURE_2D, 0, static_cast<GLint>(position.x), static_cast<GLint>(position.y),
+                                      static_cast<GLsizei>(size.x), static_cast<GLsizei>(size.y), GL_RGBA, GL_UNSIGNED_BYTE, pixels));
+
+        return BackendTextureBase::update(position, size, pixels);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u BackendTextureSDL::getSize() const
     {
         return m_imageSize;
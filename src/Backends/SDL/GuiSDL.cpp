@@ -26,6 +26,7 @@
 #include <TGUI/Backend.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/OpenGL.hpp>
 
 #include <TGUI/Backends/SDL/BackendSDL.hpp>
@@ -64,8 +65,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<BackendRenderTargetSDL> GuiSDL::getRenderTarget() const
+    {
+        return m_renderTarget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool GuiSDL::handleEvent(const SDL_Event& sdlEvent)
     {
+        // The window has to be redrawn when it was uncovered or restored, even when none of the widgets changed
+        if ((sdlEvent.type == SDL_WINDOWEVENT)
+         && ((sdlEvent.window.event == SDL_WINDOWEVENT_EXPOSED) || (sdlEvent.window.event == SDL_WINDOWEVENT_RESTORED)))
+            invalidate();
+
         Event event;
         if (!BackendSDL::convertEvent(sdlEvent, event))
             return false; // We don't process this type of event
@@ -106,7 +119,15 @@ namespace tgui
             updateTime();
 
         TGUI_ASSERT(m_renderTarget != nullptr, "GuiSDL must be given an SDL_Window (either at construction or via setWindow function) before calling draw()");
-        m_renderTarget->drawGui(m_container);
+
+        // Images only age when everything is redrawn, widgets outside of the damaged regions still show their images
+        if (!m_damageTrackingEnabled || m_fullRedrawRequired)
+            TextureManager::startFrame();
+
+        if (m_damageTrackingEnabled)
+            m_renderTarget->drawDamagedRegions(m_container, takeDamagedRegions());
+        else
+            m_renderTarget->drawGui(m_container);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,7 +169,9 @@ namespace tgui
                         quit = true;
                         eventProcessed = true;
                     }
-                    else if ((event.type == SDL_WINDOWEVENT) && (event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED))
+                    else if ((event.type == SDL_WINDOWEVENT)
+                          && ((event.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) || (event.window.event == SDL_WINDOWEVENT_EXPOSED)
+                           || (event.window.event == SDL_WINDOWEVENT_RESTORED)))
                     {
                         eventProcessed = true;
                     }
@@ -179,6 +202,14 @@ namespace tgui
                 continue;
             }
 
+            // When damage tracking is enabled, frames in which none of the widgets changed aren't drawn at all and the window
+            // keeps showing the previous frame. Otherwise draw() only redraws the damaged regions and copies the gui to the window.
+            if (m_damageTrackingEnabled && getDamagedRegions().empty())
+            {
+                refreshRequired = false;
+                continue;
+            }
+
             glClear(GL_COLOR_BUFFER_BIT);
             draw();
             SDL_GL_SwapWindow(window);
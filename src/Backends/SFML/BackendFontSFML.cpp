@@ -35,14 +35,14 @@ namespace tgui
 
     bool BackendFontSFML::loadFromFile(const String& filename)
     {
-        return m_font.loadFromFile(filename.toStdString());
+        return loadFileContents(FontFileCache::loadFromFile(filename));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool BackendFontSFML::loadFromMemory(const void* data, std::size_t sizeInBytes)
     {
-        return m_font.loadFromMemory(data, sizeInBytes);
+        return loadFileContents(FontFileCache::loadFromMemory(data, sizeInBytes));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -84,6 +84,19 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSFML::loadFileContents(std::shared_ptr<const FontFileCache::FileContents> fileContents)
+    {
+        // SFML reads from the memory for as long as the font exists, so the contents are only released after the new
+        // font has replaced the old one.
+        if (!fileContents || !m_font.loadFromMemory(fileContents->getData(), fileContents->getSize()))
+            return false;
+
+        m_fileContents = std::move(fileContents);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
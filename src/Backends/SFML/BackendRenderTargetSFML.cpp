@@ -27,8 +27,14 @@
 #include <TGUI/Backends/SFML/BackendTextSFML.hpp>
 #include <TGUI/Backends/SFML/BackendTextureSFML.hpp>
 #include <TGUI/Container.hpp>
+#include <TGUI/DisplayList.hpp>
 #include <SFML/Graphics/CircleShape.hpp>
+#include <SFML/Graphics/RectangleShape.hpp>
 #include <SFML/Graphics/RenderTarget.hpp>
+#include <SFML/Graphics/RenderTexture.hpp>
+#include <SFML/Graphics/Sprite.hpp>
+#include <algorithm>
+#include <cstring> // memcpy
 #include <cmath>
 #include <array>
 
@@ -75,6 +81,7 @@ namespace tgui
         m_target->setView(m_view);
 
         // Draw the widgets
+        m_culledPrimitiveCount = 0;
         root->draw(*this, {});
 
         // Restore the old view
@@ -83,6 +90,66 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void BackendRenderTargetSFML::drawDamagedRegions(const std::shared_ptr<RootContainer>& root, const std::vector<FloatRect>& regions)
+    {
+        if (!m_target)
+            return;
+
+        // The window doesn't keep the previous frame after displaying it, so the gui is kept in a render texture of our own,
+        // which is recreated (and fully redrawn) when the target resizes.
+        bool fullRedrawRequired = false;
+        if (!m_retainedTarget || (m_retainedTarget->getSize() != m_target->getSize()))
+        {
+            auto renderTexture = std::make_shared<sf::RenderTexture>();
+            if (!renderTexture->create(m_target->getSize().x, m_target->getSize().y))
+            {
+                drawGui(root);
+                return;
+            }
+
+            m_retainedTarget = std::move(renderTexture);
+            m_retainedTarget->clear(sf::Color::Transparent);
+            fullRedrawRequired = true;
+        }
+
+        // Temporarily make the render texture the target, the view is the same as both have the same size
+        sf::RenderTarget* const oldTarget = m_target;
+        m_target = m_retainedTarget.get();
+
+        m_culledPrimitiveCount = 0;
+        const std::vector<FloatRect> redrawnRegions = fullRedrawRequired ? std::vector<FloatRect>{m_viewRect} : regions;
+        for (const auto& region : redrawnRegions)
+        {
+            // Clear the pixels of the region. The regions line up with pixels, so the same pixels are covered by the clipping layer.
+            const sf::Vector2i topLeft = m_retainedTarget->mapCoordsToPixel({region.left, region.top}, m_view);
+            const sf::Vector2i bottomRight = m_retainedTarget->mapCoordsToPixel({region.left + region.width, region.top + region.height}, m_view);
+            sf::RectangleShape clearedRect{{static_cast<float>(bottomRight.x - topLeft.x), static_cast<float>(bottomRight.y - topLeft.y)}};
+            clearedRect.setPosition(static_cast<float>(topLeft.x), static_cast<float>(topLeft.y));
+            clearedRect.setFillColor(sf::Color::Transparent);
+            m_retainedTarget->setView(m_retainedTarget->getDefaultView());
+            m_retainedTarget->draw(clearedRect, sf::RenderStates{sf::BlendNone});
+
+            // The region acts as the outer clipping layer, so widgets that don't intersect with it aren't drawn at all
+            m_retainedTarget->setView(m_view);
+            addClippingLayer({}, region);
+            root->draw(*this, {});
+            removeClippingLayer();
+        }
+
+        m_retainedTarget->display();
+        m_target = oldTarget;
+
+        // The colors in the render texture are already multiplied with their alpha, because they were drawn on a transparent
+        // background, so the render texture is drawn with a blend mode that doesn't multiply them again.
+        const sf::View oldView = m_target->getView();
+        m_target->setView(m_target->getDefaultView());
+        m_target->draw(sf::Sprite{m_retainedTarget->getTexture()},
+                       sf::RenderStates{sf::BlendMode{sf::BlendMode::One, sf::BlendMode::OneMinusSrcAlpha}});
+        m_target->setView(oldView);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void BackendRenderTargetSFML::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
     {
         // If the widget lies outside of the clip rect then we can skip drawing it
@@ -191,6 +258,11 @@ namespace tgui
         if (!sprite.isSet())
             return;
 
+        // Skip the sprite when it lies entirely outside the clipping area
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getSpriteBounds(sprite), clipRect))
+            return;
+
         RenderStates transformedStates = states;
         if (sprite.getRotation() != 0)
         {
@@ -214,8 +286,8 @@ namespace tgui
         }
         else
         {
-            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSFML>(sprite.getTexture().getData()->backendTexture), "BackendRenderTargetSFML::drawSprite requires backend texture of type BackendTextureSFML");
-            sfStates.texture = &std::static_pointer_cast<BackendTextureSFML>(sprite.getTexture().getData()->backendTexture)->getInternalTexture();
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSFML>(sprite.getTexture().getBackendTexture()), "BackendRenderTargetSFML::drawSprite requires backend texture of type BackendTextureSFML");
+            sfStates.texture = &std::static_pointer_cast<BackendTextureSFML>(sprite.getTexture().getBackendTexture())->getInternalTexture();
             sfStates.shader = sprite.getTexture().getShader();
         }
 
@@ -237,6 +309,11 @@ namespace tgui
 
     void BackendRenderTargetSFML::drawText(const RenderStates& states, const Text& text)
     {
+        // Skip the text when it lies entirely outside the clipping area, e.g. lines that were scrolled out of view
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getTextBounds(text), clipRect))
+            return;
+
         RenderStates movedStates = states;
         movedStates.transform.translate(text.getPosition());
 
@@ -257,6 +334,11 @@ namespace tgui
 
     void BackendRenderTargetSFML::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
     {
+        // Skip the triangles when they lie entirely outside the clipping area
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getVertexBounds(vertices, vertexCount), clipRect))
+            return;
+
         static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
 
         if (indices)
@@ -277,6 +359,58 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::unique_ptr<std::uint8_t[]> BackendRenderTargetSFML::drawOffscreen(const DisplayList& displayList, FloatRect region, Vector2u size)
+    {
+        if (!m_target || (size.x == 0) || (size.y == 0))
+            return nullptr;
+
+        // The render texture is only recreated when it is too small, smaller images are drawn in its top left corner
+        if (!m_offscreenTarget || (m_offscreenTarget->getSize().x < size.x) || (m_offscreenTarget->getSize().y < size.y))
+        {
+            const unsigned int textureWidth = std::max(size.x, m_offscreenTarget ? m_offscreenTarget->getSize().x : 0u);
+            const unsigned int textureHeight = std::max(size.y, m_offscreenTarget ? m_offscreenTarget->getSize().y : 0u);
+
+            auto renderTexture = std::make_shared<sf::RenderTexture>();
+            if (!renderTexture->create(textureWidth, textureHeight))
+                return nullptr;
+
+            m_offscreenTarget = std::move(renderTexture);
+        }
+
+        // Temporarily make the render texture the target, with a view that maps the region onto the image
+        sf::RenderTarget* const oldTarget = m_target;
+        const sf::View oldView = m_view;
+        const FloatRect oldViewRect = m_viewRect;
+        std::vector<std::pair<FloatRect, sf::View>> oldClippingLayers;
+        oldClippingLayers.swap(m_clippingLayers);
+
+        m_target = m_offscreenTarget.get();
+        setView(region, {0, 0, static_cast<float>(size.x), static_cast<float>(size.y)});
+
+        // The colors end up being multiplied with their alpha when drawing on a transparent background, which is undone below
+        m_offscreenTarget->setView(m_view);
+        m_offscreenTarget->clear(sf::Color::Transparent);
+        displayList.replay(*this);
+        m_offscreenTarget->display();
+
+        m_target = oldTarget;
+        m_view = oldView;
+        m_viewRect = oldViewRect;
+        m_clippingLayers.swap(oldClippingLayers);
+
+        const sf::Image image = m_offscreenTarget->getTexture().copyToImage();
+        const std::size_t rowSize = static_cast<std::size_t>(size.x) * 4;
+        const std::size_t imageRowSize = static_cast<std::size_t>(image.getSize().x) * 4;
+        auto pixels = std::make_unique<std::uint8_t[]>(rowSize * size.y);
+        for (std::size_t y = 0; y < size.y; ++y)
+            std::memcpy(&pixels[y * rowSize], &image.getPixelsPtr()[y * imageRowSize], rowSize);
+
+        unpremultiplyAlpha(pixels.get(), static_cast<std::size_t>(size.x) * size.y);
+        return pixels;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     sf::RenderStates BackendRenderTargetSFML::convertRenderStates(const RenderStates& states)
     {
         const float *transformMatrix = states.transform.getMatrix();
@@ -39,6 +39,14 @@ namespace tgui
                 return false;
         }
 
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSFML::update(Vector2u position, Vector2u size, const std::uint8_t* pixels)
+    {
+        m_texture.update(pixels, size.x, size.y, position.x, position.y);
+        return BackendTextureBase::update(position, size, pixels);
+    }
+
         m_texture.update(pixels.get());
 
         return BackendTextureBase::load(size, std::move(pixels));
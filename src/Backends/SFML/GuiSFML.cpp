@@ -26,6 +26,7 @@
 #include <TGUI/Backend.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <thread>
 
 #include <TGUI/Backends/SFML/BackendSFML.hpp>
@@ -77,6 +78,11 @@ namespace tgui
 
     bool GuiSFML::handleEvent(sf::Event sfmlEvent)
     {
+        // SFML doesn't tell when the window was uncovered, but it was likely brought to the front when it gains focus.
+        // The window is then redrawn even when none of the widgets changed.
+        if (sfmlEvent.type == sf::Event::GainedFocus)
+            invalidate();
+
         Event event;
         if (!BackendSFML::convertEvent(sfmlEvent, event))
             return false; // We don't process this type of event
@@ -163,6 +169,14 @@ namespace tgui
                 continue;
             }
 
+            // When damage tracking is enabled, frames in which none of the widgets changed aren't drawn at all and the window
+            // keeps showing the previous frame. Otherwise draw() only redraws the damaged regions and draws the gui on the window.
+            if (m_damageTrackingEnabled && getDamagedRegions().empty())
+            {
+                refreshRequired = false;
+                continue;
+            }
+
             window->clear({240, 240, 240});
             draw();
             window->display();
@@ -180,7 +194,15 @@ namespace tgui
             updateTime();
 
         TGUI_ASSERT(m_renderTarget != nullptr, "GuiSFML must be given an sf::RenderTarget (either at construction or via setTarget function) before calling draw()");
-        m_renderTarget->drawGui(m_container);
+
+        // Images only age when everything is redrawn, widgets outside of the damaged regions still show their images
+        if (!m_damageTrackingEnabled || m_fullRedrawRequired)
+            TextureManager::startFrame();
+
+        if (m_damageTrackingEnabled)
+            m_renderTarget->drawDamagedRegions(m_container, takeDamagedRegions());
+        else
+            m_renderTarget->drawGui(m_container);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
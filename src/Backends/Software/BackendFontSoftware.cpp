@@ -0,0 +1,476 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backends/Software/BackendFontSoftware.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/GlyphAtlasCache.hpp>
+#include <TGUI/Global.hpp>
+
+#include <ft2build.h>
+#include FT_FREETYPE_H
+#include FT_GLYPH_H
+#include FT_OUTLINE_H
+#include FT_STROKER_H
+
+#include <algorithm>
+#include <cstring> // memcpy
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    static const unsigned int InitialAtlasSize = 256;
+    static const unsigned int AtlasGlyphPadding = 1; // Empty pixels between glyphs to prevent bleeding when interpolating
+    static const char* const GlyphCacheBackendName = "software"; // Keys of the atlas glyphs are specific to this backend
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontSoftware::BackendFontSoftware()
+    {
+        FT_Library library;
+        if (FT_Init_FreeType(&library) != 0)
+            throw Exception{"BackendFontSoftware failed to initialize FreeType"};
+
+        m_library = library;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontSoftware::~BackendFontSoftware()
+    {
+        cleanup();
+        FT_Done_FreeType(m_library);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSoftware::loadFromFile(const String& filename)
+    {
+        return loadFileContents(FontFileCache::loadFromFile(filename));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSoftware::loadFromMemory(const void* data, std::size_t sizeInBytes)
+    {
+        return loadFileContents(FontFileCache::loadFromMemory(data, sizeInBytes));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSoftware::loadFileContents(std::shared_ptr<const FontFileCache::FileContents> fileContents)
+    {
+        cleanup();
+        if (!fileContents)
+            return false;
+
+        m_fileContents = std::move(fileContents);
+
+        FT_Face face;
+        if (FT_New_Memory_Face(m_library, m_fileContents->getData(), static_cast<FT_Long>(m_fileContents->getSize()), 0, &face) != 0)
+        {
+            m_fileContents = nullptr;
+            return false;
+        }
+
+        if (FT_Select_Charmap(face, FT_ENCODING_UNICODE) != 0)
+        {
+            FT_Done_Face(face);
+            m_fileContents = nullptr;
+            return false;
+        }
+
+        m_face = face;
+
+        if (!GlyphAtlasCache::getDirectory().empty())
+        {
+            m_glyphCacheFilename = GlyphAtlasCache::getFilename(GlyphCacheBackendName, m_fileContents->getHash());
+            loadGlyphCache(m_glyphCacheFilename);
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontGlyph BackendFontSoftware::getGlyph(char32_t codePoint, unsigned int characterSize, bool bold, float outlineThickness)
+    {
+        FontGlyph glyph;
+        const AtlasGlyph* atlasGlyph = getAtlasGlyph(codePoint, characterSize, bold, false, static_cast<unsigned int>(std::max(0.f, outlineThickness)));
+        if (!atlasGlyph)
+            return glyph;
+
+        glyph.advance = atlasGlyph->advance;
+        glyph.bounds = {atlasGlyph->offset.x, atlasGlyph->offset.y - getAscent(characterSize),
+                        static_cast<float>(atlasGlyph->textureRect.width), static_cast<float>(atlasGlyph->textureRect.height)};
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontSoftware::getKerning(char32_t first, char32_t second, unsigned int characterSize, bool)
+    {
+        if ((first == 0) || (second == 0) || !setCurrentSize(characterSize) || !FT_HAS_KERNING(m_face))
+            return 0;
+
+        const FT_UInt index1 = FT_Get_Char_Index(m_face, first);
+        const FT_UInt index2 = FT_Get_Char_Index(m_face, second);
+
+        FT_Vector kerning;
+        if (FT_Get_Kerning(m_face, index1, index2, FT_KERNING_DEFAULT, &kerning) != 0)
+            return 0;
+
+        return static_cast<float>(kerning.x) / 64.f;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontSoftware::getLineSpacing(unsigned int characterSize)
+    {
+        if (!setCurrentSize(characterSize))
+            return 0;
+
+        return static_cast<float>(m_face->size->metrics.height) / 64.f;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontSoftware::getAscent(unsigned int characterSize)
+    {
+        if (!setCurrentSize(characterSize))
+            return 0;
+
+        return static_cast<float>(m_face->size->metrics.ascender) / 64.f;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontSoftware::getUnderlinePosition(unsigned int characterSize)
+    {
+        if (!setCurrentSize(characterSize))
+            return 0;
+
+        // Bitmap fonts have no underline information, so we use a fraction of the character size instead
+        if (!FT_IS_SCALABLE(m_face))
+            return characterSize / 10.f;
+
+        return -static_cast<float>(FT_MulFix(m_face->underline_position, m_face->size->metrics.y_scale)) / 64.f;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendFontSoftware::getUnderlineThickness(unsigned int characterSize)
+    {
+        if (!setCurrentSize(characterSize))
+            return 0;
+
+        if (!FT_IS_SCALABLE(m_face))
+            return characterSize / 14.f;
+
+        return static_cast<float>(FT_MulFix(m_face->underline_thickness, m_face->size->metrics.y_scale)) / 64.f;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const BackendFontSoftware::AtlasGlyph* BackendFontSoftware::getAtlasGlyph(char32_t codePoint, unsigned int characterSize,
+                                                                              bool bold, bool italic, unsigned int outline)
+    {
+        // Code point uses 21 bits, style 2 bits, outline 9 bits and the character size takes the upper 32 bits
+        const std::uint64_t key = static_cast<std::uint64_t>(codePoint & 0x1FFFFF)
+                                | (static_cast<std::uint64_t>(bold ? 1 : 0) << 21)
+                                | (static_cast<std::uint64_t>(italic ? 1 : 0) << 22)
+                                | (static_cast<std::uint64_t>(outline & 0x1FF) << 23)
+                                | (static_cast<std::uint64_t>(characterSize) << 32);
+
+        const auto it = m_atlasGlyphs.find(key);
+        if (it != m_atlasGlyphs.end())
+            return &it->second;
+
+        if (!setCurrentSize(characterSize))
+            return nullptr;
+
+        m_glyphCacheOutdated = true;
+        return &m_atlasGlyphs.emplace(key, rasterizeAtlasGlyph(codePoint, bold, italic, outline)).first->second;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendFontSoftware::getAtlasPixels() const
+    {
+        if (m_atlasPixels.empty())
+            return nullptr;
+
+        return m_atlasPixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontSoftware::getAtlasSize() const
+    {
+        return m_atlasSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSoftware::saveGlyphCache(const String& filename) const
+    {
+        if (!m_fileContents)
+            return false;
+
+        GlyphAtlasCache::Contents contents;
+        contents.atlasSize = m_atlasSize;
+        contents.pixels = m_atlasPixels;
+
+        contents.rows.reserve(m_atlasRows.size());
+        for (const auto& row : m_atlasRows)
+            contents.rows.push_back({row.top, row.height, row.width});
+
+        contents.glyphs.reserve(m_atlasGlyphs.size());
+        for (const auto& pair : m_atlasGlyphs)
+            contents.glyphs.push_back({pair.first, pair.second.textureRect, pair.second.offset, pair.second.advance});
+
+        return GlyphAtlasCache::saveToFile(filename, GlyphCacheBackendName, m_fileContents->getHash(), contents);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSoftware::loadGlyphCache(const String& filename)
+    {
+        if (!m_fileContents)
+            return false;
+
+        GlyphAtlasCache::Contents contents;
+        if (!GlyphAtlasCache::loadFromFile(filename, GlyphCacheBackendName, m_fileContents->getHash(), contents))
+            return false;
+
+        m_atlasSize = contents.atlasSize;
+        m_atlasPixels = std::move(contents.pixels);
+
+        m_atlasRows.clear();
+        for (const auto& row : contents.rows)
+            m_atlasRows.push_back({row.top, row.height, row.width});
+
+        m_atlasGlyphs.clear();
+        for (const auto& glyph : contents.glyphs)
+            m_atlasGlyphs[glyph.key] = {glyph.textureRect, glyph.offset, glyph.advance};
+
+        m_glyphCacheOutdated = false;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontSoftware::cleanup()
+    {
+        if (m_glyphCacheOutdated && !m_glyphCacheFilename.empty())
+            saveGlyphCache(m_glyphCacheFilename);
+
+        m_glyphCacheFilename.clear();
+        m_glyphCacheOutdated = false;
+
+        if (m_face)
+            FT_Done_Face(m_face);
+
+        m_face = nullptr;
+        m_fileContents = nullptr;
+        m_currentSize = 0;
+
+        m_atlasSize = {};
+        m_atlasPixels.clear();
+        m_atlasRows.clear();
+        m_atlasGlyphs.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendFontSoftware::setCurrentSize(unsigned int characterSize)
+    {
+        if (!m_face)
+            return false;
+
+        if (m_currentSize == characterSize)
+            return true;
+
+        if (FT_Set_Pixel_Sizes(m_face, 0, characterSize) != 0)
+            return false;
+
+        m_currentSize = characterSize;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendFontSoftware::AtlasGlyph BackendFontSoftware::rasterizeAtlasGlyph(char32_t codePoint, bool bold, bool italic, unsigned int outline)
+    {
+        AtlasGlyph glyph;
+
+        // Italic glyphs are created by slanting the regular glyph
+        FT_Matrix shear;
+        shear.xx = 0x10000;
+        shear.xy = 0x3333; // tan(11.3°), slant by a fifth of the height
+        shear.yx = 0;
+        shear.yy = 0x10000;
+        FT_Set_Transform(m_face, italic ? &shear : nullptr, nullptr);
+
+        const FT_Error loadError = FT_Load_Char(m_face, codePoint, FT_LOAD_TARGET_NORMAL | FT_LOAD_FORCE_AUTOHINT);
+        FT_Set_Transform(m_face, nullptr, nullptr);
+        if (loadError != 0)
+            return glyph;
+
+        FT_Glyph glyphDesc;
+        if (FT_Get_Glyph(m_face->glyph, &glyphDesc) != 0)
+            return glyph;
+
+        const FT_Pos weight = FT_MulFix(m_face->units_per_EM, m_face->size->metrics.y_scale) / 24;
+        if (glyphDesc->format == FT_GLYPH_FORMAT_OUTLINE)
+        {
+            if (bold)
+                FT_Outline_Embolden(&reinterpret_cast<FT_OutlineGlyph>(glyphDesc)->outline, weight);
+
+            if (outline != 0)
+            {
+                FT_Stroker stroker;
+                if (FT_Stroker_New(m_library, &stroker) == 0)
+                {
+                    FT_Stroker_Set(stroker, static_cast<FT_Fixed>(outline) * 64, FT_STROKER_LINECAP_ROUND, FT_STROKER_LINEJOIN_ROUND, 0);
+                    FT_Glyph_Stroke(&glyphDesc, stroker, true);
+                    FT_Stroker_Done(stroker);
+                }
+            }
+        }
+
+        glyph.advance = static_cast<float>(m_face->glyph->metrics.horiAdvance) / 64.f;
+        if (bold)
+            glyph.advance += static_cast<float>(weight) / 64.f;
+
+        if (FT_Glyph_To_Bitmap(&glyphDesc, FT_RENDER_MODE_NORMAL, nullptr, 1) != 0)
+        {
+            FT_Done_Glyph(glyphDesc);
+            return glyph;
+        }
+
+        const auto* bitmapGlyph = reinterpret_cast<FT_BitmapGlyph>(glyphDesc);
+        const FT_Bitmap& bitmap = bitmapGlyph->bitmap;
+
+        // The glyph is positioned relative to the top of the line instead of relative to the baseline
+        glyph.offset = {static_cast<float>(bitmapGlyph->left),
+                        static_cast<float>(m_face->size->metrics.ascender / 64 - bitmapGlyph->top)};
+
+        const unsigned int width = bitmap.width;
+        const unsigned int height = bitmap.rows;
+        if ((width > 0) && (height > 0))
+        {
+            const Vector2u position = findAtlasSpace(width, height);
+            for (unsigned int y = 0; y < height; ++y)
+            {
+                const unsigned char* row = bitmap.buffer + static_cast<std::ptrdiff_t>(y) * bitmap.pitch;
+                std::uint8_t* dest = &m_atlasPixels[(position.y + y) * m_atlasSize.x + position.x];
+                if (bitmap.pixel_mode == FT_PIXEL_MODE_MONO)
+                {
+                    // Monochrome bitmaps use one bit per pixel
+                    for (unsigned int x = 0; x < width; ++x)
+                        dest[x] = ((row[x / 8] >> (7 - (x % 8))) & 1) ? 255 : 0;
+                }
+                else
+                    std::memcpy(dest, row, width);
+            }
+
+            glyph.textureRect = {position.x, position.y, width, height};
+        }
+
+        FT_Done_Glyph(glyphDesc);
+        return glyph;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendFontSoftware::findAtlasSpace(unsigned int width, unsigned int height)
+    {
+        if (m_atlasPixels.empty())
+        {
+            resizeAtlas({InitialAtlasSize, InitialAtlasSize});
+
+            // Reserve a fully covered block in the top-left corner for drawing lines
+            m_atlasPixels[0] = 255;
+            m_atlasPixels[1] = 255;
+            m_atlasPixels[m_atlasSize.x] = 255;
+            m_atlasPixels[m_atlasSize.x + 1] = 255;
+            m_atlasRows.push_back({0, 2 + AtlasGlyphPadding, 2 + AtlasGlyphPadding});
+        }
+
+        const unsigned int paddedWidth = width + AtlasGlyphPadding;
+        const unsigned int paddedHeight = height + AtlasGlyphPadding;
+
+        // Find the row that fits the glyph best, rows that are much higher than the glyph would waste too much space
+        AtlasRow* bestRow = nullptr;
+        for (auto& row : m_atlasRows)
+        {
+            if ((row.height < paddedHeight) || (row.height > paddedHeight + paddedHeight / 4) || (row.width + paddedWidth > m_atlasSize.x))
+                continue;
+
+            if (!bestRow || (row.height < bestRow->height))
+                bestRow = &row;
+        }
+
+        // Create a new row if there was no suitable one, enlarging the atlas when there is no more space
+        if (!bestRow)
+        {
+            const unsigned int rowTop = m_atlasRows.back().top + m_atlasRows.back().height;
+            Vector2u newSize = m_atlasSize;
+            while (newSize.x < paddedWidth)
+                newSize.x *= 2;
+            while (rowTop + paddedHeight > newSize.y)
+                newSize.y *= 2;
+
+            if (newSize != m_atlasSize)
+                resizeAtlas(newSize);
+
+            m_atlasRows.push_back({rowTop, paddedHeight, 0});
+            bestRow = &m_atlasRows.back();
+        }
+
+        const Vector2u position{bestRow->width, bestRow->top};
+        bestRow->width += paddedWidth;
+        return position;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendFontSoftware::resizeAtlas(Vector2u newSize)
+    {
+        // Texture coordinates of glyphs are in pixels, they remain valid because existing glyphs keep their position
+        std::vector<std::uint8_t> newPixels(newSize.x * newSize.y, 0);
+        for (unsigned int y = 0; y < m_atlasSize.y; ++y)
+            std::memcpy(&newPixels[y * newSize.x], &m_atlasPixels[y * m_atlasSize.x], m_atlasSize.x);
+
+        m_atlasPixels = std::move(newPixels);
+        m_atlasSize = newSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
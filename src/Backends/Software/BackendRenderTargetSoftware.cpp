@@ -0,0 +1,913 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backends/Software/BackendRenderTargetSoftware.hpp>
+#include <TGUI/Backends/Software/BackendTextSoftware.hpp>
+#include <TGUI/Backends/Software/BackendFontSoftware.hpp>
+#include <TGUI/Backends/Software/BackendTextureSoftware.hpp>
+#include <TGUI/Container.hpp>
+#include <TGUI/DisplayList.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <cstring> // memcpy
+#include <cmath>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+    #define TGUI_SOFTWARE_RENDERER_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define TGUI_SOFTWARE_RENDERER_SSE2 0
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Divides a value between 0 and 255*255 by 255 with correct rounding, without using a division
+        inline unsigned int divide255(unsigned int value)
+        {
+            value += 128;
+            return (value + (value >> 8)) >> 8;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if TGUI_SOFTWARE_RENDERER_SSE2
+        // Divides each 16-bit lane (containing a value between 0 and 255*255) by 255, the same way as divide255 does
+        inline __m128i divide255(__m128i value)
+        {
+            value = _mm_add_epi16(value, _mm_set1_epi16(128));
+            return _mm_srli_epi16(_mm_add_epi16(value, _mm_srli_epi16(value, 8)), 8);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Copies the alpha of both pixels stored in the 16-bit lanes to all channels of that pixel
+        inline __m128i broadcastAlpha(__m128i pixels)
+        {
+            return _mm_shufflehi_epi16(_mm_shufflelo_epi16(pixels, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+        }
+#endif
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Blends RGBA source pixels on top of the destination pixels.
+        // The color channels become src*a + dst*(1-a) while the alpha channel becomes a + dstAlpha*(1-a).
+        void blendSpan(std::uint8_t* dst, const std::uint8_t* src, std::size_t count)
+        {
+            std::size_t i = 0;
+#if TGUI_SOFTWARE_RENDERER_SSE2
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i max = _mm_set1_epi16(255);
+            const __m128i alphaLanes = _mm_set_epi16(255, 0, 0, 0, 255, 0, 0, 0);
+            const __m128i alphaMask = _mm_set1_epi32(static_cast<int>(0xFF000000u));
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i srcPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src + i*4));
+
+                // Skip the blending when the pixels are either all transparent or all opaque
+                const __m128i srcAlpha = _mm_and_si128(srcPixels, alphaMask);
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(srcAlpha, zero)) == 0xFFFF)
+                    continue;
+                if (_mm_movemask_epi8(_mm_cmpeq_epi32(srcAlpha, alphaMask)) == 0xFFFF)
+                {
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), srcPixels);
+                    continue;
+                }
+
+                const __m128i dstPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i*4));
+
+                // Each pair of pixels is processed with 16 bits per channel so that the multiplications can't overflow.
+                // The alpha channel is multiplied with 255 instead of with its own value.
+                const __m128i srcLow = _mm_unpacklo_epi8(srcPixels, zero);
+                const __m128i srcHigh = _mm_unpackhi_epi8(srcPixels, zero);
+                const __m128i alphaLow = broadcastAlpha(srcLow);
+                const __m128i alphaHigh = broadcastAlpha(srcHigh);
+                const __m128i resultLow = _mm_add_epi16(_mm_mullo_epi16(srcLow, _mm_or_si128(alphaLow, alphaLanes)),
+                                                        _mm_mullo_epi16(_mm_unpacklo_epi8(dstPixels, zero), _mm_sub_epi16(max, alphaLow)));
+                const __m128i resultHigh = _mm_add_epi16(_mm_mullo_epi16(srcHigh, _mm_or_si128(alphaHigh, alphaLanes)),
+                                                         _mm_mullo_epi16(_mm_unpackhi_epi8(dstPixels, zero), _mm_sub_epi16(max, alphaHigh)));
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), _mm_packus_epi16(divide255(resultLow), divide255(resultHigh)));
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                const std::uint8_t* srcPixel = src + i*4;
+                std::uint8_t* dstPixel = dst + i*4;
+
+                const unsigned int alpha = srcPixel[3];
+                if (alpha == 0)
+                    continue;
+
+                if (alpha == 255)
+                {
+                    std::memcpy(dstPixel, srcPixel, 4);
+                    continue;
+                }
+
+                const unsigned int invAlpha = 255 - alpha;
+                dstPixel[0] = static_cast<std::uint8_t>(divide255(srcPixel[0] * alpha + dstPixel[0] * invAlpha));
+                dstPixel[1] = static_cast<std::uint8_t>(divide255(srcPixel[1] * alpha + dstPixel[1] * invAlpha));
+                dstPixel[2] = static_cast<std::uint8_t>(divide255(srcPixel[2] * alpha + dstPixel[2] * invAlpha));
+                dstPixel[3] = static_cast<std::uint8_t>(divide255(255 * alpha + dstPixel[3] * invAlpha));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Blends a single RGBA color on top of all destination pixels, with the same formula as blendSpan
+        void blendSolidSpan(std::uint8_t* dst, const std::uint8_t color[4], std::size_t count)
+        {
+            const unsigned int alpha = color[3];
+            if (alpha == 0)
+                return;
+
+            std::size_t i = 0;
+            if (alpha == 255)
+            {
+#if TGUI_SOFTWARE_RENDERER_SSE2
+                std::uint32_t packedColor;
+                std::memcpy(&packedColor, color, 4);
+                const __m128i colors = _mm_set1_epi32(static_cast<int>(packedColor));
+                for (; i + 4 <= count; i += 4)
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), colors);
+#endif
+                for (; i < count; ++i)
+                    std::memcpy(dst + i*4, color, 4);
+
+                return;
+            }
+
+            const unsigned int invAlpha = 255 - alpha;
+            const unsigned int srcTerm[4] = {color[0] * alpha, color[1] * alpha, color[2] * alpha, 255 * alpha};
+#if TGUI_SOFTWARE_RENDERER_SSE2
+            // The source part of the formula is the same for every pixel, only the destination still has to be multiplied
+            const __m128i zero = _mm_setzero_si128();
+            const __m128i srcTerms = _mm_set_epi16(static_cast<short>(srcTerm[3]), static_cast<short>(srcTerm[2]),
+                                                   static_cast<short>(srcTerm[1]), static_cast<short>(srcTerm[0]),
+                                                   static_cast<short>(srcTerm[3]), static_cast<short>(srcTerm[2]),
+                                                   static_cast<short>(srcTerm[1]), static_cast<short>(srcTerm[0]));
+            const __m128i invAlphas = _mm_set1_epi16(static_cast<short>(invAlpha));
+            for (; i + 4 <= count; i += 4)
+            {
+                const __m128i dstPixels = _mm_loadu_si128(reinterpret_cast<const __m128i*>(dst + i*4));
+                const __m128i resultLow = _mm_add_epi16(srcTerms, _mm_mullo_epi16(_mm_unpacklo_epi8(dstPixels, zero), invAlphas));
+                const __m128i resultHigh = _mm_add_epi16(srcTerms, _mm_mullo_epi16(_mm_unpackhi_epi8(dstPixels, zero), invAlphas));
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i*4), _mm_packus_epi16(divide255(resultLow), divide255(resultHigh)));
+            }
+#endif
+            for (; i < count; ++i)
+            {
+                std::uint8_t* dstPixel = dst + i*4;
+                dstPixel[0] = static_cast<std::uint8_t>(divide255(srcTerm[0] + dstPixel[0] * invAlpha));
+                dstPixel[1] = static_cast<std::uint8_t>(divide255(srcTerm[1] + dstPixel[1] * invAlpha));
+                dstPixel[2] = static_cast<std::uint8_t>(divide255(srcTerm[2] + dstPixel[2] * invAlpha));
+                dstPixel[3] = static_cast<std::uint8_t>(divide255(srcTerm[3] + dstPixel[3] * invAlpha));
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads a single pixel from an image as RGBA, coordinates outside the image are clamped to the border
+        inline void fetchPixel(const std::uint8_t* pixels, Vector2u size, unsigned int channels, int x, int y, float color[4])
+        {
+            const std::size_t clampedX = static_cast<std::size_t>(std::max(0, std::min(x, static_cast<int>(size.x) - 1)));
+            const std::size_t clampedY = static_cast<std::size_t>(std::max(0, std::min(y, static_cast<int>(size.y) - 1)));
+            const std::uint8_t* pixel = pixels + (clampedY * size.x + clampedX) * channels;
+            if (channels == 4)
+            {
+                color[0] = pixel[0];
+                color[1] = pixel[1];
+                color[2] = pixel[2];
+                color[3] = pixel[3];
+            }
+            else // The image only contains coverage
+            {
+                color[0] = 255;
+                color[1] = 255;
+                color[2] = 255;
+                color[3] = pixel[0];
+            }
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+#if TGUI_SOFTWARE_RENDERER_SSE2
+        // Reads a single pixel from an image as RGBA floats, in the same way as the other fetchPixel function
+        inline __m128 fetchPixel(const std::uint8_t* pixels, Vector2u size, unsigned int channels, int x, int y)
+        {
+            const std::size_t clampedX = static_cast<std::size_t>(std::max(0, std::min(x, static_cast<int>(size.x) - 1)));
+            const std::size_t clampedY = static_cast<std::size_t>(std::max(0, std::min(y, static_cast<int>(size.y) - 1)));
+            const std::uint8_t* pixel = pixels + (clampedY * size.x + clampedX) * channels;
+            if (channels == 4)
+            {
+                std::int32_t packedPixel;
+                std::memcpy(&packedPixel, pixel, 4);
+                const __m128i zero = _mm_setzero_si128();
+                const __m128i bytes = _mm_cvtsi32_si128(packedPixel);
+                return _mm_cvtepi32_ps(_mm_unpacklo_epi16(_mm_unpacklo_epi8(bytes, zero), zero));
+            }
+            else // The image only contains coverage
+                return _mm_set_ps(pixel[0], 255, 255, 255);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+#endif
+
+        std::uint32_t calculateCrc32(const std::uint8_t* data, std::size_t size, std::uint32_t crc = 0)
+        {
+            static std::uint32_t table[256] = {};
+            if (table[1] == 0)
+            {
+                for (std::uint32_t i = 0; i < 256; ++i)
+                {
+                    std::uint32_t value = i;
+                    for (unsigned int bit = 0; bit < 8; ++bit)
+                        value = (value & 1) ? (0xEDB88320u ^ (value >> 1)) : (value >> 1);
+                    table[i] = value;
+                }
+            }
+
+            crc = ~crc;
+            for (std::size_t i = 0; i < size; ++i)
+                crc = table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+            return ~crc;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void appendUint32(std::vector<std::uint8_t>& out, std::uint32_t value)
+        {
+            out.push_back(static_cast<std::uint8_t>(value >> 24));
+            out.push_back(static_cast<std::uint8_t>(value >> 16));
+            out.push_back(static_cast<std::uint8_t>(value >> 8));
+            out.push_back(static_cast<std::uint8_t>(value));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        void appendPngChunk(std::vector<std::uint8_t>& out, const char* type, const std::vector<std::uint8_t>& data)
+        {
+            appendUint32(out, static_cast<std::uint32_t>(data.size()));
+
+            const std::size_t typeOffset = out.size();
+            out.insert(out.end(), type, type + 4);
+            out.insert(out.end(), data.begin(), data.end());
+            appendUint32(out, calculateCrc32(out.data() + typeOffset, out.size() - typeOffset));
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Creates a PNG file in memory. The image data is placed in uncompressed deflate blocks,
+        // which keeps the encoder small while still producing a file that every image viewer can open.
+        std::vector<std::uint8_t> encodePng(const std::uint8_t* pixels, Vector2u size)
+        {
+            const std::size_t rowSize = static_cast<std::size_t>(size.x) * 4;
+
+            // Each row starts with a byte that indicates that no filter is used
+            std::vector<std::uint8_t> rawData;
+            rawData.reserve((rowSize + 1) * size.y);
+            for (unsigned int y = 0; y < size.y; ++y)
+            {
+                rawData.push_back(0);
+                rawData.insert(rawData.end(), pixels + y * rowSize, pixels + (y + 1) * rowSize);
+            }
+
+            std::vector<std::uint8_t> zlibData{0x78, 0x01};
+            zlibData.reserve(rawData.size() + (rawData.size() / 65535 + 1) * 5 + 6);
+            std::size_t offset = 0;
+            do
+            {
+                const std::size_t blockSize = std::min<std::size_t>(rawData.size() - offset, 65535);
+                const bool lastBlock = (offset + blockSize == rawData.size());
+                zlibData.push_back(lastBlock ? 1 : 0);
+                zlibData.push_back(static_cast<std::uint8_t>(blockSize & 0xFF));
+                zlibData.push_back(static_cast<std::uint8_t>(blockSize >> 8));
+                zlibData.push_back(static_cast<std::uint8_t>(~blockSize & 0xFF));
+                zlibData.push_back(static_cast<std::uint8_t>((~blockSize >> 8) & 0xFF));
+                zlibData.insert(zlibData.end(), rawData.begin() + static_cast<std::ptrdiff_t>(offset), rawData.begin() + static_cast<std::ptrdiff_t>(offset + blockSize));
+                offset += blockSize;
+            }
+            while (offset < rawData.size());
+
+            std::uint32_t adlerA = 1;
+            std::uint32_t adlerB = 0;
+            for (const std::uint8_t byte : rawData)
+            {
+                adlerA = (adlerA + byte) % 65521;
+                adlerB = (adlerB + adlerA) % 65521;
+            }
+            appendUint32(zlibData, (adlerB << 16) | adlerA);
+
+            std::vector<std::uint8_t> header;
+            appendUint32(header, size.x);
+            appendUint32(header, size.y);
+            header.push_back(8); // Bit depth
+            header.push_back(6); // Color type: RGBA
+            header.push_back(0); // Compression method
+            header.push_back(0); // Filter method
+            header.push_back(0); // Interlace method
+
+            std::vector<std::uint8_t> file{0x89, 'P', 'N', 'G', '\r', '\n', 0x1A, '\n'};
+            appendPngChunk(file, "IHDR", header);
+            appendPngChunk(file, "IDAT", zlibData);
+            appendPngChunk(file, "IEND", {});
+            return file;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    BackendRenderTargetSoftware::BackendRenderTargetSoftware(Vector2u size)
+    {
+        setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::setSize(Vector2u size)
+    {
+        m_size = size;
+        m_pixels.assign(static_cast<std::size_t>(size.x) * size.y * 4, 0);
+        setView({0, 0, static_cast<float>(size.x), static_cast<float>(size.y)}, {0, 0, static_cast<float>(size.x), static_cast<float>(size.y)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendRenderTargetSoftware::getSize() const
+    {
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::clear(Color color)
+    {
+        const std::uint8_t pixel[4] = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+        for (std::size_t i = 0; i < m_pixels.size(); i += 4)
+            std::memcpy(&m_pixels[i], pixel, 4);
+    }
+
+    void BackendRenderTargetSoftware::clear(Color color, FloatRect region)
+    {
+        const IntRect pixels = getRegionPixels(region);
+        const std::uint8_t pixel[4] = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+        for (int y = pixels.top; y < pixels.top + pixels.height; ++y)
+        {
+            std::uint8_t* row = &m_pixels[(static_cast<std::size_t>(y) * m_size.x + static_cast<std::size_t>(pixels.left)) * 4];
+            for (int x = 0; x < pixels.width; ++x)
+                std::memcpy(&row[static_cast<std::size_t>(x) * 4], pixel, 4);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendRenderTargetSoftware::getPixels() const
+    {
+        return m_pixels.data();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendRenderTargetSoftware::saveToFile(const String& filename) const
+    {
+        std::ofstream file{filename.toStdString(), std::ios::binary};
+        if (!file)
+            return false;
+
+        const std::vector<std::uint8_t> fileContents = encodePng(m_pixels.data(), m_size);
+        file.write(reinterpret_cast<const char*>(fileContents.data()), static_cast<std::streamsize>(fileContents.size()));
+        return static_cast<bool>(file);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::setView(FloatRect view, FloatRect viewport)
+    {
+        m_viewRect = view;
+
+        m_viewTransform = Transform();
+        m_viewTransform.translate(viewport.getPosition());
+        m_viewTransform.scale({viewport.width / view.width, viewport.height / view.height});
+        m_viewTransform.translate(-view.getPosition());
+
+        // The viewport is limited to the framebuffer, so that nothing can ever be drawn outside of it
+        const int left = std::max(0, static_cast<int>(std::round(viewport.left)));
+        const int top = std::max(0, static_cast<int>(std::round(viewport.top)));
+        const int right = std::max(left, std::min(static_cast<int>(m_size.x), static_cast<int>(std::round(viewport.left + viewport.width))));
+        const int bottom = std::max(top, std::min(static_cast<int>(m_size.y), static_cast<int>(std::round(viewport.top + viewport.height))));
+        m_viewport = {left, top, right - left, bottom - top};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawGui(const std::shared_ptr<RootContainer>& root)
+    {
+        m_culledPrimitiveCount = 0;
+        root->draw(*this, {});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawGuiRegion(const std::shared_ptr<RootContainer>& root, FloatRect region)
+    {
+        m_culledPrimitiveCount = 0;
+
+        const IntRect pixels = getRegionPixels(region);
+        if ((pixels.width <= 0) || (pixels.height <= 0))
+            return;
+
+        // The region acts as the outer clipping layer, so widgets that don't intersect with it aren't drawn at all.
+        // The rect used for culling must cover all pixels that are redrawn, so it is calculated from the rounded pixel rect.
+        const FloatRect clipRect = m_viewTransform.getInverse().transformRect({static_cast<float>(pixels.left), static_cast<float>(pixels.top),
+                                                                               static_cast<float>(pixels.width), static_cast<float>(pixels.height)});
+        m_clippingLayers.push_back({clipRect, pixels});
+        root->draw(*this, {});
+        m_clippingLayers.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawWidget(const RenderStates& states, const std::shared_ptr<Widget>& widget)
+    {
+        // If the widget lies outside of the clip rect then we can skip drawing it
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        const Vector2f widgetBottomRight{states.transform.transformPoint(widget->getWidgetOffset() + widget->getFullSize())};
+        const Vector2f widgetTopLeft = states.transform.transformPoint(widget->getWidgetOffset());
+        if ((widgetTopLeft.x > clipRect.left + clipRect.width) || (widgetTopLeft.y > clipRect.top + clipRect.height)
+         || (widgetBottomRight.x < clipRect.left) || (widgetBottomRight.y < clipRect.top))
+            return;
+
+        widget->draw(*this, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::addClippingLayer(const RenderStates& states, FloatRect rect)
+    {
+        const FloatRect& oldClipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        const IntRect& oldClipPixels = m_clippingLayers.empty() ? m_viewport : m_clippingLayers.back().second;
+
+        /// TODO: We currently can't clip rotated objects (except for 90°, 180° or 270° rotations)
+        const float* transformMatrix = states.transform.getMatrix();
+        if (((std::abs(transformMatrix[1]) > 0.00001f) || (std::abs(transformMatrix[4]) > 0.00001f)) // 0° or 180°
+         && ((std::abs(transformMatrix[1] - 1) > 0.00001f) || (std::abs(transformMatrix[4] + 1) > 0.00001f)) // 90°
+         && ((std::abs(transformMatrix[1] + 1) > 0.00001f) || (std::abs(transformMatrix[4] - 1) > 0.00001f))) // -90°
+        {
+            m_clippingLayers.push_back({oldClipRect, oldClipPixels});
+            return;
+        }
+
+        const Vector2f bottomRight{states.transform.transformPoint(rect.getPosition() + rect.getSize())};
+        const Vector2f topLeft = states.transform.transformPoint(rect.getPosition());
+
+        // Rotated rectangles may have their corners swapped in framebuffer coordinates
+        const Vector2f pixelCorner1 = m_viewTransform.transformPoint(topLeft);
+        const Vector2f pixelCorner2 = m_viewTransform.transformPoint(bottomRight);
+        const int clipLeft = std::max(static_cast<int>(std::round(std::min(pixelCorner1.x, pixelCorner2.x))), oldClipPixels.left);
+        const int clipTop = std::max(static_cast<int>(std::round(std::min(pixelCorner1.y, pixelCorner2.y))), oldClipPixels.top);
+        const int clipRight = std::max(clipLeft, std::min(static_cast<int>(std::round(std::max(pixelCorner1.x, pixelCorner2.x))), oldClipPixels.left + oldClipPixels.width));
+        const int clipBottom = std::max(clipTop, std::min(static_cast<int>(std::round(std::max(pixelCorner1.y, pixelCorner2.y))), oldClipPixels.top + oldClipPixels.height));
+
+        const FloatRect clipRect = {topLeft, bottomRight - topLeft};
+        const IntRect clipPixels = {clipLeft, clipTop, clipRight - clipLeft, clipBottom - clipTop};
+        m_clippingLayers.push_back({clipRect, clipPixels});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::removeClippingLayer()
+    {
+        TGUI_ASSERT(!m_clippingLayers.empty(), "BackendRenderTargetSoftware::removeClippingLayer was called when there were no clipping layers");
+        m_clippingLayers.pop_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawSprite(const RenderStates& states, const Sprite& sprite)
+    {
+        if (!sprite.isSet())
+            return;
+
+        // Skip the sprite when it lies entirely outside the clipping area
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getSpriteBounds(sprite), clipRect))
+            return;
+
+        RenderStates transformedStates = states;
+        if (sprite.getRotation() != 0)
+        {
+            // A rotation can cause the image to be shifted, so we move it upfront so that it ends at the correct location
+            transformedStates.transform.translate(-Transform().rotate(sprite.getRotation()).transformRect({{}, sprite.getSize()}).getPosition());
+            transformedStates.transform.rotate(sprite.getRotation());
+        }
+
+        transformedStates.transform.translate(sprite.getPosition());
+
+        const FloatRect& visibleRect = sprite.getVisibleRect();
+        const bool clippingRequired = (visibleRect != FloatRect{});
+        if (clippingRequired)
+            addClippingLayer(transformedStates, {{visibleRect.left, visibleRect.top}, {visibleRect.width, visibleRect.height}});
+
+        std::shared_ptr<BackendTextureSoftware> backendTexture;
+        if (sprite.getTexture().getData()->svgImage)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSoftware>(sprite.getSvgTexture()), "BackendRenderTargetSoftware::drawSprite requires SVG texture of type BackendTextureSoftware");
+            backendTexture = std::static_pointer_cast<BackendTextureSoftware>(sprite.getSvgTexture());
+        }
+        else
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSoftware>(sprite.getTexture().getBackendTexture()),
+                        "BackendRenderTargetSoftware::drawSprite requires backend texture of type BackendTextureSoftware");
+            backendTexture = std::static_pointer_cast<BackendTextureSoftware>(sprite.getTexture().getBackendTexture());
+        }
+
+        if (backendTexture && backendTexture->getPixels())
+        {
+            Sampler sampler;
+            sampler.pixels = backendTexture->getPixels();
+            sampler.size = backendTexture->getSize();
+            sampler.channels = 4;
+            sampler.smooth = backendTexture->isSmooth();
+
+            const std::vector<Vertex>& vertices = sprite.getVertices();
+            const std::vector<int>& indices = sprite.getIndices();
+            drawVertices(transformedStates.transform, sampler, vertices.data(), vertices.size(), indices.data(), indices.size());
+        }
+
+        if (clippingRequired)
+            removeClippingLayer();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawText(const RenderStates& states, const Text& text)
+    {
+        // Skip the text when it lies entirely outside the clipping area, e.g. lines that were scrolled out of view
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getTextBounds(text), clipRect))
+            return;
+
+        RenderStates movedStates = states;
+        movedStates.transform.translate(text.getPosition());
+
+        TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextSoftware>(text.getBackendText()), "BackendRenderTargetSoftware::drawText requires backend text of type BackendTextSoftware");
+        const auto backendText = std::static_pointer_cast<BackendTextSoftware>(text.getBackendText());
+
+        // The vertices have to be retrieved before the atlas, because new glyphs may still have to be added to the atlas
+        const std::vector<Vertex>& vertices = backendText->getGlyphVertices();
+        const std::vector<int>& indices = backendText->getGlyphIndices();
+
+        const auto font = backendText->getFont();
+        if (!font || !font->getAtlasPixels())
+            return;
+
+        Sampler sampler;
+        sampler.pixels = font->getAtlasPixels();
+        sampler.size = font->getAtlasSize();
+        sampler.channels = 1;
+        sampler.smooth = false;
+        drawVertices(movedStates.transform, sampler, vertices.data(), vertices.size(), indices.data(), indices.size());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    {
+        // Skip the triangles when they lie entirely outside the clipping area
+        const FloatRect& clipRect = m_clippingLayers.empty() ? m_viewRect : m_clippingLayers.back().first;
+        if (isCulled(states.transform, getVertexBounds(vertices, vertexCount), clipRect))
+            return;
+
+        if (!indices)
+            indexCount = vertexCount;
+
+        drawVertices(states.transform, Sampler{}, vertices, vertexCount, indices, indexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::unique_ptr<std::uint8_t[]> BackendRenderTargetSoftware::drawOffscreen(const DisplayList& displayList, FloatRect region, Vector2u size)
+    {
+        if ((size.x == 0) || (size.y == 0))
+            return nullptr;
+
+        // A separate framebuffer is used, so that nothing has to be restored when this function is called while drawing
+        BackendRenderTargetSoftware offscreenTarget{size};
+        offscreenTarget.setView(region, {0, 0, static_cast<float>(size.x), static_cast<float>(size.y)});
+        offscreenTarget.clear(Color::Transparent);
+        displayList.replay(offscreenTarget);
+
+        auto pixels = std::make_unique<std::uint8_t[]>(offscreenTarget.m_pixels.size());
+        std::memcpy(pixels.get(), offscreenTarget.m_pixels.data(), offscreenTarget.m_pixels.size());
+        unpremultiplyAlpha(pixels.get(), static_cast<std::size_t>(size.x) * size.y);
+        return pixels;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawVertices(const Transform& transform, const Sampler& sampler, const Vertex* vertices, std::size_t vertexCount,
+                                                   const int* indices, std::size_t indexCount)
+    {
+        if ((vertexCount == 0) || (indexCount == 0))
+            return;
+
+        Transform finalTransform = transform;
+        finalTransform.roundPosition(); // Avoid blurry texts
+        finalTransform = m_viewTransform * finalTransform;
+
+        m_transformedVertices.resize(vertexCount);
+        for (std::size_t i = 0; i < vertexCount; ++i)
+        {
+            m_transformedVertices[i] = vertices[i];
+            m_transformedVertices[i].position = finalTransform.transformPoint(vertices[i].position);
+        }
+
+        for (std::size_t i = 0; i + 2 < indexCount; i += 3)
+        {
+            if (indices)
+            {
+                drawTriangle(m_transformedVertices[static_cast<std::size_t>(indices[i])],
+                             m_transformedVertices[static_cast<std::size_t>(indices[i+1])],
+                             m_transformedVertices[static_cast<std::size_t>(indices[i+2])],
+                             sampler);
+            }
+            else
+                drawTriangle(m_transformedVertices[i], m_transformedVertices[i+1], m_transformedVertices[i+2], sampler);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendRenderTargetSoftware::drawTriangle(const Vertex& v0, const Vertex& vertex1, const Vertex& vertex2, const Sampler& sampler)
+    {
+        // The vertices are ordered so that the inside of the triangle always lies on the positive side of each edge
+        const float signedArea = (vertex1.position.x - v0.position.x) * (vertex2.position.y - v0.position.y)
+                               - (vertex1.position.y - v0.position.y) * (vertex2.position.x - v0.position.x);
+        if (std::abs(signedArea) < 0.0001f)
+            return;
+
+        const Vertex& v1 = (signedArea > 0) ? vertex1 : vertex2;
+        const Vertex& v2 = (signedArea > 0) ? vertex2 : vertex1;
+        const float area = std::abs(signedArea);
+
+        const IntRect& clip = m_clippingLayers.empty() ? m_viewport : m_clippingLayers.back().second;
+        const int clipRight = clip.left + clip.width;
+        const int clipBottom = clip.top + clip.height;
+
+        // Only pixels of which the center lies inside the triangle are drawn
+        const float minY = std::min({v0.position.y, v1.position.y, v2.position.y});
+        const float maxY = std::max({v0.position.y, v1.position.y, v2.position.y});
+        const int firstRow = std::max(clip.top, static_cast<int>(std::ceil(std::max(minY, static_cast<float>(clip.top)) - 0.5f)));
+        const int lastRow = std::min(clipBottom, static_cast<int>(std::ceil(std::min(maxY, static_cast<float>(clipBottom)) - 0.5f)));
+        if (firstRow >= lastRow)
+            return;
+
+        // Each edge function has the form "slope * x + offset", where the offset depends on the row.
+        // The function of an edge is also the barycentric weight of the vertex that lies opposite to it (times the area).
+        struct Edge
+        {
+            const Vertex* from;
+            const Vertex* to;
+        };
+        const Edge edges[3] = {{&v1, &v2}, {&v2, &v0}, {&v0, &v1}}; // Opposite to v0, v1 and v2 respectively
+
+        const bool solidColor = !sampler.pixels
+            && (v0.color.red == v1.color.red) && (v0.color.red == v2.color.red)
+            && (v0.color.green == v1.color.green) && (v0.color.green == v2.color.green)
+            && (v0.color.blue == v1.color.blue) && (v0.color.blue == v2.color.blue)
+            && (v0.color.alpha == v1.color.alpha) && (v0.color.alpha == v2.color.alpha);
+        const std::uint8_t solidPixel[4] = {v0.color.red, v0.color.green, v0.color.blue, v0.color.alpha};
+
+        const std::size_t rowStride = static_cast<std::size_t>(m_size.x) * 4;
+        for (int y = firstRow; y < lastRow; ++y)
+        {
+            const float centerY = y + 0.5f;
+
+            float slopes[3];
+            float offsets[3];
+            float spanLeft = static_cast<float>(clip.left);
+            float spanRight = static_cast<float>(clipRight);
+            bool rowVisible = true;
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                const Vector2f from = edges[i].from->position;
+                const Vector2f to = edges[i].to->position;
+                slopes[i] = from.y - to.y;
+                offsets[i] = (to.x - from.x) * (centerY - from.y) + (to.y - from.y) * from.x;
+
+                if (slopes[i] > 0)
+                    spanLeft = std::max(spanLeft, -offsets[i] / slopes[i]);
+                else if (slopes[i] < 0)
+                    spanRight = std::min(spanRight, -offsets[i] / slopes[i]);
+                else if ((offsets[i] < 0) || ((offsets[i] == 0) && (to.x < from.x)))
+                {
+                    // A horizontal edge on which the pixel centers lie only belongs to one of the triangles that share it
+                    rowVisible = false;
+                    break;
+                }
+            }
+
+            if (!rowVisible)
+                continue;
+
+            // Pixels on the left edge are included, pixels on the right edge belong to the triangle next to it
+            const int firstColumn = std::max(clip.left, static_cast<int>(std::ceil(spanLeft - 0.5f)));
+            const int lastColumn = std::min(clipRight, static_cast<int>(std::ceil(spanRight - 0.5f)));
+            if (firstColumn >= lastColumn)
+                continue;
+
+            const std::size_t spanLength = static_cast<std::size_t>(lastColumn - firstColumn);
+            std::uint8_t* dst = &m_pixels[static_cast<std::size_t>(y) * rowStride + static_cast<std::size_t>(firstColumn) * 4];
+            if (solidColor)
+            {
+                blendSolidSpan(dst, solidPixel, spanLength);
+                continue;
+            }
+
+            // Barycentric weights at the center of the first pixel and how much they change per pixel
+            float weights[3];
+            float weightSteps[3];
+            for (unsigned int i = 0; i < 3; ++i)
+            {
+                weights[i] = (slopes[i] * (firstColumn + 0.5f) + offsets[i]) / area;
+                weightSteps[i] = slopes[i] / area;
+            }
+
+            if (m_spanColors.size() < spanLength * 4)
+                m_spanColors.resize(spanLength * 4);
+
+#if TGUI_SOFTWARE_RENDERER_SSE2
+            // Each pixel is processed with its 4 channels in a single register. The operations are performed in the same order
+            // as in the scalar code below, so that both produce the same pixels.
+            const __m128 vertexColors[3] = {
+                _mm_set_ps(v0.color.alpha, v0.color.blue, v0.color.green, v0.color.red),
+                _mm_set_ps(v1.color.alpha, v1.color.blue, v1.color.green, v1.color.red),
+                _mm_set_ps(v2.color.alpha, v2.color.blue, v2.color.green, v2.color.red)};
+            const __m128 vertexTexCoords[3] = {
+                _mm_set_ps(0, 0, v0.texCoords.y, v0.texCoords.x),
+                _mm_set_ps(0, 0, v1.texCoords.y, v1.texCoords.x),
+                _mm_set_ps(0, 0, v2.texCoords.y, v2.texCoords.x)};
+            const __m128 zero = _mm_setzero_ps();
+            const __m128 max = _mm_set1_ps(255);
+            const __m128 half = _mm_set1_ps(0.5f);
+            for (std::size_t x = 0; x < spanLength; ++x)
+            {
+                const __m128 weight0 = _mm_set1_ps(weights[0]);
+                const __m128 weight1 = _mm_set1_ps(weights[1]);
+                const __m128 weight2 = _mm_set1_ps(weights[2]);
+                __m128 color = _mm_add_ps(_mm_add_ps(_mm_mul_ps(weight0, vertexColors[0]), _mm_mul_ps(weight1, vertexColors[1])),
+                                          _mm_mul_ps(weight2, vertexColors[2]));
+                for (unsigned int i = 0; i < 3; ++i)
+                    weights[i] += weightSteps[i];
+
+                if (sampler.pixels)
+                {
+                    const __m128 texCoords = _mm_add_ps(_mm_add_ps(_mm_mul_ps(weight0, vertexTexCoords[0]), _mm_mul_ps(weight1, vertexTexCoords[1])),
+                                                        _mm_mul_ps(weight2, vertexTexCoords[2]));
+                    const float texCoordX = _mm_cvtss_f32(texCoords);
+                    const float texCoordY = _mm_cvtss_f32(_mm_shuffle_ps(texCoords, texCoords, _MM_SHUFFLE(1, 1, 1, 1)));
+
+                    __m128 texel;
+                    if (sampler.smooth)
+                    {
+                        const float u = texCoordX - 0.5f;
+                        const float v = texCoordY - 0.5f;
+                        const float left = std::floor(u);
+                        const float top = std::floor(v);
+                        const __m128 ratioX = _mm_set1_ps(u - left);
+                        const __m128 ratioY = _mm_set1_ps(v - top);
+
+                        const __m128 topLeft = fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left), static_cast<int>(top));
+                        const __m128 topRight = fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left) + 1, static_cast<int>(top));
+                        const __m128 bottomLeft = fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left), static_cast<int>(top) + 1);
+                        const __m128 bottomRight = fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left) + 1, static_cast<int>(top) + 1);
+                        const __m128 topValue = _mm_add_ps(topLeft, _mm_mul_ps(_mm_sub_ps(topRight, topLeft), ratioX));
+                        const __m128 bottomValue = _mm_add_ps(bottomLeft, _mm_mul_ps(_mm_sub_ps(bottomRight, bottomLeft), ratioX));
+                        texel = _mm_add_ps(topValue, _mm_mul_ps(_mm_sub_ps(bottomValue, topValue), ratioY));
+                    }
+                    else
+                    {
+                        texel = fetchPixel(sampler.pixels, sampler.size, sampler.channels,
+                                           static_cast<int>(std::floor(texCoordX)), static_cast<int>(std::floor(texCoordY)));
+                    }
+
+                    color = _mm_div_ps(_mm_mul_ps(color, texel), max);
+                }
+
+                // Truncating the clamped value rounds it, as the color can't be negative after clamping
+                const __m128i channels = _mm_cvttps_epi32(_mm_max_ps(zero, _mm_min_ps(max, _mm_add_ps(color, half))));
+                const __m128i packedChannels = _mm_packs_epi32(channels, channels);
+                const std::int32_t packedPixel = _mm_cvtsi128_si32(_mm_packus_epi16(packedChannels, packedChannels));
+                std::memcpy(&m_spanColors[x * 4], &packedPixel, 4);
+            }
+#else
+            const Vertex* triangleVertices[3] = {&v0, &v1, &v2};
+            for (std::size_t x = 0; x < spanLength; ++x)
+            {
+                float color[4] = {0, 0, 0, 0};
+                float texCoords[2] = {0, 0};
+                for (unsigned int i = 0; i < 3; ++i)
+                {
+                    const Vertex& vertex = *triangleVertices[i];
+                    color[0] += weights[i] * vertex.color.red;
+                    color[1] += weights[i] * vertex.color.green;
+                    color[2] += weights[i] * vertex.color.blue;
+                    color[3] += weights[i] * vertex.color.alpha;
+                    texCoords[0] += weights[i] * vertex.texCoords.x;
+                    texCoords[1] += weights[i] * vertex.texCoords.y;
+                    weights[i] += weightSteps[i];
+                }
+
+                if (sampler.pixels)
+                {
+                    float texel[4];
+                    if (sampler.smooth)
+                    {
+                        const float u = texCoords[0] - 0.5f;
+                        const float v = texCoords[1] - 0.5f;
+                        const float left = std::floor(u);
+                        const float top = std::floor(v);
+                        const float ratioX = u - left;
+                        const float ratioY = v - top;
+
+                        float topLeft[4];
+                        float topRight[4];
+                        float bottomLeft[4];
+                        float bottomRight[4];
+                        fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left), static_cast<int>(top), topLeft);
+                        fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left) + 1, static_cast<int>(top), topRight);
+                        fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left), static_cast<int>(top) + 1, bottomLeft);
+                        fetchPixel(sampler.pixels, sampler.size, sampler.channels, static_cast<int>(left) + 1, static_cast<int>(top) + 1, bottomRight);
+                        for (unsigned int c = 0; c < 4; ++c)
+                        {
+                            const float topValue = topLeft[c] + (topRight[c] - topLeft[c]) * ratioX;
+                            const float bottomValue = bottomLeft[c] + (bottomRight[c] - bottomLeft[c]) * ratioX;
+                            texel[c] = topValue + (bottomValue - topValue) * ratioY;
+                        }
+                    }
+                    else
+                    {
+                        fetchPixel(sampler.pixels, sampler.size, sampler.channels,
+                                   static_cast<int>(std::floor(texCoords[0])), static_cast<int>(std::floor(texCoords[1])), texel);
+                    }
+
+                    for (unsigned int c = 0; c < 4; ++c)
+                        color[c] = color[c] * texel[c] / 255.f;
+                }
+
+                for (unsigned int c = 0; c < 4; ++c)
+                    m_spanColors[x * 4 + c] = static_cast<std::uint8_t>(std::max(0.f, std::min(255.f, color[c] + 0.5f)));
+            }
+#endif
+
+            blendSpan(dst, m_spanColors.data(), spanLength);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    IntRect BackendRenderTargetSoftware::getRegionPixels(FloatRect region) const
+    {
+        const Vector2f pixelCorner1 = m_viewTransform.transformPoint(region.getPosition());
+        const Vector2f pixelCorner2 = m_viewTransform.transformPoint(region.getPosition() + region.getSize());
+        const int left = std::max(static_cast<int>(std::round(std::min(pixelCorner1.x, pixelCorner2.x))), m_viewport.left);
+        const int top = std::max(static_cast<int>(std::round(std::min(pixelCorner1.y, pixelCorner2.y))), m_viewport.top);
+        const int right = std::max(left, std::min(static_cast<int>(std::round(std::max(pixelCorner1.x, pixelCorner2.x))), m_viewport.left + m_viewport.width));
+        const int bottom = std::max(top, std::min(static_cast<int>(std::round(std::max(pixelCorner1.y, pixelCorner2.y))), m_viewport.top + m_viewport.height));
+        return {left, top, right - left, bottom - top};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backends/Software/BackendSoftware.hpp>
+#include <TGUI/Backends/Software/BackendFontSoftware.hpp>
+#include <TGUI/Backends/Software/BackendTextSoftware.hpp>
+#include <TGUI/Backends/Software/BackendTextureSoftware.hpp>
+#include <TGUI/Backends/Software/BackendRenderTargetSoftware.hpp>
+#include <TGUI/Backends/Software/GuiSoftware.hpp>
+#include <TGUI/DefaultFont.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    void BackendSoftware::attachGui(GuiBase* gui)
+    {
+        m_guis.insert(gui);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendSoftware::detatchGui(GuiBase* gui)
+    {
+        TGUI_ASSERT(m_guis.find(gui) != m_guis.end(), "BackendSoftware::detatchGui called with a gui that wasn't attached");
+        m_guis.erase(gui);
+
+        if (m_destroyOnLastGuiDetatch && m_guis.empty())
+            setBackend(nullptr);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Font BackendSoftware::createDefaultFont()
+    {
+        auto font = std::make_shared<BackendFontSoftware>();
+        font->loadFromMemory(defaultFontBytes, sizeof(defaultFontBytes));
+        return Font(font, "");
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendFontBase> BackendSoftware::createFont()
+    {
+        return std::make_shared<BackendFontSoftware>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTextBase> BackendSoftware::createText()
+    {
+        return std::make_shared<BackendTextSoftware>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTextureBase> BackendSoftware::createTexture()
+    {
+        return std::make_shared<BackendTextureSoftware>();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendSoftware::setMouseCursorStyle(Cursor::Type, const std::uint8_t*, Vector2u, Vector2u)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendSoftware::resetMouseCursorStyle(Cursor::Type)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendSoftware::setMouseCursor(GuiBase* gui, Cursor::Type)
+    {
+        TGUI_ASSERT(m_guis.find(gui) != m_guis.end(), "BackendSoftware::setMouseCursor called with a gui that wasn't attached");
+        (void)gui;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendSoftware::openVirtualKeyboard(const FloatRect&)
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendSoftware::closeVirtualKeyboard()
+    {
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendSoftware::isKeyboardModifierPressed(Event::KeyModifier)
+    {
+        return false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendRenderTargetSoftware> BackendSoftware::createGuiRenderTarget(GuiSoftware* gui, Vector2u size)
+    {
+        TGUI_ASSERT(m_guis.find(gui) != m_guis.end(), "BackendSoftware::createGuiRenderTarget called with a gui that wasn't attached");
+        (void)gui;
+        return std::make_shared<BackendRenderTargetSoftware>(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
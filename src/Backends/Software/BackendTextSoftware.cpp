@@ -0,0 +1,344 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backends/Software/BackendTextSoftware.hpp>
+#include <TGUI/Backends/Software/BackendFontSoftware.hpp>
+#include <TGUI/Font.hpp>
+
+#include <algorithm>
+#include <cmath>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    BackendTextSoftware::BackendTextSoftware()
+    {
+        // There must always be a single line of text, even when the text is empty
+        m_lines.emplace_back();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f BackendTextSoftware::getSize()
+    {
+        if (!m_glyphVerticesValid && !updateGlyphVertices())
+            return {0, 0};
+
+        return m_size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::setString(const String& string)
+    {
+        m_lines = string.split(U'\n');
+        m_glyphVerticesValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::setCharacterSize(unsigned int characterSize)
+    {
+        m_characterSize = characterSize;
+        m_glyphVerticesValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::setFillColor(const Color& color)
+    {
+        m_textColor = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+        m_glyphVerticesValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::setOutlineColor(const Color& color)
+    {
+        m_outlineColor = {color.getRed(), color.getGreen(), color.getBlue(), color.getAlpha()};
+        m_glyphVerticesValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::setOutlineThickness(float thickness)
+    {
+        m_outlineThickness = static_cast<unsigned int>(std::max(0.f, std::round(thickness)));
+        m_glyphVerticesValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::setStyle(TextStyles style)
+    {
+        m_style = style;
+        m_glyphVerticesValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::setFont(const Font& font)
+    {
+        if (font)
+        {
+            TGUI_ASSERT(std::dynamic_pointer_cast<BackendFontSoftware>(font.getBackendFont()), "BackendTextSoftware::setFont requires font of type BackendFontSoftware");
+            m_font = std::static_pointer_cast<BackendFontSoftware>(font.getBackendFont());
+        }
+        else
+            m_font = nullptr;
+
+        m_glyphVerticesValid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2f BackendTextSoftware::findCharacterPos(std::size_t index) const
+    {
+        if (!m_font)
+            return {0, 0};
+
+        TGUI_ASSERT(!m_lines.empty(), "BackendTextSoftware::m_lines can never be empty");
+
+        std::size_t lineNumber = 0;
+        while (index > m_lines[lineNumber].length())
+        {
+            index -= m_lines[lineNumber].length() + 1;
+            ++lineNumber;
+            TGUI_ASSERT(lineNumber < m_lines.size(), "Index out-of-range in BackendTextSoftware::findCharacterPos");
+        }
+
+        const bool bold = ((m_style & TextStyle::Bold) != 0);
+        const bool italic = ((m_style & TextStyle::Italic) != 0);
+
+        float x = 0;
+        char32_t prevChar = U'\0';
+        for (std::size_t i = 0; i < index; ++i)
+        {
+            const char32_t currentChar = m_lines[lineNumber][i];
+            if (currentChar == U'\r')
+                continue;
+
+            x += getAdvance(currentChar, bold, italic);
+            x += m_font->getKerning(prevChar, currentChar, m_characterSize, bold);
+            prevChar = currentChar;
+        }
+
+        if (lineNumber == 0)
+            return {x, 0};
+        else
+            return {x, static_cast<float>(lineNumber * m_font->getLineSpacing(m_characterSize))};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<Vertex>& BackendTextSoftware::getGlyphVertices()
+    {
+        if (!m_glyphVerticesValid)
+            updateGlyphVertices();
+
+        return m_glyphVertices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::vector<int>& BackendTextSoftware::getGlyphIndices()
+    {
+        if (!m_glyphVerticesValid)
+            updateGlyphVertices();
+
+        return m_glyphIndices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendFontSoftware> BackendTextSoftware::getFont() const
+    {
+        return m_font;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextSoftware::updateGlyphVertices()
+    {
+        if (!m_font || (m_characterSize == 0))
+            return false;
+
+        const float lineSpacing = m_font->getLineSpacing(m_characterSize);
+
+        // Clearing the vectors keeps their capacity, so changing the text usually doesn't need new allocations
+        m_glyphVertices.clear();
+        m_glyphIndices.clear();
+
+        // The size is calculated in the same way as in the other backends, so that widgets are laid out identically.
+        // The height includes the part of the last line below the baseline, the width is the advance of the longest line.
+        const bool bold = ((m_style & TextStyle::Bold) != 0);
+        const FontGlyph descenderGlyph = m_font->getGlyph(U'g', m_characterSize, bold);
+        const float extraVerticalSpace = m_characterSize + descenderGlyph.bounds.height + descenderGlyph.bounds.top - lineSpacing;
+        m_size.x = 0;
+        m_size.y = m_lines.size() * lineSpacing + extraVerticalSpace;
+
+        // The outline is added first so that the filled glyphs are drawn on top of it
+        if (m_outlineThickness != 0)
+            addGlyphQuads(lineSpacing, m_outlineColor, m_outlineThickness);
+
+        addGlyphQuads(lineSpacing, m_textColor, 0);
+
+        m_glyphVerticesValid = true;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::addGlyphQuads(float lineSpacing, const Vertex::Color& color, unsigned int outline)
+    {
+        const bool bold = ((m_style & TextStyle::Bold) != 0);
+        const bool italic = ((m_style & TextStyle::Italic) != 0);
+        const bool underlined = ((m_style & TextStyle::Underlined) != 0);
+        const bool strikeThrough = ((m_style & TextStyle::StrikeThrough) != 0);
+
+        const float ascent = m_font->getAscent(m_characterSize);
+        const float lineThickness = std::max(1.f, std::round(m_font->getUnderlineThickness(m_characterSize)));
+        const float underlineOffset = std::round(m_font->getUnderlinePosition(m_characterSize));
+        const float strikeThroughOffset = std::round(ascent * 0.35f);
+        const float outlineSize = static_cast<float>(outline);
+
+        for (std::size_t lineNr = 0; lineNr < m_lines.size(); ++lineNr)
+        {
+            const float lineTop = static_cast<float>(static_cast<int>(lineNr * lineSpacing));
+
+            float x = 0;
+            char32_t prevChar = U'\0';
+            for (const char32_t currentChar : m_lines[lineNr])
+            {
+                if (currentChar == U'\r')
+                    continue; // We shouldn't render a square if the line contains a '\r'
+
+                // A tab is drawn as empty space with the width of 4 spaces
+                if (currentChar == U'\t')
+                {
+                    if (prevChar != U'\0')
+                        x += m_font->getKerning(prevChar, currentChar, m_characterSize, bold);
+                    prevChar = currentChar;
+
+                    x += getAdvance(currentChar, bold, italic);
+                    continue;
+                }
+
+                // The pen position is always based on the filled glyphs, the outline is placed around them
+                const BackendFontSoftware::AtlasGlyph* glyph = m_font->getAtlasGlyph(currentChar, m_characterSize, bold, italic, 0);
+                if (!glyph)
+                    continue;
+
+                if (prevChar != U'\0')
+                    x += m_font->getKerning(prevChar, currentChar, m_characterSize, bold);
+                prevChar = currentChar;
+
+                const float advance = glyph->advance;
+                if (outline != 0)
+                {
+                    glyph = m_font->getAtlasGlyph(currentChar, m_characterSize, bold, italic, outline);
+                    if (!glyph)
+                    {
+                        x += advance;
+                        continue;
+                    }
+                }
+
+                const UIntRect& rect = glyph->textureRect;
+                if ((rect.width > 0) && (rect.height > 0))
+                {
+                    const float left = x + glyph->offset.x;
+                    const float top = lineTop + glyph->offset.y;
+                    const float right = left + rect.width;
+                    const float bottom = top + rect.height;
+                    const float texLeft = static_cast<float>(rect.left);
+                    const float texTop = static_cast<float>(rect.top);
+                    const float texRight = static_cast<float>(rect.left + rect.width);
+                    const float texBottom = static_cast<float>(rect.top + rect.height);
+
+                    const int firstIndex = static_cast<int>(m_glyphVertices.size());
+                    m_glyphVertices.push_back({{left, top}, color, {texLeft, texTop}});
+                    m_glyphVertices.push_back({{right, top}, color, {texRight, texTop}});
+                    m_glyphVertices.push_back({{left, bottom}, color, {texLeft, texBottom}});
+                    m_glyphVertices.push_back({{right, bottom}, color, {texRight, texBottom}});
+
+                    m_glyphIndices.push_back(firstIndex);
+                    m_glyphIndices.push_back(firstIndex + 2);
+                    m_glyphIndices.push_back(firstIndex + 1);
+                    m_glyphIndices.push_back(firstIndex + 1);
+                    m_glyphIndices.push_back(firstIndex + 2);
+                    m_glyphIndices.push_back(firstIndex + 3);
+                }
+
+                x += advance;
+            }
+
+            if ((x > 0) && underlined)
+                addLineQuad({-outlineSize, lineTop + ascent + underlineOffset - outlineSize, x + 2*outlineSize, lineThickness + 2*outlineSize}, color);
+            if ((x > 0) && strikeThrough)
+                addLineQuad({-outlineSize, lineTop + ascent - strikeThroughOffset - outlineSize, x + 2*outlineSize, lineThickness + 2*outlineSize}, color);
+
+            m_size.x = std::max(m_size.x, x);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextSoftware::addLineQuad(FloatRect rect, const Vertex::Color& color)
+    {
+        // The top-left pixels of the glyph atlas are always fully covered, sampling there draws a solid line
+        const Vector2f texCoords{1, 1};
+
+        const int firstIndex = static_cast<int>(m_glyphVertices.size());
+        m_glyphVertices.push_back({{rect.left, rect.top}, color, texCoords});
+        m_glyphVertices.push_back({{rect.left + rect.width, rect.top}, color, texCoords});
+        m_glyphVertices.push_back({{rect.left, rect.top + rect.height}, color, texCoords});
+        m_glyphVertices.push_back({{rect.left + rect.width, rect.top + rect.height}, color, texCoords});
+
+        m_glyphIndices.push_back(firstIndex);
+        m_glyphIndices.push_back(firstIndex + 2);
+        m_glyphIndices.push_back(firstIndex + 1);
+        m_glyphIndices.push_back(firstIndex + 1);
+        m_glyphIndices.push_back(firstIndex + 2);
+        m_glyphIndices.push_back(firstIndex + 3);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float BackendTextSoftware::getAdvance(char32_t character, bool bold, bool italic) const
+    {
+        if (character == U'\t')
+            return getAdvance(U' ', bold, italic) * 4;
+
+        const BackendFontSoftware::AtlasGlyph* glyph = m_font->getAtlasGlyph(character, m_characterSize, bold, italic, 0);
+        return glyph ? glyph->advance : 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,96 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backends/Software/BackendTextureSoftware.hpp>
+#include <cstring>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels)
+    {
+        const std::size_t byteCount = static_cast<std::size_t>(size.x) * size.y * 4;
+        if (!pixels)
+            pixels = std::make_unique<std::uint8_t[]>(byteCount);
+
+        // Unlike other backends, the pixels are kept because the renderer reads from them while drawing
+        m_pixels = std::move(pixels);
+        m_imageSize = size;
+        createAlphaMask(m_pixels.get());
+        setCpuMemoryUsage(byteCount + m_alphaMaskSize);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::update(Vector2u position, Vector2u size, const std::uint8_t* pixels)
+    {
+        TGUI_ASSERT(m_pixels, "BackendTextureSoftware::update can only be called after the texture was loaded");
+
+        for (unsigned int y = 0; y < size.y; ++y)
+        {
+            std::memcpy(&m_pixels[((static_cast<std::size_t>(position.y) + y) * m_imageSize.x + position.x) * 4],
+                        &pixels[static_cast<std::size_t>(y) * size.x * 4], static_cast<std::size_t>(size.x) * 4);
+        }
+
+        return BackendTextureBase::update(position, size, pixels);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Vector2u BackendTextureSoftware::getSize() const
+    {
+        return m_imageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void BackendTextureSoftware::setSmooth(bool smooth)
+    {
+        m_isSmooth = smooth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool BackendTextureSoftware::isSmooth() const
+    {
+        return m_isSmooth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const std::uint8_t* BackendTextureSoftware::getPixels() const
+    {
+        return m_pixels.get();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
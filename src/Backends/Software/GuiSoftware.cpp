@@ -0,0 +1,136 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/Backends/Software/GuiSoftware.hpp>
+#include <TGUI/Backends/Software/BackendSoftware.hpp>
+#include <TGUI/Backends/Software/BackendRenderTargetSoftware.hpp>
+#include <TGUI/TextureManager.hpp>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GuiSoftware::GuiSoftware()
+    {
+        init();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    GuiSoftware::GuiSoftware(Vector2u size)
+    {
+        init();
+        setSize(size);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiSoftware::setSize(Vector2u size)
+    {
+        if (m_renderTarget)
+            m_renderTarget->setSize(size);
+        else
+        {
+            std::shared_ptr<BackendSoftware> backend = std::dynamic_pointer_cast<BackendSoftware>(getBackend());
+            m_renderTarget = backend->createGuiRenderTarget(this, size);
+        }
+
+        updateContainerSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendRenderTargetSoftware> GuiSoftware::getRenderTarget() const
+    {
+        return m_renderTarget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiSoftware::draw()
+    {
+        if (m_drawUpdatesTime)
+            updateTime();
+
+        TGUI_ASSERT(m_renderTarget != nullptr, "GuiSoftware must be given a size (either at construction or via setSize function) before calling draw()");
+
+        // Images only age when everything is redrawn, widgets outside of the damaged regions still show their images
+        if (!m_damageTrackingEnabled || m_fullRedrawRequired)
+            TextureManager::startFrame();
+
+        if (m_damageTrackingEnabled)
+        {
+            for (const auto& region : takeDamagedRegions())
+                m_renderTarget->drawGuiRegion(m_container, region);
+        }
+        else
+            m_renderTarget->drawGui(m_container);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiSoftware::mainLoop()
+    {
+        TGUI_ASSERT(m_renderTarget != nullptr, "GuiSoftware must be given a size (either at construction or via setSize function) before mainLoop() is called");
+
+        m_renderTarget->clear();
+        draw();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiSoftware::init()
+    {
+        if (!isBackendSet())
+        {
+            setBackend(std::make_shared<BackendSoftware>());
+            getBackend()->setDestroyOnLastGuiDetatch(true);
+        }
+
+        GuiBase::init();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiSoftware::updateContainerSize()
+    {
+        TGUI_ASSERT(m_renderTarget != nullptr, "GuiSoftware must be given a size (either at construction or via setSize function) before updateContainerSize() is called");
+
+        const Vector2u size = m_renderTarget->getSize();
+        m_viewport.updateParentSize({static_cast<float>(size.x), static_cast<float>(size.y)});
+        m_view.updateParentSize({m_viewport.getWidth(), m_viewport.getHeight()});
+        m_renderTarget->setView(m_view.getRect(), m_viewport.getRect());
+        m_container->setSize(Vector2f{m_view.getWidth(), m_view.getHeight()});
+
+        GuiBase::updateContainerSize();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -30,8 +30,10 @@
 #include <TGUI/SubwidgetContainer.hpp>
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/Filesystem.hpp>
+#include <TGUI/BackendRenderTargetRecorder.hpp>
 
 #include <fstream>
+#include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
@@ -43,6 +45,16 @@ namespace tgui
     {
         /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+        // Widgets may look different after handling an event (e.g. when the mouse is on top of them). Containers aren't
+        // marked as damaged as a whole, the event is passed to their child widgets which will then mark themselves.
+        void invalidateBeforeEvent(Widget& widget)
+        {
+            if (!widget.isContainer())
+                widget.invalidate();
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
         void getAllRenderers(std::map<RendererData*, std::vector<const Widget*>>& renderers, const Container* container)
         {
             for (const auto& child : container->getWidgets())
@@ -142,10 +154,34 @@ namespace tgui
             for (const auto& childNode : node->children)
                 makePathsRelativeToForm(childNode, formPath);
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Containers with larger contents are drawn directly instead of via the render cache
+        const unsigned int MaxRenderCacheTextureSize = 4096;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    // The valid flag is cleared by invalidateRenderCache when one of the widgets inside the container changes
+    struct Container::RenderCache
+    {
+        ~RenderCache()
+        {
+            Container::m_renderCacheStatistics.textureMemory -= textureMemory;
+        }
+
+        Sprite sprite;
+        std::size_t textureMemory = 0;
+        bool valid = false;
+        bool drawDirectly = false; // Set when the contents can't be cached, they are drawn directly until they change
+
+    };
+
+    Container::RenderCacheStatistics Container::m_renderCacheStatistics;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Container::Container(const char* typeName, bool initRenderer) :
         Widget{typeName, initRenderer}
     {
@@ -166,6 +202,9 @@ namespace tgui
 
         for (std::size_t i = 0; i < other.m_widgets.size(); ++i)
             widgetAdded(m_widgets[i]);
+
+        if (other.m_renderCache)
+            m_renderCache = std::make_unique<RenderCache>();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -176,7 +215,8 @@ namespace tgui
         m_widgetBelowMouse        {std::move(other.m_widgetBelowMouse)},
         m_widgetWithLeftMouseDown {std::move(other.m_widgetWithLeftMouseDown)},
         m_widgetWithRightMouseDown{std::move(other.m_widgetWithRightMouseDown)},
-        m_focusedWidget           {std::move(other.m_focusedWidget)}
+        m_focusedWidget           {std::move(other.m_focusedWidget)},
+        m_renderCache             {std::move(other.m_renderCache)}
     {
         // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
         // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -227,6 +267,8 @@ namespace tgui
 
             for (std::size_t i = 0; i < right.m_widgets.size(); ++i)
                 widgetAdded(m_widgets[i]);
+
+            m_renderCache = right.m_renderCache ? std::make_unique<RenderCache>() : nullptr;
         }
 
         return *this;
@@ -245,6 +287,7 @@ namespace tgui
             m_widgetWithLeftMouseDown  = std::move(right.m_widgetWithLeftMouseDown);
             m_widgetWithRightMouseDown = std::move(right.m_widgetWithRightMouseDown);
             m_focusedWidget            = std::move(right.m_focusedWidget);
+            m_renderCache              = std::move(right.m_renderCache);
 
             // Parent of all widgets should be set to nullptr first, in case widgets have layouts depending on each other.
             // Otherwise calling setParent on one widget could cause another widget's position to be recalculated which could
@@ -344,6 +387,7 @@ namespace tgui
             }
 
             // Remove the widget
+            widget->invalidate();
             widget->setParent(nullptr);
             m_widgets.erase(m_widgets.begin() + i);
             return true;
@@ -360,7 +404,10 @@ namespace tgui
             m_parentGui->requestMouseCursor(m_mouseCursor);
 
         for (const auto& widget : m_widgets)
+        {
+            widget->invalidate();
             widget->setParent(nullptr);
+        }
 
         m_widgets.clear();
 
@@ -372,6 +419,16 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Vector2f Container::getAbsolutePosition() const
+    {
+        if (m_subwidgetOwner)
+            return m_subwidgetOwner->getAbsolutePosition() + Widget::getAbsolutePosition();
+        else
+            return Widget::getAbsolutePosition();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f Container::getInnerSize() const
     {
         return getSize();
@@ -573,6 +630,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i);
+            widget->invalidate();
             break;
         }
     }
@@ -593,6 +651,7 @@ namespace tgui
 
             // Remove the old widget
             m_widgets.erase(m_widgets.begin() + i + 1);
+            widget->invalidate();
             break;
         }
     }
@@ -611,6 +670,7 @@ namespace tgui
                 return m_widgets.size() - 1;
 
             std::swap(m_widgets[i], m_widgets[i+1]);
+            widget->invalidate();
             return i + 1;
         }
 
@@ -632,6 +692,7 @@ namespace tgui
                 return 0;
 
             std::swap(m_widgets[i-2], m_widgets[i-1]);
+            widget->invalidate();
             return i-2;
         }
 
@@ -791,6 +852,46 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Container::setRenderCacheEnabled(bool enabled)
+    {
+        if (enabled && !m_renderCache)
+            m_renderCache = std::make_unique<RenderCache>();
+        else if (!enabled)
+            m_renderCache = nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Container::isRenderCacheEnabled() const
+    {
+        return m_renderCache != nullptr;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::invalidateRenderCache()
+    {
+        if (m_renderCache)
+            m_renderCache->valid = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Container::RenderCacheStatistics Container::getRenderCacheStatistics()
+    {
+        return m_renderCacheStatistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::resetRenderCacheStatistics()
+    {
+        m_renderCacheStatistics.hits = 0;
+        m_renderCacheStatistics.misses = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Container::childWidgetFocused(const Widget::Ptr& child)
     {
         if (m_focusedWidget != child)
@@ -876,6 +977,7 @@ namespace tgui
 
             if (m_widgetBelowMouse)
             {
+                invalidateBeforeEvent(*m_widgetBelowMouse);
                 m_widgetBelowMouse->mouseNoLongerOnWidget();
                 m_widgetBelowMouse = nullptr;
             }
@@ -890,6 +992,7 @@ namespace tgui
 
         if (m_widgetWithLeftMouseDown)
         {
+            invalidateBeforeEvent(*m_widgetWithLeftMouseDown);
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
         }
@@ -903,6 +1006,7 @@ namespace tgui
 
         if (m_widgetWithRightMouseDown)
         {
+            invalidateBeforeEvent(*m_widgetWithRightMouseDown);
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
             m_widgetWithRightMouseDown = nullptr;
         }
@@ -1019,6 +1123,7 @@ namespace tgui
         {
             if (m_widgetWithLeftMouseDown->isDraggableWidget() || m_widgetWithLeftMouseDown->isContainer())
             {
+                invalidateBeforeEvent(*m_widgetWithLeftMouseDown);
                 m_widgetWithLeftMouseDown->mouseMoved(transformMousePos(m_widgetWithLeftMouseDown, mousePos));
                 return true;
             }
@@ -1029,6 +1134,7 @@ namespace tgui
         if (widget != nullptr)
         {
             // Send the event to the widget
+            invalidateBeforeEvent(*widget);
             widget->mouseMoved(transformMousePos(widget, mousePos));
             return true;
         }
@@ -1058,6 +1164,7 @@ namespace tgui
             if (!widget->isContainer())
                 widget->setFocused(true);
 
+            invalidateBeforeEvent(*widget);
             widget->mousePressed(button, transformMousePos(widget, mousePos));
             return true;
         }
@@ -1084,16 +1191,21 @@ namespace tgui
     {
         Widget::Ptr widgetBelowMouse = mouseOnWhichWidget(mousePos);
         if (widgetBelowMouse != nullptr)
+        {
+            invalidateBeforeEvent(*widgetBelowMouse);
             widgetBelowMouse->mouseReleased(button, transformMousePos(widgetBelowMouse, mousePos));
+        }
 
         if ((button == Event::MouseButton::Left) && m_widgetWithLeftMouseDown)
         {
+            invalidateBeforeEvent(*m_widgetWithLeftMouseDown);
             m_widgetWithLeftMouseDown->leftMouseButtonNoLongerDown();
             m_widgetWithLeftMouseDown = nullptr;
             return true;
         }
         else if ((button == Event::MouseButton::Right) && m_widgetWithRightMouseDown)
         {
+            invalidateBeforeEvent(*m_widgetWithRightMouseDown);
             m_widgetWithRightMouseDown->rightMouseButtonNoLongerDown();
             m_widgetWithRightMouseDown = nullptr;
             return true;
@@ -1109,7 +1221,10 @@ namespace tgui
         // Send the event to the widget below the mouse
         Widget::Ptr widget = mouseOnWhichWidget(pos);
         if (widget != nullptr)
+        {
+            invalidateBeforeEvent(*widget);
             return widget->mouseWheelScrolled(delta, transformMousePos(widget, pos));
+        }
 
         return false;
     }
@@ -1126,6 +1241,7 @@ namespace tgui
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
             // Tell the widget that the key was pressed
+            invalidateBeforeEvent(*m_focusedWidget);
             m_focusedWidget->keyPressed(event);
             return true;
         }
@@ -1144,6 +1260,7 @@ namespace tgui
         // Tell the widget that the key was pressed
         if (m_focusedWidget && m_focusedWidget->isFocused())
         {
+            invalidateBeforeEvent(*m_focusedWidget);
             m_focusedWidget->textEntered(key);
             return true;
         }
@@ -1161,8 +1278,14 @@ namespace tgui
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
         {
             // Update the elapsed time in widgets that need it
-            if (m_widgets[i]->isVisible())
-                screenRefreshRequired |= m_widgets[i]->updateTime(elapsedTime);
+            if (m_widgets[i]->isVisible() && m_widgets[i]->updateTime(elapsedTime))
+            {
+                // Containers only return true because of their child widgets, which are marked as damaged by the container itself
+                if (!m_widgets[i]->isContainer())
+                    m_widgets[i]->invalidate();
+
+                screenRefreshRequired = true;
+            }
         }
 
         m_animationTimeElapsed = {};
@@ -1218,7 +1341,10 @@ namespace tgui
 
         // If the mouse is on a different widget, tell the old widget that the mouse has left
         if (m_widgetBelowMouse && (widgetBelowMouse != m_widgetBelowMouse))
+        {
+            invalidateBeforeEvent(*m_widgetBelowMouse);
             m_widgetBelowMouse->mouseNoLongerOnWidget();
+        }
 
         m_widgetBelowMouse = widgetBelowMouse;
         return widgetBelowMouse;
@@ -1227,6 +1353,16 @@ namespace tgui
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Container::draw(BackendRenderTargetBase& target, RenderStates states) const
+    {
+        if (m_renderCache && drawWidgetsFromRenderCache(target, states))
+            return;
+
+        drawWidgets(target, states);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void Container::drawWidgets(BackendRenderTargetBase& target, const RenderStates& states) const
     {
         for (const auto& widget : m_widgets)
         {
@@ -1254,6 +1390,75 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool Container::drawWidgetsFromRenderCache(BackendRenderTargetBase& target, const RenderStates& states) const
+    {
+        // The cached pixels can only be reused when the container is moved, they wouldn't match when rotating or scaling it
+        const float* transformMatrix = states.transform.getMatrix();
+        if ((transformMatrix[0] != 1) || (transformMatrix[1] != 0) || (transformMatrix[4] != 0) || (transformMatrix[5] != 1))
+            return false;
+
+        RenderCache& cache = *m_renderCache;
+        if (cache.valid)
+        {
+            if (cache.drawDirectly)
+                return false;
+
+            ++m_renderCacheStatistics.hits;
+            target.drawSprite(states, cache.sprite);
+            return true;
+        }
+
+        // The widgets are recorded relative to the container, so that moving the container doesn't invalidate the cache
+        BackendRenderTargetRecorder recorder;
+        drawWidgets(recorder, {});
+
+        const DisplayList& displayList = recorder.getDisplayList();
+
+        // The region is rounded to whole pixels, so that the pixels in the texture line up with the ones on the screen
+        const FloatRect bounds = displayList.getBounds();
+        const float left = std::floor(bounds.left);
+        const float top = std::floor(bounds.top);
+        const float right = std::ceil(bounds.left + bounds.width);
+        const float bottom = std::ceil(bounds.top + bounds.height);
+        const Vector2u size{static_cast<unsigned int>(std::max(0.f, right - left)), static_cast<unsigned int>(std::max(0.f, bottom - top))};
+        if ((size.x > MaxRenderCacheTextureSize) || (size.y > MaxRenderCacheTextureSize))
+        {
+            cache.drawDirectly = true;
+            cache.valid = true;
+            return false;
+        }
+
+        Texture texture;
+        if ((size.x > 0) && (size.y > 0))
+        {
+            const auto pixels = target.drawOffscreen(displayList, {left, top, right - left, bottom - top}, size);
+            if (!pixels)
+            {
+                cache.drawDirectly = true;
+                cache.valid = true;
+                return false;
+            }
+
+            texture.loadFromPixelData(size, pixels.get(), {}, {}, false);
+        }
+
+        m_renderCacheStatistics.textureMemory -= cache.textureMemory;
+        cache.textureMemory = static_cast<std::size_t>(size.x) * size.y * 4;
+        m_renderCacheStatistics.textureMemory += cache.textureMemory;
+        ++m_renderCacheStatistics.misses;
+
+        cache.sprite.setTexture(texture);
+        cache.sprite.setSize({right - left, bottom - top});
+        cache.sprite.setPosition({left, top});
+        cache.drawDirectly = false;
+        cache.valid = true;
+
+        target.drawSprite(states, cache.sprite);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::size_t Container::getFocusedWidgetIndex() const
     {
         for (std::size_t i = 0; i < m_widgets.size(); ++i)
@@ -1348,6 +1553,8 @@ namespace tgui
 
         if (m_textSize != 0)
             widgetPtr->setTextSize(m_textSize);
+
+        widgetPtr->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,836 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/DisplayList.hpp>
+#include <TGUI/Loading/Serializer.hpp>
+#include <TGUI/Loading/Deserializer.hpp>
+#include <TGUI/Exception.hpp>
+#include <TGUI/Global.hpp>
+
+#include <algorithm>
+#include <fstream>
+#include <cstring> // memcpy
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Identifies the file format, the last byte is the version which has to be increased when the format changes
+        const std::uint8_t DisplayListFileHeader[8] = {'T', 'G', 'U', 'I', 'D', 'L', 0, 1};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool areTransformsEqual(const Transform& left, const Transform& right)
+        {
+            return std::equal(left.getMatrix(), left.getMatrix() + 16, right.getMatrix());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool areVerticesEqual(const Vertex& left, const Vertex& right)
+        {
+            return (left.position == right.position) && (left.texCoords == right.texCoords)
+                && (left.color.red == right.color.red) && (left.color.green == right.color.green)
+                && (left.color.blue == right.color.blue) && (left.color.alpha == right.color.alpha);
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        FloatRect uniteRects(const FloatRect& left, const FloatRect& right)
+        {
+            if ((left.width <= 0) || (left.height <= 0))
+                return right;
+            if ((right.width <= 0) || (right.height <= 0))
+                return left;
+
+            const float minX = std::min(left.left, right.left);
+            const float minY = std::min(left.top, right.top);
+            const float maxX = std::max(left.left + left.width, right.left + right.width);
+            const float maxY = std::max(left.top + left.height, right.top + right.height);
+            return {minX, minY, maxX - minX, maxY - minY};
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool areSpritesEqual(const Sprite& left, const Sprite& right)
+        {
+            const Texture& leftTexture = left.getTexture();
+            const Texture& rightTexture = right.getTexture();
+            return (leftTexture.getData() == rightTexture.getData())
+                && (leftTexture.getPartRect() == rightTexture.getPartRect())
+                && (leftTexture.getMiddleRect() == rightTexture.getMiddleRect())
+                && (leftTexture.getColor() == rightTexture.getColor())
+                && (left.getSize() == right.getSize())
+                && (left.getPosition() == right.getPosition())
+                && (left.getRotation() == right.getRotation())
+                && (left.getOpacity() == right.getOpacity())
+                && (left.getVisibleRect() == right.getVisibleRect());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        bool areTextsEqual(const Text& left, const Text& right)
+        {
+            return (left.getString() == right.getString())
+                && (left.getFont() == right.getFont())
+                && (left.getCharacterSize() == right.getCharacterSize())
+                && (left.getColor() == right.getColor())
+                && (left.getOutlineColor() == right.getOutlineColor())
+                && (left.getOutlineThickness() == right.getOutlineThickness())
+                && (static_cast<unsigned int>(left.getStyle()) == static_cast<unsigned int>(right.getStyle()))
+                && (left.getPosition() == right.getPosition())
+                && (left.getOpacity() == right.getOpacity());
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Writes values to a byte buffer in little-endian order, so that files can be exchanged between machines
+        class BinaryWriter
+        {
+        public:
+
+            void writeUint8(std::uint8_t value)
+            {
+                m_data.push_back(value);
+            }
+
+            void writeUint32(std::uint32_t value)
+            {
+                for (unsigned int i = 0; i < 4; ++i)
+                    m_data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+            }
+
+            void writeFloat(float value)
+            {
+                std::uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                writeUint32(bits);
+            }
+
+            void writeString(const String& value)
+            {
+                const std::string utf8 = value.toStdString();
+                writeUint32(static_cast<std::uint32_t>(utf8.size()));
+                m_data.insert(m_data.end(), utf8.begin(), utf8.end());
+            }
+
+            void writeVector(Vector2f value)
+            {
+                writeFloat(value.x);
+                writeFloat(value.y);
+            }
+
+            void writeRect(const FloatRect& rect)
+            {
+                writeFloat(rect.left);
+                writeFloat(rect.top);
+                writeFloat(rect.width);
+                writeFloat(rect.height);
+            }
+
+            void writeColor(const Color& color)
+            {
+                writeUint8(color.getRed());
+                writeUint8(color.getGreen());
+                writeUint8(color.getBlue());
+                writeUint8(color.getAlpha());
+            }
+
+            void writeTransform(const Transform& transform)
+            {
+                // Only the elements that can differ for a 2D transform are stored
+                const float* matrix = transform.getMatrix();
+                for (const unsigned int i : {0, 4, 12, 1, 5, 13})
+                    writeFloat(matrix[i]);
+            }
+
+            const std::vector<std::uint8_t>& getData() const
+            {
+                return m_data;
+            }
+
+        private:
+            std::vector<std::uint8_t> m_data;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the values that were written by BinaryWriter, an exception is thrown when trying to read past the end of the data
+        class BinaryReader
+        {
+        public:
+
+            BinaryReader(const std::uint8_t* data, std::size_t size, const String& filename) :
+                m_data(data),
+                m_size(size),
+                m_filename(filename)
+            {
+            }
+
+            std::uint8_t readUint8()
+            {
+                requireBytes(1);
+                return m_data[m_offset++];
+            }
+
+            std::uint32_t readUint32()
+            {
+                requireBytes(4);
+                std::uint32_t value = 0;
+                for (unsigned int i = 0; i < 4; ++i)
+                    value |= static_cast<std::uint32_t>(m_data[m_offset++]) << (8 * i);
+                return value;
+            }
+
+            float readFloat()
+            {
+                const std::uint32_t bits = readUint32();
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            String readString()
+            {
+                const std::uint32_t length = readUint32();
+                requireBytes(length);
+                const char* begin = reinterpret_cast<const char*>(m_data + m_offset);
+                m_offset += length;
+                return String(std::string(begin, begin + length));
+            }
+
+            Vector2f readVector()
+            {
+                const float x = readFloat();
+                const float y = readFloat();
+                return {x, y};
+            }
+
+            FloatRect readRect()
+            {
+                const float left = readFloat();
+                const float top = readFloat();
+                const float width = readFloat();
+                const float height = readFloat();
+                return {left, top, width, height};
+            }
+
+            Color readColor()
+            {
+                const std::uint8_t red = readUint8();
+                const std::uint8_t green = readUint8();
+                const std::uint8_t blue = readUint8();
+                const std::uint8_t alpha = readUint8();
+                return {red, green, blue, alpha};
+            }
+
+            Transform readTransform()
+            {
+                float values[6];
+                for (float& value : values)
+                    value = readFloat();
+
+                return {values[0], values[1], values[2],
+                        values[3], values[4], values[5],
+                        0.f, 0.f, 1.f};
+            }
+
+            void requireBytes(std::size_t count) const
+            {
+                if (m_size - m_offset < count)
+                    throw Exception{"Failed to load display list from '" + m_filename + "'. Unexpected end of file."};
+            }
+
+        private:
+            const std::uint8_t* m_data;
+            std::size_t m_size;
+            std::size_t m_offset = 0;
+            String m_filename;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::clear()
+    {
+        m_commands.clear();
+        m_transforms.clear();
+        m_clippingRects.clear();
+        m_borders.clear();
+        m_filledRects.clear();
+        m_sprites.clear();
+        m_texts.clear();
+        m_triangles.clear();
+        m_vertices.clear();
+        m_indices.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t DisplayList::getCommandCount() const
+    {
+        return m_commands.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    DisplayList::CommandType DisplayList::getCommandType(std::size_t index) const
+    {
+        TGUI_ASSERT(index < m_commands.size(), "Index out-of-range in DisplayList::getCommandType");
+        return m_commands[index].type;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect DisplayList::getBounds() const
+    {
+        FloatRect bounds;
+        for (std::size_t i = 0; i < m_commands.size(); ++i)
+        {
+            // Clipping layers don't draw anything themselves
+            if (m_commands[i].type != CommandType::AddClippingLayer)
+                bounds = uniteRects(bounds, getCommandBounds(i));
+        }
+
+        return bounds;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::addClippingLayer(const RenderStates& states, FloatRect rect)
+    {
+        addCommand(CommandType::AddClippingLayer, states.transform, m_clippingRects.size());
+        m_clippingRects.push_back(rect);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::removeClippingLayer()
+    {
+        // The command doesn't need a transform, so it reuses the last one to avoid storing another one
+        addCommand(CommandType::RemoveClippingLayer, m_transforms.empty() ? Transform() : m_transforms.back(), 0);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::addBorders(const RenderStates& states, const Borders& borders, Vector2f size, Color color)
+    {
+        addCommand(CommandType::DrawBorders, states.transform, m_borders.size());
+        m_borders.push_back({borders, size, color});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::addFilledRect(const RenderStates& states, Vector2f size, Color color)
+    {
+        addCommand(CommandType::DrawFilledRect, states.transform, m_filledRects.size());
+        m_filledRects.push_back({size, color});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::addSprite(const RenderStates& states, const Sprite& sprite)
+    {
+        addCommand(CommandType::DrawSprite, states.transform, m_sprites.size());
+        m_sprites.push_back(sprite);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::addText(const RenderStates& states, const Text& text)
+    {
+        addCommand(CommandType::DrawText, states.transform, m_texts.size());
+        m_texts.push_back(text);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::addTriangles(const RenderStates& states, const Vertex* vertices, std::size_t vertexCount, const int* indices, std::size_t indexCount)
+    {
+        if (!indices)
+            indexCount = 0;
+
+        addCommand(CommandType::DrawTriangles, states.transform, m_triangles.size());
+        m_triangles.push_back({static_cast<std::uint32_t>(m_vertices.size()), static_cast<std::uint32_t>(vertexCount),
+                               static_cast<std::uint32_t>(m_indices.size()), static_cast<std::uint32_t>(indexCount)});
+
+        m_vertices.insert(m_vertices.end(), vertices, vertices + vertexCount);
+        if (indices)
+            m_indices.insert(m_indices.end(), indices, indices + indexCount);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::replay(BackendRenderTargetBase& target) const
+    {
+        RenderStates states;
+        for (const auto& command : m_commands)
+        {
+            states.transform = m_transforms[command.transformIndex];
+            switch (command.type)
+            {
+            case CommandType::AddClippingLayer:
+                target.addClippingLayer(states, m_clippingRects[command.dataIndex]);
+                break;
+            case CommandType::RemoveClippingLayer:
+                target.removeClippingLayer();
+                break;
+            case CommandType::DrawBorders:
+            {
+                const BordersData& data = m_borders[command.dataIndex];
+                target.drawBorders(states, data.borders, data.size, data.color);
+                break;
+            }
+            case CommandType::DrawFilledRect:
+            {
+                const FilledRectData& data = m_filledRects[command.dataIndex];
+                target.drawFilledRect(states, data.size, data.color);
+                break;
+            }
+            case CommandType::DrawSprite:
+                target.drawSprite(states, m_sprites[command.dataIndex]);
+                break;
+            case CommandType::DrawText:
+                target.drawText(states, m_texts[command.dataIndex]);
+                break;
+            case CommandType::DrawTriangles:
+            {
+                const TrianglesData& data = m_triangles[command.dataIndex];
+                if (data.vertexCount == 0)
+                    break;
+
+                target.drawTriangles(states, &m_vertices[data.firstVertex], data.vertexCount,
+                                     (data.indexCount > 0) ? &m_indices[data.firstIndex] : nullptr, data.indexCount);
+                break;
+            }
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::saveToFile(const String& filename) const
+    {
+        BinaryWriter writer;
+        for (const std::uint8_t byte : DisplayListFileHeader)
+            writer.writeUint8(byte);
+
+        writer.writeUint32(static_cast<std::uint32_t>(m_transforms.size()));
+        for (const auto& transform : m_transforms)
+            writer.writeTransform(transform);
+
+        writer.writeUint32(static_cast<std::uint32_t>(m_commands.size()));
+        for (const auto& command : m_commands)
+        {
+            writer.writeUint8(static_cast<std::uint8_t>(command.type));
+            writer.writeUint32(command.transformIndex);
+            switch (command.type)
+            {
+            case CommandType::AddClippingLayer:
+                writer.writeRect(m_clippingRects[command.dataIndex]);
+                break;
+            case CommandType::RemoveClippingLayer:
+                break;
+            case CommandType::DrawBorders:
+            {
+                const BordersData& data = m_borders[command.dataIndex];
+                writer.writeFloat(data.borders.getLeft());
+                writer.writeFloat(data.borders.getTop());
+                writer.writeFloat(data.borders.getRight());
+                writer.writeFloat(data.borders.getBottom());
+                writer.writeVector(data.size);
+                writer.writeColor(data.color);
+                break;
+            }
+            case CommandType::DrawFilledRect:
+            {
+                const FilledRectData& data = m_filledRects[command.dataIndex];
+                writer.writeVector(data.size);
+                writer.writeColor(data.color);
+                break;
+            }
+            case CommandType::DrawSprite:
+            {
+                // The texture is stored the same way as in widget files, images that weren't loaded from a file are lost
+                const Sprite& sprite = m_sprites[command.dataIndex];
+                writer.writeString(Serializer::serialize(sprite.getTexture()));
+                writer.writeColor(sprite.getTexture().getColor());
+                writer.writeVector(sprite.getSize());
+                writer.writeVector(sprite.getPosition());
+                writer.writeFloat(sprite.getRotation());
+                writer.writeFloat(sprite.getOpacity());
+                writer.writeRect(sprite.getVisibleRect());
+                break;
+            }
+            case CommandType::DrawText:
+            {
+                const Text& text = m_texts[command.dataIndex];
+                writer.writeString(text.getString());
+                writer.writeString(text.getFont().getId());
+                writer.writeUint32(text.getCharacterSize());
+                writer.writeColor(text.getColor());
+                writer.writeColor(text.getOutlineColor());
+                writer.writeFloat(text.getOutlineThickness());
+                writer.writeUint32(text.getStyle());
+                writer.writeVector(text.getPosition());
+                writer.writeFloat(text.getOpacity());
+                break;
+            }
+            case CommandType::DrawTriangles:
+            {
+                const TrianglesData& data = m_triangles[command.dataIndex];
+                writer.writeUint32(data.vertexCount);
+                for (std::size_t i = data.firstVertex; i < data.firstVertex + data.vertexCount; ++i)
+                {
+                    const Vertex& vertex = m_vertices[i];
+                    writer.writeVector(vertex.position);
+                    writer.writeUint8(vertex.color.red);
+                    writer.writeUint8(vertex.color.green);
+                    writer.writeUint8(vertex.color.blue);
+                    writer.writeUint8(vertex.color.alpha);
+                    writer.writeVector(vertex.texCoords);
+                }
+
+                writer.writeUint32(data.indexCount);
+                for (std::size_t i = data.firstIndex; i < data.firstIndex + data.indexCount; ++i)
+                    writer.writeUint32(static_cast<std::uint32_t>(m_indices[i]));
+                break;
+            }
+            }
+        }
+
+        std::ofstream out{filename.toStdString(), std::ios::binary};
+        if (!out.is_open())
+            throw Exception{"Failed to open '" + filename + "' for saving the display list"};
+
+        const std::vector<std::uint8_t>& data = writer.getData();
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::loadFromFile(const String& filename)
+    {
+        std::size_t fileSize;
+        const std::unique_ptr<std::uint8_t[]> fileContents = readFileToMemory(filename, fileSize);
+        if (!fileContents)
+            throw Exception{"Failed to open '" + filename + "' for loading the display list"};
+
+        if ((fileSize < sizeof(DisplayListFileHeader)) || (std::memcmp(fileContents.get(), DisplayListFileHeader, sizeof(DisplayListFileHeader)) != 0))
+            throw Exception{"Failed to load display list from '" + filename + "'. The file has an unsupported format."};
+
+        // The commands are first loaded into a temporary list, so that this list remains unchanged if loading fails
+        DisplayList list;
+        BinaryReader reader{fileContents.get() + sizeof(DisplayListFileHeader), fileSize - sizeof(DisplayListFileHeader), filename};
+
+        const std::uint32_t transformCount = reader.readUint32();
+        for (std::uint32_t i = 0; i < transformCount; ++i)
+            list.m_transforms.push_back(reader.readTransform());
+
+        // Every clipping layer that gets added has to be removed again, otherwise replaying would leave the target in a bad state
+        std::size_t clippingDepth = 0;
+
+        const std::uint32_t commandCount = reader.readUint32();
+        for (std::uint32_t i = 0; i < commandCount; ++i)
+        {
+            const std::uint8_t type = reader.readUint8();
+            const std::uint32_t transformIndex = reader.readUint32();
+            if ((type > static_cast<std::uint8_t>(CommandType::DrawTriangles)) || (transformIndex >= list.m_transforms.size()))
+                throw Exception{"Failed to load display list from '" + filename + "'. The file contains an invalid command."};
+
+            Command command;
+            command.type = static_cast<CommandType>(type);
+            command.transformIndex = transformIndex;
+            switch (command.type)
+            {
+            case CommandType::AddClippingLayer:
+            {
+                command.dataIndex = static_cast<std::uint32_t>(list.m_clippingRects.size());
+                list.m_clippingRects.push_back(reader.readRect());
+                ++clippingDepth;
+                break;
+            }
+            case CommandType::RemoveClippingLayer:
+            {
+                if (clippingDepth == 0)
+                    throw Exception{"Failed to load display list from '" + filename + "'. The file removes a clipping layer that wasn't added."};
+
+                command.dataIndex = 0;
+                --clippingDepth;
+                break;
+            }
+            case CommandType::DrawBorders:
+            {
+                const float left = reader.readFloat();
+                const float top = reader.readFloat();
+                const float right = reader.readFloat();
+                const float bottom = reader.readFloat();
+                const Vector2f size = reader.readVector();
+                const Color color = reader.readColor();
+
+                command.dataIndex = static_cast<std::uint32_t>(list.m_borders.size());
+                list.m_borders.push_back({{left, top, right, bottom}, size, color});
+                break;
+            }
+            case CommandType::DrawFilledRect:
+            {
+                const Vector2f size = reader.readVector();
+                const Color color = reader.readColor();
+
+                command.dataIndex = static_cast<std::uint32_t>(list.m_filledRects.size());
+                list.m_filledRects.push_back({size, color});
+                break;
+            }
+            case CommandType::DrawSprite:
+            {
+                Texture texture = Deserializer::deserialize(ObjectConverter::Type::Texture, reader.readString()).getTexture();
+                texture.setColor(reader.readColor());
+
+                Sprite sprite{texture};
+                sprite.setSize(reader.readVector());
+                sprite.setPosition(reader.readVector());
+                sprite.setRotation(reader.readFloat());
+                sprite.setOpacity(reader.readFloat());
+                sprite.setVisibleRect(reader.readRect());
+
+                command.dataIndex = static_cast<std::uint32_t>(list.m_sprites.size());
+                list.m_sprites.push_back(std::move(sprite));
+                break;
+            }
+            case CommandType::DrawText:
+            {
+                Text text;
+                text.setString(reader.readString());
+
+                const String fontId = reader.readString();
+                text.setFont(fontId.empty() ? Font::getGlobalFont() : Font{fontId});
+
+                text.setCharacterSize(reader.readUint32());
+                text.setColor(reader.readColor());
+                text.setOutlineColor(reader.readColor());
+                text.setOutlineThickness(reader.readFloat());
+                text.setStyle(reader.readUint32());
+                text.setPosition(reader.readVector());
+                text.setOpacity(reader.readFloat());
+
+                command.dataIndex = static_cast<std::uint32_t>(list.m_texts.size());
+                list.m_texts.push_back(std::move(text));
+                break;
+            }
+            case CommandType::DrawTriangles:
+            {
+                TrianglesData data;
+                data.firstVertex = static_cast<std::uint32_t>(list.m_vertices.size());
+                data.vertexCount = reader.readUint32();
+                reader.requireBytes(static_cast<std::size_t>(data.vertexCount) * 20);
+                for (std::uint32_t j = 0; j < data.vertexCount; ++j)
+                {
+                    Vertex vertex;
+                    vertex.position = reader.readVector();
+                    vertex.color.red = reader.readUint8();
+                    vertex.color.green = reader.readUint8();
+                    vertex.color.blue = reader.readUint8();
+                    vertex.color.alpha = reader.readUint8();
+                    vertex.texCoords = reader.readVector();
+                    list.m_vertices.push_back(vertex);
+                }
+
+                data.firstIndex = static_cast<std::uint32_t>(list.m_indices.size());
+                data.indexCount = reader.readUint32();
+                reader.requireBytes(static_cast<std::size_t>(data.indexCount) * 4);
+                for (std::uint32_t j = 0; j < data.indexCount; ++j)
+                {
+                    const std::uint32_t index = reader.readUint32();
+                    if (index >= data.vertexCount)
+                        throw Exception{"Failed to load display list from '" + filename + "'. The file contains an invalid vertex index."};
+
+                    list.m_indices.push_back(static_cast<int>(index));
+                }
+
+                // Commands without vertices don't draw anything, so they aren't stored
+                if (data.vertexCount == 0)
+                    continue;
+
+                command.dataIndex = static_cast<std::uint32_t>(list.m_triangles.size());
+                list.m_triangles.push_back(data);
+                break;
+            }
+            }
+
+            list.m_commands.push_back(command);
+        }
+
+        if (clippingDepth != 0)
+            throw Exception{"Failed to load display list from '" + filename + "'. The file doesn't remove all its clipping layers."};
+
+        *this = std::move(list);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DisplayList::operator==(const DisplayList& other) const
+    {
+        if (m_commands.size() != other.m_commands.size())
+            return false;
+
+        for (std::size_t i = 0; i < m_commands.size(); ++i)
+        {
+            if (!isCommandEqual(i, other, i))
+                return false;
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DisplayList::operator!=(const DisplayList& other) const
+    {
+        return !(*this == other);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void DisplayList::addCommand(CommandType type, const Transform& transform, std::size_t dataIndex)
+    {
+        if (m_transforms.empty() || !areTransformsEqual(m_transforms.back(), transform))
+            m_transforms.push_back(transform);
+
+        m_commands.push_back({type, static_cast<std::uint32_t>(m_transforms.size() - 1), static_cast<std::uint32_t>(dataIndex)});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool DisplayList::isCommandEqual(std::size_t index, const DisplayList& other, std::size_t otherIndex) const
+    {
+        const Command& command = m_commands[index];
+        const Command& otherCommand = other.m_commands[otherIndex];
+        if (command.type != otherCommand.type)
+            return false;
+
+        if ((command.type != CommandType::RemoveClippingLayer)
+         && !areTransformsEqual(m_transforms[command.transformIndex], other.m_transforms[otherCommand.transformIndex]))
+            return false;
+
+        switch (command.type)
+        {
+        case CommandType::AddClippingLayer:
+        {
+            if (m_clippingRects[command.dataIndex] != other.m_clippingRects[otherCommand.dataIndex])
+                return false;
+            break;
+        }
+        case CommandType::RemoveClippingLayer:
+            break;
+        case CommandType::DrawBorders:
+        {
+            const BordersData& data = m_borders[command.dataIndex];
+            const BordersData& otherData = other.m_borders[otherCommand.dataIndex];
+            if ((data.borders != otherData.borders) || (data.size != otherData.size) || (data.color != otherData.color))
+                return false;
+            break;
+        }
+        case CommandType::DrawFilledRect:
+        {
+            const FilledRectData& data = m_filledRects[command.dataIndex];
+            const FilledRectData& otherData = other.m_filledRects[otherCommand.dataIndex];
+            if ((data.size != otherData.size) || (data.color != otherData.color))
+                return false;
+            break;
+        }
+        case CommandType::DrawSprite:
+        {
+            if (!areSpritesEqual(m_sprites[command.dataIndex], other.m_sprites[otherCommand.dataIndex]))
+                return false;
+            break;
+        }
+        case CommandType::DrawText:
+        {
+            if (!areTextsEqual(m_texts[command.dataIndex], other.m_texts[otherCommand.dataIndex]))
+                return false;
+            break;
+        }
+        case CommandType::DrawTriangles:
+        {
+            const TrianglesData& data = m_triangles[command.dataIndex];
+            const TrianglesData& otherData = other.m_triangles[otherCommand.dataIndex];
+            if ((data.vertexCount != otherData.vertexCount) || (data.indexCount != otherData.indexCount))
+                return false;
+
+            if (!std::equal(m_vertices.begin() + data.firstVertex, m_vertices.begin() + data.firstVertex + data.vertexCount,
+                            other.m_vertices.begin() + otherData.firstVertex, areVerticesEqual))
+                return false;
+
+            if (!std::equal(m_indices.begin() + data.firstIndex, m_indices.begin() + data.firstIndex + data.indexCount,
+                            other.m_indices.begin() + otherData.firstIndex))
+                return false;
+            break;
+        }
+        }
+
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FloatRect DisplayList::getCommandBounds(std::size_t index) const
+    {
+        const Command& command = m_commands[index];
+        const Transform& transform = m_transforms[command.transformIndex];
+        switch (command.type)
+        {
+        case CommandType::AddClippingLayer:
+            return transform.transformRect(m_clippingRects[command.dataIndex]);
+        case CommandType::RemoveClippingLayer:
+            return {};
+        case CommandType::DrawBorders:
+            return transform.transformRect({{}, m_borders[command.dataIndex].size});
+        case CommandType::DrawFilledRect:
+            return transform.transformRect({{}, m_filledRects[command.dataIndex].size});
+        case CommandType::DrawSprite:
+            return transform.transformRect(BackendRenderTargetBase::getSpriteBounds(m_sprites[command.dataIndex]));
+        case CommandType::DrawText:
+            return transform.transformRect(BackendRenderTargetBase::getTextBounds(m_texts[command.dataIndex]));
+        case CommandType::DrawTriangles:
+        {
+            const TrianglesData& data = m_triangles[command.dataIndex];
+            if (data.vertexCount == 0)
+                return {};
+
+            return transform.transformRect(BackendRenderTargetBase::getVertexBounds(&m_vertices[data.firstVertex], data.vertexCount));
+        }
+        }
+
+        TGUI_ASSERT(false, "DisplayList::getCommandBounds called with unknown command type");
+        return {};
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -0,0 +1,173 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include <TGUI/FontFileCache.hpp>
+
+#include <cstring>
+#include <map>
+#include <unordered_map>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        using FileContentsPtr = std::weak_ptr<const FontFileCache::FileContents>;
+
+        std::map<String, FileContentsPtr> filesByName;
+        std::unordered_multimap<std::uint64_t, FileContentsPtr> filesByHash; // Fonts loaded from memory, keyed by their hash
+        std::size_t sharedLoadCount = 0;
+
+        // FNV-1a hash of the font data, identical data is only detected for fonts with the same hash
+        std::uint64_t hashData(const std::uint8_t* data, std::size_t size)
+        {
+            std::uint64_t hash = 14695981039346656037u;
+            for (std::size_t i = 0; i < size; ++i)
+            {
+                hash ^= data[i];
+                hash *= 1099511628211u;
+            }
+
+            return hash;
+        }
+
+        template <typename MapType>
+        void removeExpiredFiles(MapType& files)
+        {
+            for (auto it = files.begin(); it != files.end();)
+            {
+                if (it->second.expired())
+                    it = files.erase(it);
+                else
+                    ++it;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::uint64_t FontFileCache::FileContents::getHash() const
+    {
+        if (!m_hashCalculated)
+        {
+            m_hash = hashData(m_data, m_size);
+            m_hashCalculated = true;
+        }
+
+        return m_hash;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const FontFileCache::FileContents> FontFileCache::loadFromFile(const String& filename)
+    {
+        const auto it = filesByName.find(filename);
+        if (it != filesByName.end())
+        {
+            if (auto contents = it->second.lock())
+            {
+                ++sharedLoadCount;
+                return contents;
+            }
+        }
+
+        auto contents = std::make_shared<FileContents>();
+        if (!contents->m_file.open(filename))
+            return nullptr;
+
+        contents->m_data = contents->m_file.getData();
+        contents->m_size = contents->m_file.getSize();
+
+        removeExpiredFiles(filesByName);
+        filesByName[filename] = contents;
+        return contents;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<const FontFileCache::FileContents> FontFileCache::loadFromMemory(const void* data, std::size_t sizeInBytes)
+    {
+        if (!data || (sizeInBytes == 0))
+            return nullptr;
+
+        const auto* bytes = static_cast<const std::uint8_t*>(data);
+        const std::uint64_t hash = hashData(bytes, sizeInBytes);
+
+        const auto range = filesByHash.equal_range(hash);
+        for (auto it = range.first; it != range.second; ++it)
+        {
+            auto contents = it->second.lock();
+            if (contents && (contents->getSize() == sizeInBytes) && (std::memcmp(contents->getData(), bytes, sizeInBytes) == 0))
+            {
+                ++sharedLoadCount;
+                return contents;
+            }
+        }
+
+        auto contents = std::make_shared<FileContents>();
+        contents->m_copy = std::make_unique<std::uint8_t[]>(sizeInBytes);
+        std::memcpy(contents->m_copy.get(), bytes, sizeInBytes);
+        contents->m_data = contents->m_copy.get();
+        contents->m_size = sizeInBytes;
+        contents->m_hash = hash;
+        contents->m_hashCalculated = true;
+
+        removeExpiredFiles(filesByHash);
+        filesByHash.emplace(hash, contents);
+        return contents;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    FontFileCache::Statistics FontFileCache::getStatistics()
+    {
+        Statistics statistics;
+        statistics.sharedLoads = sharedLoadCount;
+
+        const auto addFile = [&statistics](const FileContentsPtr& file){
+            const auto contents = file.lock();
+            if (!contents)
+                return;
+
+            ++statistics.fileCount;
+            if (contents->isMapped())
+                statistics.mappedBytes += contents->getSize();
+            else
+                statistics.copiedBytes += contents->getSize();
+        };
+
+        for (const auto& pair : filesByName)
+            addFile(pair.second);
+        for (const auto& pair : filesByHash)
+            addFile(pair.second);
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
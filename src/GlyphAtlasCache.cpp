@@ -0,0 +1,329 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/GlyphAtlasCache.hpp>
+#include <TGUI/Filesystem.hpp>
+#include <TGUI/MemoryMappedFile.hpp>
+
+#include <cstring>
+#include <fstream>
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    namespace
+    {
+        // Identifies the file format, the last byte is the version which has to be increased when the format changes
+        const std::uint8_t GlyphAtlasCacheFileHeader[8] = {'T', 'G', 'U', 'I', 'G', 'A', 0, 1};
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Writes values in little-endian order
+        class CacheWriter
+        {
+        public:
+
+            void writeUint32(std::uint32_t value)
+            {
+                for (unsigned int i = 0; i < 4; ++i)
+                    m_data.push_back(static_cast<std::uint8_t>(value >> (8 * i)));
+            }
+
+            void writeUint64(std::uint64_t value)
+            {
+                writeUint32(static_cast<std::uint32_t>(value));
+                writeUint32(static_cast<std::uint32_t>(value >> 32));
+            }
+
+            void writeFloat(float value)
+            {
+                std::uint32_t bits;
+                std::memcpy(&bits, &value, sizeof(bits));
+                writeUint32(bits);
+            }
+
+            void writeBytes(const std::uint8_t* bytes, std::size_t count)
+            {
+                m_data.insert(m_data.end(), bytes, bytes + count);
+            }
+
+            void writeString(const String& value)
+            {
+                const std::string utf8 = value.toStdString();
+                writeUint32(static_cast<std::uint32_t>(utf8.size()));
+                writeBytes(reinterpret_cast<const std::uint8_t*>(utf8.data()), utf8.size());
+            }
+
+            const std::vector<std::uint8_t>& getData() const
+            {
+                return m_data;
+            }
+
+        private:
+            std::vector<std::uint8_t> m_data;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Reads the values written by CacheWriter. Instead of throwing, reading past the end of the data marks the reader as
+        // failed and returns zeros, since an unusable cache file is simply ignored.
+        class CacheReader
+        {
+        public:
+
+            CacheReader(const std::uint8_t* data, std::size_t size) :
+                m_data(data),
+                m_size(size)
+            {
+            }
+
+            std::uint32_t readUint32()
+            {
+                if (!requireBytes(4))
+                    return 0;
+
+                std::uint32_t value = 0;
+                for (unsigned int i = 0; i < 4; ++i)
+                    value |= static_cast<std::uint32_t>(m_data[m_offset++]) << (8 * i);
+                return value;
+            }
+
+            std::uint64_t readUint64()
+            {
+                const std::uint64_t low = readUint32();
+                const std::uint64_t high = readUint32();
+                return low | (high << 32);
+            }
+
+            float readFloat()
+            {
+                const std::uint32_t bits = readUint32();
+                float value;
+                std::memcpy(&value, &bits, sizeof(value));
+                return value;
+            }
+
+            const std::uint8_t* readBytes(std::size_t count)
+            {
+                if (!requireBytes(count))
+                    return nullptr;
+
+                const std::uint8_t* bytes = m_data + m_offset;
+                m_offset += count;
+                return bytes;
+            }
+
+            String readString()
+            {
+                const std::uint32_t length = readUint32();
+                const std::uint8_t* bytes = readBytes(length);
+                if (!bytes)
+                    return {};
+
+                return String(std::string(reinterpret_cast<const char*>(bytes), length));
+            }
+
+            bool requireBytes(std::size_t count)
+            {
+                if (m_failed || (m_size - m_offset < count))
+                    m_failed = true;
+
+                return !m_failed;
+            }
+
+            bool isAtEnd() const
+            {
+                return !m_failed && (m_offset == m_size);
+            }
+
+        private:
+            const std::uint8_t* m_data;
+            std::size_t m_size;
+            std::size_t m_offset = 0;
+            bool m_failed = false;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String GlyphAtlasCache::m_directory;
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GlyphAtlasCache::setDirectory(const String& directory)
+    {
+        m_directory = directory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    const String& GlyphAtlasCache::getDirectory()
+    {
+        return m_directory;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String GlyphAtlasCache::getFilename(const String& backendName, std::uint64_t fontHash)
+    {
+        if (m_directory.empty())
+            return {};
+
+        static const char hexDigits[] = "0123456789abcdef";
+        String hashString(16, U'0');
+        for (std::size_t i = 0; i < 16; ++i)
+            hashString[15 - i] = static_cast<char32_t>(hexDigits[(fontHash >> (4 * i)) & 0xF]);
+
+        return (Filesystem::Path(m_directory) / (backendName + U"-" + hashString + U".glyphs")).asString();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GlyphAtlasCache::saveToFile(const String& filename, const String& backendName, std::uint64_t fontHash, const Contents& contents)
+    {
+        TGUI_ASSERT(contents.pixels.size() == static_cast<std::size_t>(contents.atlasSize.x) * contents.atlasSize.y,
+                    "Amount of pixels has to match the atlas size in GlyphAtlasCache::saveToFile");
+
+        CacheWriter writer;
+        writer.writeBytes(GlyphAtlasCacheFileHeader, sizeof(GlyphAtlasCacheFileHeader));
+        writer.writeUint32(TGUI_VERSION_MAJOR);
+        writer.writeUint32(TGUI_VERSION_MINOR);
+        writer.writeUint32(TGUI_VERSION_PATCH);
+        writer.writeString(backendName);
+        writer.writeUint64(fontHash);
+
+        writer.writeUint32(contents.atlasSize.x);
+        writer.writeUint32(contents.atlasSize.y);
+
+        writer.writeUint32(static_cast<std::uint32_t>(contents.rows.size()));
+        for (const auto& row : contents.rows)
+        {
+            writer.writeUint32(row.top);
+            writer.writeUint32(row.height);
+            writer.writeUint32(row.width);
+        }
+
+        writer.writeUint32(static_cast<std::uint32_t>(contents.glyphs.size()));
+        for (const auto& glyph : contents.glyphs)
+        {
+            writer.writeUint64(glyph.key);
+            writer.writeUint32(glyph.textureRect.left);
+            writer.writeUint32(glyph.textureRect.top);
+            writer.writeUint32(glyph.textureRect.width);
+            writer.writeUint32(glyph.textureRect.height);
+            writer.writeFloat(glyph.offset.x);
+            writer.writeFloat(glyph.offset.y);
+            writer.writeFloat(glyph.advance);
+        }
+
+        writer.writeBytes(contents.pixels.data(), contents.pixels.size());
+
+        std::ofstream out{filename.toStdString(), std::ios::binary};
+        if (!out.is_open())
+            return false;
+
+        const std::vector<std::uint8_t>& data = writer.getData();
+        out.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+        return out.good();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GlyphAtlasCache::loadFromFile(const String& filename, const String& backendName, std::uint64_t fontHash, Contents& contents)
+    {
+        const MemoryMappedFile file{filename};
+        if (!file.isOpen())
+            return false;
+
+        CacheReader reader{file.getData(), file.getSize()};
+        const std::uint8_t* header = reader.readBytes(sizeof(GlyphAtlasCacheFileHeader));
+        if (!header || (std::memcmp(header, GlyphAtlasCacheFileHeader, sizeof(GlyphAtlasCacheFileHeader)) != 0))
+            return false;
+
+        // The glyphs depend on how this TGUI version rasterizes them, so caches of other versions are never used
+        const std::uint32_t versionMajor = reader.readUint32();
+        const std::uint32_t versionMinor = reader.readUint32();
+        const std::uint32_t versionPatch = reader.readUint32();
+        if ((versionMajor != TGUI_VERSION_MAJOR) || (versionMinor != TGUI_VERSION_MINOR) || (versionPatch != TGUI_VERSION_PATCH))
+            return false;
+
+        if ((reader.readString() != backendName) || (reader.readUint64() != fontHash))
+            return false;
+
+        Contents newContents;
+        newContents.atlasSize.x = reader.readUint32();
+        newContents.atlasSize.y = reader.readUint32();
+
+        const std::uint32_t rowCount = reader.readUint32();
+        if (!reader.requireBytes(static_cast<std::size_t>(rowCount) * 3 * 4))
+            return false;
+
+        newContents.rows.resize(rowCount);
+        for (auto& row : newContents.rows)
+        {
+            row.top = reader.readUint32();
+            row.height = reader.readUint32();
+            row.width = reader.readUint32();
+            if ((static_cast<std::uint64_t>(row.top) + row.height > newContents.atlasSize.y) || (row.width > newContents.atlasSize.x))
+                return false;
+        }
+
+        const std::uint32_t glyphCount = reader.readUint32();
+        if (!reader.requireBytes(static_cast<std::size_t>(glyphCount) * 9 * 4))
+            return false;
+
+        newContents.glyphs.resize(glyphCount);
+        for (auto& glyph : newContents.glyphs)
+        {
+            glyph.key = reader.readUint64();
+            glyph.textureRect.left = reader.readUint32();
+            glyph.textureRect.top = reader.readUint32();
+            glyph.textureRect.width = reader.readUint32();
+            glyph.textureRect.height = reader.readUint32();
+            glyph.offset.x = reader.readFloat();
+            glyph.offset.y = reader.readFloat();
+            glyph.advance = reader.readFloat();
+
+            if ((static_cast<std::uint64_t>(glyph.textureRect.left) + glyph.textureRect.width > newContents.atlasSize.x)
+             || (static_cast<std::uint64_t>(glyph.textureRect.top) + glyph.textureRect.height > newContents.atlasSize.y))
+                return false;
+        }
+
+        const std::size_t pixelCount = static_cast<std::size_t>(newContents.atlasSize.x) * newContents.atlasSize.y;
+        const std::uint8_t* pixels = reader.readBytes(pixelCount);
+        if (!pixels || !reader.isAtEnd())
+            return false;
+
+        newContents.pixels.assign(pixels, pixels + pixelCount);
+        contents = std::move(newContents);
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
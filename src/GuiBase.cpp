@@ -26,12 +26,32 @@
 #include <TGUI/Backend.hpp>
 #include <TGUI/ToolTip.hpp>
 #include <TGUI/Timer.hpp>
+#include <TGUI/TextureManager.hpp>
 #include <TGUI/BackendRenderTarget.hpp>
 
+#include <cmath>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Redrawing the gui once for each damaged region becomes slower than redrawing a bit more when there are many regions
+        const std::size_t MaxDamagedRegions = 16;
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        FloatRect uniteRects(const FloatRect& left, const FloatRect& right)
+        {
+            const float minX = std::min(left.left, right.left);
+            const float minY = std::min(left.top, right.top);
+            const float maxX = std::max(left.left + left.width, right.left + right.width);
+            const float maxY = std::max(left.top + left.height, right.top + right.height);
+            return {minX, minY, maxX - minX, maxY - minY};
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     GuiBase::~GuiBase()
@@ -455,6 +475,18 @@ namespace tgui
     {
         bool screenRefreshRequired = Timer::updateTime(elapsedTime);
 
+        // Upload images that finished decoding in the background, widgets using them will update in their updateTime function
+        screenRefreshRequired |= TextureManager::updateAsyncLoads();
+
+        // Release images that weren't drawn in the last frame when they take more memory than allowed.
+        // With damage tracking, images only age when everything is redrawn. If the images that were drawn since then still
+        // exceed the budget then everything is redrawn, so that the images that are no longer visible can be found.
+        if (TextureManager::enforceMemoryBudget() && m_damageTrackingEnabled && m_regionsRedrawnSinceFullRedraw)
+        {
+            invalidate();
+            screenRefreshRequired = true;
+        }
+
         if (!m_windowFocused)
             return screenRefreshRequired;
 
@@ -485,6 +517,98 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void GuiBase::setDamageTrackingEnabled(bool enabled)
+    {
+        m_damageTrackingEnabled = enabled;
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool GuiBase::isDamageTrackingEnabled() const
+    {
+        return m_damageTrackingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiBase::invalidate()
+    {
+        m_fullRedrawRequired = true;
+        m_damagedRegions.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<FloatRect> GuiBase::getDamagedRegions() const
+    {
+        if (m_fullRedrawRequired)
+            return {m_lastView};
+
+        return m_damagedRegions;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void GuiBase::addDamagedRegion(FloatRect region)
+    {
+        if (!m_damageTrackingEnabled || m_fullRedrawRequired || (region.width <= 0) || (region.height <= 0))
+            return;
+
+        const float viewportLeft = m_viewport.getLeft();
+        const float viewportTop = m_viewport.getTop();
+        const float viewportWidth = m_viewport.getWidth();
+        const float viewportHeight = m_viewport.getHeight();
+        if ((viewportWidth <= 0) || (viewportHeight <= 0) || (m_lastView.width <= 0) || (m_lastView.height <= 0))
+            return;
+
+        // Round the region outwards to whole pixels, with an extra pixel for anti-aliased edges, and limit it to the viewport.
+        // Regions that line up with pixels don't overlap after being converted to pixels, so no pixel gets drawn twice.
+        const float scaleX = viewportWidth / m_lastView.width;
+        const float scaleY = viewportHeight / m_lastView.height;
+        const float left = std::max(std::floor(viewportLeft + (region.left - m_lastView.left) * scaleX) - 1, std::round(viewportLeft));
+        const float top = std::max(std::floor(viewportTop + (region.top - m_lastView.top) * scaleY) - 1, std::round(viewportTop));
+        const float right = std::min(std::ceil(viewportLeft + (region.left + region.width - m_lastView.left) * scaleX) + 1,
+                                     std::round(viewportLeft + viewportWidth));
+        const float bottom = std::min(std::ceil(viewportTop + (region.top + region.height - m_lastView.top) * scaleY) + 1,
+                                      std::round(viewportTop + viewportHeight));
+        if ((left >= right) || (top >= bottom))
+            return;
+
+        region = {m_lastView.left + (left - viewportLeft) / scaleX, m_lastView.top + (top - viewportTop) / scaleY,
+                  (right - left) / scaleX, (bottom - top) / scaleY};
+
+        // Merge the region with the regions that it overlaps. The merged region may overlap with regions that were already
+        // checked, so the search is repeated until the region no longer grows.
+        bool regionMerged = true;
+        while (regionMerged)
+        {
+            regionMerged = false;
+            for (auto it = m_damagedRegions.begin(); it != m_damagedRegions.end(); ++it)
+            {
+                if (!it->intersects(region))
+                    continue;
+
+                region = uniteRects(region, *it);
+                m_damagedRegions.erase(it);
+                regionMerged = true;
+                break;
+            }
+        }
+
+        m_damagedRegions.push_back(region);
+
+        if (m_damagedRegions.size() > MaxDamagedRegions)
+        {
+            for (const auto& damagedRegion : m_damagedRegions)
+                region = uniteRects(region, damagedRegion);
+
+            m_damagedRegions = {region};
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2f GuiBase::mapPixelToView(int x, int y) const
     {
         return {((x - m_viewport.getLeft()) * (m_view.getWidth() / m_viewport.getWidth())) + m_view.getLeft(),
@@ -512,6 +636,24 @@ namespace tgui
             m_lastView = viewRect;
             onViewChange.emit(m_container.get(), viewRect);
         }
+
+        // The view or viewport may have changed, so the pixels from the previous frame can no longer be reused
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<FloatRect> GuiBase::takeDamagedRegions()
+    {
+        std::vector<FloatRect> damagedRegions = getDamagedRegions();
+        if (m_fullRedrawRequired)
+            m_regionsRedrawnSinceFullRedraw = false;
+        else if (!m_damagedRegions.empty())
+            m_regionsRedrawnSinceFullRedraw = true;
+
+        m_damagedRegions.clear();
+        m_fullRedrawRequired = false;
+        return damagedRegions;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,7 +24,44 @@
 
 
 #include <TGUI/Loading/ImageLoader.hpp>
-#include <TGUI/Global.hpp>
+#include <TGUI/MemoryMappedFile.hpp>
+
+#include <algorithm> // min
+#include <cstring> // memcpy
+#include <new> // nothrow
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace
+{
+    // All memory used by stb_image is allocated with new[], so that the pixels that it returns can be handed to the caller
+    // as a std::unique_ptr<std::uint8_t[]> without having to copy them into a new buffer first.
+    // Memory from new[] on an unsigned char array is suitably aligned for any object that fits in it.
+    void* stbiMalloc(std::size_t size)
+    {
+        return new (std::nothrow) std::uint8_t[size];
+    }
+
+    void stbiFree(void* ptr)
+    {
+        delete[] static_cast<std::uint8_t*>(ptr);
+    }
+
+    void* stbiRealloc(void* ptr, std::size_t oldSize, std::size_t newSize)
+    {
+        std::uint8_t* newPtr = new (std::nothrow) std::uint8_t[newSize];
+        if (!newPtr)
+            return nullptr; // The old memory remains valid, stb_image will free it
+
+        if (ptr)
+        {
+            std::memcpy(newPtr, ptr, std::min(oldSize, newSize));
+            delete[] static_cast<std::uint8_t*>(ptr);
+        }
+
+        return newPtr;
+    }
+}
 
 #if defined(__GNUC__)
 #   pragma GCC diagnostic push
@@ -45,6 +82,9 @@
 #define STB_IMAGE_STATIC
 #define STBI_WINDOWS_UTF8
 #define STB_IMAGE_IMPLEMENTATION
+#define STBI_MALLOC(size) stbiMalloc(size)
+#define STBI_FREE(ptr) stbiFree(ptr)
+#define STBI_REALLOC_SIZED(ptr, oldSize, newSize) stbiRealloc(ptr, oldSize, newSize)
 #include <TGUI/extlibs/stb/stb_image.h>
 
 #if defined(__GNUC__)
@@ -53,8 +93,6 @@
     #pragma warning(pop)
 #endif
 
-#include <cstring> // memcpy
-
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -63,38 +101,29 @@ namespace tgui
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromFile(const String& filename, Vector2u& imageSize)
     {
-        std::size_t fileSize;
-        auto fileContents = readFileToMemory(filename, fileSize);
-        if (!fileContents)
+        const MemoryMappedFile file(filename);
+        if (!file.isOpen())
             return nullptr;
 
-        return loadFromMemory(fileContents.get(), fileSize, imageSize);
+        return loadFromMemory(file.getData(), file.getSize(), imageSize);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::unique_ptr<std::uint8_t[]> ImageLoader::loadFromMemory(const std::uint8_t* data, std::size_t dataSize, Vector2u& imageSize)
     {
-        std::unique_ptr<std::uint8_t[]> pixelData = nullptr;
-
         int imgWidth;
         int imgHeight;
         int imgChannels;
-        stbi_uc* buffer = stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels, 4);
-        if (!buffer)
-            return pixelData;
-
-        if ((imgWidth > 0) && (imgHeight > 0))
-        {
-            const std::size_t pixelDataSize = static_cast<std::size_t>(4 * imgWidth * imgHeight);
-            pixelData = std::make_unique<std::uint8_t[]>(pixelDataSize);
-            std::memcpy(pixelData.get(), buffer, pixelDataSize);
 
-            imageSize.x = static_cast<unsigned int>(imgWidth);
-            imageSize.y = static_cast<unsigned int>(imgHeight);
-        }
+        // The buffer was allocated with new[] (see stbiMalloc), so we can take ownership of it directly
+        std::unique_ptr<std::uint8_t[]> pixelData{
+            stbi_load_from_memory(static_cast<const stbi_uc*>(data), static_cast<int>(dataSize), &imgWidth, &imgHeight, &imgChannels, 4)};
+        if (!pixelData || (imgWidth <= 0) || (imgHeight <= 0))
+            return nullptr;
 
-        stbi_image_free(buffer);
+        imageSize.x = static_cast<unsigned int>(imgWidth);
+        imageSize.y = static_cast<unsigned int>(imgHeight);
         return pixelData;
     }
 
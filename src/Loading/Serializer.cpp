@@ -175,8 +175,11 @@ namespace tgui
             String result = "\"" + texture.getId() + "\"";
             if (texture.getData()->backendTexture)
             {
+                const UIntRect& atlasRect = texture.getData()->atlasRect;
+                const Vector2u imageSize = (atlasRect != UIntRect{}) ? atlasRect.getSize() : texture.getData()->backendTexture->getSize();
+
                 const UIntRect& partRect = texture.getPartRect();
-                if ((partRect != UIntRect{}) && (partRect != UIntRect{{0, 0}, texture.getData()->backendTexture->getSize()}))
+                if ((partRect != UIntRect{}) && (partRect != UIntRect{{0, 0}, imageSize}))
                 {
                     result += " Part(" + String::fromNumber(partRect.left) + ", " + String::fromNumber(partRect.top)
                                 + ", " + String::fromNumber(partRect.width) + ", " + String::fromNumber(partRect.height) + ")";
@@ -0,0 +1,204 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+
+#include <TGUI/MemoryMappedFile.hpp>
+#include <TGUI/Global.hpp>
+
+#if defined(TGUI_SYSTEM_WINDOWS)
+    #include <TGUI/WindowsInclude.hpp>
+#else
+    #include <sys/types.h> // fstat
+    #include <sys/stat.h> // fstat
+    #include <sys/mman.h> // mmap, munmap
+    #include <fcntl.h> // open
+    #include <unistd.h> // close
+#endif
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+namespace tgui
+{
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static const std::uint8_t* mapFile(const String& filename, std::size_t& fileSize)
+    {
+#if defined(TGUI_SYSTEM_WINDOWS)
+        const HANDLE file = CreateFileW(filename.toWideString().c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+            return nullptr;
+
+        LARGE_INTEGER size;
+        if (!GetFileSizeEx(file, &size) || (size.QuadPart <= 0))
+        {
+            CloseHandle(file);
+            return nullptr;
+        }
+
+        // The view keeps the file mapping alive, so the handles can be closed as soon as the view exists
+        const HANDLE mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        CloseHandle(file);
+        if (!mapping)
+            return nullptr;
+
+        const void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+        CloseHandle(mapping);
+        if (!data)
+            return nullptr;
+
+        fileSize = static_cast<std::size_t>(size.QuadPart);
+        return static_cast<const std::uint8_t*>(data);
+#else
+    #ifdef TGUI_SYSTEM_ANDROID
+        // Relative filenames refer to the assets, which can't be mapped
+        if (!filename.empty() && (filename[0] != '/'))
+            return nullptr;
+    #endif
+
+        const int file = ::open(filename.toStdString().c_str(), O_RDONLY);
+        if (file < 0)
+            return nullptr;
+
+        // The file has to be an ordinary file that isn't empty, mmap doesn't support a length of 0
+        struct stat fileInfo;
+        if ((fstat(file, &fileInfo) != 0) || !S_ISREG(fileInfo.st_mode) || (fileInfo.st_size <= 0))
+        {
+            ::close(file);
+            return nullptr;
+        }
+
+        // The mapping remains valid after the file descriptor is closed
+        void* data = mmap(nullptr, static_cast<std::size_t>(fileInfo.st_size), PROT_READ, MAP_PRIVATE, file, 0);
+        ::close(file);
+        if (data == MAP_FAILED)
+            return nullptr;
+
+        fileSize = static_cast<std::size_t>(fileInfo.st_size);
+        return static_cast<const std::uint8_t*>(data);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    static void unmapFile(const std::uint8_t* data, std::size_t fileSize)
+    {
+#if defined(TGUI_SYSTEM_WINDOWS)
+        (void)fileSize;
+        UnmapViewOfFile(data);
+#else
+        munmap(const_cast<std::uint8_t*>(data), fileSize);
+#endif
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryMappedFile::MemoryMappedFile(const String& filename)
+    {
+        open(filename);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryMappedFile::~MemoryMappedFile()
+    {
+        close();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryMappedFile::MemoryMappedFile(MemoryMappedFile&& other) noexcept :
+        m_data        {other.m_data},
+        m_size        {other.m_size},
+        m_mapped      {other.m_mapped},
+        m_fileContents{std::move(other.m_fileContents)}
+    {
+        other.m_data = nullptr;
+        other.m_size = 0;
+        other.m_mapped = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    MemoryMappedFile& MemoryMappedFile::operator=(MemoryMappedFile&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+
+            m_data = other.m_data;
+            m_size = other.m_size;
+            m_mapped = other.m_mapped;
+            m_fileContents = std::move(other.m_fileContents);
+
+            other.m_data = nullptr;
+            other.m_size = 0;
+            other.m_mapped = false;
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool MemoryMappedFile::open(const String& filename)
+    {
+        close();
+
+        std::size_t fileSize = 0;
+        m_data = mapFile(filename, fileSize);
+        if (m_data)
+        {
+            m_size = fileSize;
+            m_mapped = true;
+            return true;
+        }
+
+        // Fall back to reading the file when it couldn't be mapped
+        m_fileContents = readFileToMemory(filename, fileSize);
+        if (!m_fileContents)
+            return false;
+
+        m_data = m_fileContents.get();
+        m_size = fileSize;
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void MemoryMappedFile::close()
+    {
+        if (m_mapped)
+            unmapFile(m_data, m_size);
+
+        m_fileContents = nullptr;
+        m_data = nullptr;
+        m_size = 0;
+        m_mapped = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -148,7 +148,8 @@ namespace tgui
 
     bool Sprite::isSet() const
     {
-        return m_texture.getData() != nullptr;
+        const auto& data = m_texture.getData();
+        return data && !data->loading && (data->svgImage || data->backendTexture);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,21 +361,19 @@ namespace tgui
         Vector2u texCoordOffset;
         if (m_texture.getData()->svgImage)
         {
-            if (!m_svgTexture)
-                m_svgTexture = getBackend()->createTexture();
-
             const Vector2u svgTextureSize{
                 static_cast<unsigned int>(std::round(getSize().x)),
                 static_cast<unsigned int>(std::round(getSize().y))};
 
-            m_texture.getData()->svgImage->rasterize(*m_svgTexture, svgTextureSize);
+            // Sprites showing the same image at the same size share the rasterized texture
+            m_svgTexture = m_texture.getData()->svgImage->getRasterizedTexture(svgTextureSize);
 
             m_scalingType = ScalingType::Normal;
             textureSize = getSize();
         }
         else
         {
-            texCoordOffset = m_texture.getPartRect().getPosition();
+            texCoordOffset = m_texture.getPartRect().getPosition() + m_texture.getData()->atlasRect.getPosition();
             textureSize = Vector2f{m_texture.getPartRect().getSize()};
             middleRect = FloatRect{m_texture.getMiddleRect()};
             if (middleRect == FloatRect(0, 0, textureSize.x, textureSize.y))
@@ -548,8 +547,8 @@ namespace tgui
         {
             for (auto& vertex : m_vertices)
             {
-                vertex.texCoords.x += static_cast<float>(m_texture.getPartRect().left);
-                vertex.texCoords.y += static_cast<float>(m_texture.getPartRect().top);
+                vertex.texCoords.x += static_cast<float>(texCoordOffset.x);
+                vertex.texCoords.y += static_cast<float>(texCoordOffset.y);
             }
         }
     }
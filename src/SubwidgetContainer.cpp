@@ -216,6 +216,7 @@ namespace tgui
     void SubwidgetContainer::setParent(Container* parent)
     {
         Widget::setParent(parent);
+        m_container->m_subwidgetOwner = this;
         m_container->setParentGui(m_parentGui);
     }
 
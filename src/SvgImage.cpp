@@ -25,6 +25,7 @@
 
 #include <TGUI/SvgImage.hpp>
 #include <TGUI/BackendTexture.hpp>
+#include <TGUI/Backend.hpp>
 
 #define NANOSVG_IMPLEMENTATION
 #include "TGUI/extlibs/nanosvg/nanosvg.h"
@@ -32,10 +33,86 @@
 #define NANOSVGRAST_IMPLEMENTATION
 #include "TGUI/extlibs/nanosvg/nanosvgrast.h"
 
+#include <list>
+#include <map>
+#include <utility> // swap
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        struct RasterCacheEntry
+        {
+            const SvgImage* image;
+            Vector2u size;
+            std::shared_ptr<BackendTextureBase> texture;
+        };
+
+        // Rasterized textures of all svg images. The list is ordered from most to least recently used, the map allows
+        // finding the entry of an image at a given size.
+        struct RasterCache
+        {
+            std::list<RasterCacheEntry> entries;
+            std::map<std::pair<const SvgImage*, std::pair<unsigned int, unsigned int>>, std::list<RasterCacheEntry>::iterator> lookup;
+            std::size_t memoryLimit = 8 * 1024 * 1024;
+            SvgImage::RasterCacheStatistics statistics;
+        };
+
+        RasterCache& getRasterCache()
+        {
+            static RasterCache cache;
+            return cache;
+        }
+
+        std::size_t getTextureMemory(Vector2u size)
+        {
+            return static_cast<std::size_t>(size.x) * size.y * 4;
+        }
+
+        // Removes the least recently used textures that are only referenced by the cache until they fit in the memory limit
+        void evictUnusedTextures(RasterCache& cache)
+        {
+            std::size_t unusedMemory = 0;
+            for (const auto& entry : cache.entries)
+            {
+                if (entry.texture.use_count() == 1)
+                    unusedMemory += getTextureMemory(entry.size);
+            }
+
+            auto it = cache.entries.end();
+            while ((unusedMemory > cache.memoryLimit) && (it != cache.entries.begin()))
+            {
+                --it;
+                if (it->texture.use_count() != 1)
+                    continue;
+
+                unusedMemory -= getTextureMemory(it->size);
+                cache.lookup.erase({it->image, {it->size.x, it->size.y}});
+                it = cache.entries.erase(it);
+            }
+        }
+
+        // Removes all textures of an image, the pointer may be reused by another image once it is destroyed
+        void removeFromRasterCache(const SvgImage* image)
+        {
+            RasterCache& cache = getRasterCache();
+            for (auto it = cache.entries.begin(); it != cache.entries.end();)
+            {
+                if (it->image == image)
+                {
+                    cache.lookup.erase({it->image, {it->size.x, it->size.y}});
+                    it = cache.entries.erase(it);
+                }
+                else
+                    ++it;
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     SvgImage::SvgImage(const String& filename)
@@ -51,6 +128,8 @@ namespace tgui
 
     SvgImage::~SvgImage()
     {
+        removeFromRasterCache(this);
+
         if (m_rasterizer)
             nsvgDeleteRasterizer(m_rasterizer);
         if (m_svg)
@@ -59,6 +138,35 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    SvgImage::SvgImage(SvgImage&& other) noexcept :
+        m_svg       {other.m_svg},
+        m_rasterizer{other.m_rasterizer}
+    {
+        other.m_svg = nullptr;
+        other.m_rasterizer = nullptr;
+
+        // Textures that were rasterized from the other object now belong to this one
+        removeFromRasterCache(&other);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SvgImage& SvgImage::operator=(SvgImage&& other) noexcept
+    {
+        if (this != &other)
+        {
+            std::swap(m_svg, other.m_svg);
+            std::swap(m_rasterizer, other.m_rasterizer);
+
+            removeFromRasterCache(this);
+            removeFromRasterCache(&other);
+        }
+
+        return *this;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool SvgImage::isSet() const
     {
         return (m_svg != nullptr);
@@ -94,6 +202,80 @@ namespace tgui
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::shared_ptr<BackendTextureBase> SvgImage::getRasterizedTexture(Vector2u size)
+    {
+        RasterCache& cache = getRasterCache();
+
+        const auto lookupIt = cache.lookup.find({this, {size.x, size.y}});
+        if (lookupIt != cache.lookup.end())
+        {
+            ++cache.statistics.hits;
+            cache.entries.splice(cache.entries.begin(), cache.entries, lookupIt->second);
+            return lookupIt->second->texture;
+        }
+
+        ++cache.statistics.misses;
+
+        auto texture = getBackend()->createTexture();
+        rasterize(*texture, size);
+
+        cache.entries.push_front({this, size, texture});
+        cache.lookup[{this, {size.x, size.y}}] = cache.entries.begin();
+
+        evictUnusedTextures(cache);
+        return texture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::setRasterCacheMemoryLimit(std::size_t bytes)
+    {
+        RasterCache& cache = getRasterCache();
+        cache.memoryLimit = bytes;
+        evictUnusedTextures(cache);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t SvgImage::getRasterCacheMemoryLimit()
+    {
+        return getRasterCache().memoryLimit;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    SvgImage::RasterCacheStatistics SvgImage::getRasterCacheStatistics()
+    {
+        const RasterCache& cache = getRasterCache();
+
+        RasterCacheStatistics statistics = cache.statistics;
+        statistics.textureCount = cache.entries.size();
+        for (const auto& entry : cache.entries)
+            statistics.textureMemory += getTextureMemory(entry.size);
+
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::resetRasterCacheStatistics()
+    {
+        RasterCache& cache = getRasterCache();
+        cache.statistics.hits = 0;
+        cache.statistics.misses = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void SvgImage::clearRasterCache()
+    {
+        RasterCache& cache = getRasterCache();
+        cache.lookup.clear();
+        cache.entries.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 }
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
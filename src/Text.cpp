@@ -27,6 +27,10 @@
 #include <TGUI/Backend.hpp>
 #include <TGUI/BackendText.hpp>
 #include <algorithm>
+#include <array>
+#include <limits>
+#include <thread>
+#include <unordered_map>
 #include <vector>
 #include <cmath>
 
@@ -34,6 +38,153 @@
 
 namespace tgui
 {
+    namespace
+    {
+        // Amount of characters in ASCII-only strings before getLineWidths divides the work over multiple threads.
+        // Below this amount, loading the kerning of all ASCII pairs upfront and starting threads takes longer than it saves.
+        const std::size_t MultithreadedMeasuringMinChars = 1 << 20;
+
+        // Measures lines of text with the same font, character size and style. The advance of each character and the kerning
+        // of ASCII character pairs are only requested from the font once, which is where most of the time is spent otherwise.
+        class LineWidthMeasurer
+        {
+        public:
+
+            LineWidthMeasurer(const Font& font, unsigned int characterSize, bool bold) :
+                m_font(font),
+                m_characterSize(characterSize),
+                m_bold(bold)
+            {
+            }
+
+            // Measures a single line in the same way as Text::getLineWidth
+            float measure(const String& text)
+            {
+                float width = 0;
+                char32_t prevChar = 0;
+                for (const char32_t curChar : text)
+                {
+                    if (curChar == U'\n')
+                        break;
+                    else if (curChar == U'\r')
+                        continue; // Carriage return characters aren't rendered
+
+                    width += getAdvance(curChar) + getKerning(prevChar, curChar);
+                    prevChar = curChar;
+                }
+
+                return width;
+            }
+
+            // Measures a line that only contains ASCII characters without accessing the font. This function can be called
+            // from multiple threads at the same time, but loadAsciiTables has to be called first.
+            float measureAscii(const String& text) const
+            {
+                float width = 0;
+                char32_t prevChar = 0;
+                for (const char32_t curChar : text)
+                {
+                    if (curChar == U'\n')
+                        break;
+                    else if (curChar == U'\r')
+                        continue;
+
+                    width += m_asciiAdvances[curChar] + m_asciiKernings[(prevChar << 7) | curChar];
+                    prevChar = curChar;
+                }
+
+                return width;
+            }
+
+            // Requests the advance and kerning of all ASCII characters from the font
+            void loadAsciiTables()
+            {
+                for (char32_t first = 0; first < 128; ++first)
+                {
+                    getAdvance(first);
+                    for (char32_t second = 0; second < 128; ++second)
+                        getKerning(first, second);
+                }
+            }
+
+            // Returns whether the part of the string that will be measured only contains ASCII characters
+            static bool isAscii(const String& text)
+            {
+                for (const char32_t c : text)
+                {
+                    if (c == U'\n')
+                        return true;
+                    if (c >= 128)
+                        return false;
+                }
+
+                return true;
+            }
+
+        private:
+
+            float getAdvance(char32_t c)
+            {
+                if (c < 128)
+                {
+                    if (!m_asciiAdvancesLoaded[c])
+                    {
+                        m_asciiAdvances[c] = loadAdvance(c);
+                        m_asciiAdvancesLoaded[c] = true;
+                    }
+
+                    return m_asciiAdvances[c];
+                }
+
+                const auto it = m_otherAdvances.find(c);
+                if (it != m_otherAdvances.end())
+                    return it->second;
+
+                const float advance = loadAdvance(c);
+                m_otherAdvances[c] = advance;
+                return advance;
+            }
+
+            float loadAdvance(char32_t c) const
+            {
+                // A tab is as wide as 4 spaces
+                if (c == U'\t')
+                    return m_font.getGlyph(U' ', m_characterSize, m_bold).advance * 4.0f;
+                else
+                    return m_font.getGlyph(c, m_characterSize, m_bold).advance;
+            }
+
+            float getKerning(char32_t first, char32_t second)
+            {
+                if ((first >= 128) || (second >= 128))
+                    return m_font.getKerning(first, second, m_characterSize, m_bold);
+
+                // The table is only allocated when needed, with NaN indicating that the pair wasn't requested yet
+                if (m_asciiKernings.empty())
+                    m_asciiKernings.resize(128 * 128, std::numeric_limits<float>::quiet_NaN());
+
+                float& kerning = m_asciiKernings[(first << 7) | second];
+                if (std::isnan(kerning))
+                    kerning = m_font.getKerning(first, second, m_characterSize, m_bold);
+
+                return kerning;
+            }
+
+        private:
+
+            const Font& m_font;
+            const unsigned int m_characterSize;
+            const bool m_bold;
+
+            std::array<float, 128> m_asciiAdvances;
+            std::array<bool, 128> m_asciiAdvancesLoaded{};
+            std::vector<float> m_asciiKernings; // Index is the first character shifted 7 bits to the left plus the second character
+            std::unordered_map<char32_t, float> m_otherAdvances;
+        };
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Text::Text() :
         m_backendText(getBackend()->createText())
     {
@@ -322,6 +473,79 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::vector<float> Text::getLineWidths(const String* texts, std::size_t count, Font font, unsigned int characterSize,
+                                           TextStyles textStyle, bool allowMultithreading)
+    {
+        std::vector<float> widths(count, 0.0f);
+        if ((font == nullptr) || (count == 0))
+            return widths;
+
+        LineWidthMeasurer measurer{font, characterSize, (textStyle & TextStyle::Bold) != 0};
+
+        const unsigned int threadCount = allowMultithreading ? std::thread::hardware_concurrency() : 1;
+        if (threadCount > 1)
+        {
+            std::vector<std::size_t> asciiIndices;
+            std::size_t asciiCharCount = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                if (LineWidthMeasurer::isAscii(texts[i]))
+                {
+                    asciiIndices.push_back(i);
+                    asciiCharCount += texts[i].length();
+                }
+            }
+
+            if (asciiCharCount >= MultithreadedMeasuringMinChars)
+            {
+                // The fonts can't be accessed from other threads, so everything the threads need is requested upfront
+                measurer.loadAsciiTables();
+
+                const std::size_t chunkSize = (asciiIndices.size() + threadCount - 1) / threadCount;
+                std::vector<std::thread> threads;
+                for (std::size_t start = 0; start < asciiIndices.size(); start += chunkSize)
+                {
+                    const std::size_t end = std::min(start + chunkSize, asciiIndices.size());
+                    threads.emplace_back([&,start,end]{
+                        for (std::size_t i = start; i < end; ++i)
+                            widths[asciiIndices[i]] = measurer.measureAscii(texts[asciiIndices[i]]);
+                    });
+                }
+
+                // Strings containing other characters are measured on this thread, which doesn't interfere with the other
+                // threads because the ASCII tables are already complete and thus aren't modified anymore.
+                std::size_t nextAsciiIndex = 0;
+                for (std::size_t i = 0; i < count; ++i)
+                {
+                    if ((nextAsciiIndex < asciiIndices.size()) && (asciiIndices[nextAsciiIndex] == i))
+                        ++nextAsciiIndex;
+                    else
+                        widths[i] = measurer.measure(texts[i]);
+                }
+
+                for (auto& thread : threads)
+                    thread.join();
+
+                return widths;
+            }
+        }
+
+        for (std::size_t i = 0; i < count; ++i)
+            widths[i] = measurer.measure(texts[i]);
+
+        return widths;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<float> Text::getLineWidths(const std::vector<String>& texts, Font font, unsigned int characterSize,
+                                           TextStyles textStyle, bool allowMultithreading)
+    {
+        return getLineWidths(texts.data(), texts.size(), std::move(font), characterSize, textStyle, allowMultithreading);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     unsigned int Text::findBestTextSize(Font font, float height, int fit)
     {
         if (!font)
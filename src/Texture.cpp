@@ -38,6 +38,45 @@
 
 namespace tgui
 {
+    static void calculateRects(const TextureData& data, const UIntRect& partRect, const UIntRect& middleRect, UIntRect& resultPartRect, UIntRect& resultMiddleRect)
+    {
+        if (partRect == UIntRect{})
+        {
+            if (data.svgImage)
+                resultPartRect = {0, 0, static_cast<unsigned int>(data.svgImage->getSize().x), static_cast<unsigned int>(data.svgImage->getSize().y)};
+            else if (data.atlasRect != UIntRect{})
+                resultPartRect = {0, 0, data.atlasRect.width, data.atlasRect.height};
+            else if (data.backendTexture)
+            {
+                const Vector2u textureSize = data.backendTexture->getSize();
+                resultPartRect = {0, 0, textureSize.x, textureSize.y};
+            }
+            else // Loading the image in the background failed
+                resultPartRect = {};
+        }
+        else
+            resultPartRect = partRect;
+
+        if (middleRect == UIntRect{})
+            resultMiddleRect = {0, 0, resultPartRect.width, resultPartRect.height};
+        else
+        {
+            resultMiddleRect = middleRect;
+
+            // If the middle rect was only partially provided then we need to calculate the width and height ourselves
+            if (((middleRect.left > 0) || (middleRect.top > 0)) && (middleRect.width == 0) && (middleRect.height == 0))
+            {
+                if (resultPartRect.width > 2 * middleRect.left)
+                    resultMiddleRect.width = resultPartRect.width - (2 * middleRect.left);
+
+                if (resultPartRect.width > 2 * middleRect.left)
+                    resultMiddleRect.height = resultPartRect.height - (2 * middleRect.top);
+            }
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool Texture::m_defaultSmooth = true;
 
     Texture::TextureLoaderFunc Texture::m_textureLoader = &TextureManager::getTexture;
@@ -76,6 +115,7 @@ namespace tgui
         m_partRect        {other.m_partRect},
         m_middleRect      {other.m_middleRect},
         m_id              {other.m_id},
+        m_rectsPending    {other.m_rectsPending},
         m_copyCallback    {other.m_copyCallback},
         m_destructCallback{other.m_destructCallback}
     {
@@ -94,6 +134,7 @@ namespace tgui
         m_partRect        {std::move(other.m_partRect)},
         m_middleRect      {std::move(other.m_middleRect)},
         m_id              {std::move(other.m_id)},
+        m_rectsPending    {std::move(other.m_rectsPending)},
         m_copyCallback    {std::move(other.m_copyCallback)},
         m_destructCallback{std::move(other.m_destructCallback)}
     {
@@ -126,6 +167,7 @@ namespace tgui
             std::swap(m_partRect,         temp.m_partRect);
             std::swap(m_middleRect,       temp.m_middleRect);
             std::swap(m_id,               temp.m_id);
+            std::swap(m_rectsPending,     temp.m_rectsPending);
             std::swap(m_copyCallback,     temp.m_copyCallback);
             std::swap(m_destructCallback, temp.m_destructCallback);
         }
@@ -139,6 +181,10 @@ namespace tgui
     {
         if (this != &other)
         {
+            // The image that was used until now has to be released, just like in the destructor
+            if (getData() && (m_destructCallback != nullptr))
+                m_destructCallback(getData());
+
 #if TGUI_HAS_BACKEND_SFML
             m_shader           = std::move(other.m_shader);
 #endif
@@ -147,6 +193,7 @@ namespace tgui
             m_partRect         = std::move(other.m_partRect);
             m_middleRect       = std::move(other.m_middleRect);
             m_id               = std::move(other.m_id);
+            m_rectsPending     = std::move(other.m_rectsPending);
             m_copyCallback     = std::move(other.m_copyCallback);
             m_destructCallback = std::move(other.m_destructCallback);
 
@@ -284,6 +331,17 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    std::shared_ptr<BackendTextureBase> Texture::getBackendTexture() const
+    {
+        if (!m_data)
+            return nullptr;
+
+        TextureManager::useTexture(*m_data);
+        return m_data->backendTexture;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Vector2u Texture::getImageSize() const
     {
         if (!m_data)
@@ -299,6 +357,14 @@ namespace tgui
 
     UIntRect Texture::getPartRect() const
     {
+        if (m_rectsPending && m_data && !m_data->loading)
+        {
+            UIntRect partRect;
+            UIntRect middleRect;
+            calculateRects(*m_data, m_partRect, m_middleRect, partRect, middleRect);
+            return partRect;
+        }
+
         return m_partRect;
     }
 
@@ -344,6 +410,14 @@ namespace tgui
 
     UIntRect Texture::getMiddleRect() const
     {
+        if (m_rectsPending && m_data && !m_data->loading)
+        {
+            UIntRect partRect;
+            UIntRect middleRect;
+            calculateRects(*m_data, m_partRect, m_middleRect, partRect, middleRect);
+            return middleRect;
+        }
+
         return m_middleRect;
     }
 
@@ -351,13 +425,22 @@ namespace tgui
 
     bool Texture::isTransparentPixel(Vector2u pixel) const
     {
-        if (!m_data || !m_data->backendTexture)
+        // An image that was evicted by the texture manager still has its alpha mask, so it doesn't have to be reloaded here
+        if (!m_data || !m_data->backendTexture || m_data->loading)
             return false;
 
         const UIntRect& partRect = getPartRect();
         TGUI_ASSERT(pixel.x < partRect.width && pixel.y < partRect.height, "Texture::isTransparentPixel called with pixel outside texture rectangle");
 
-        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left, pixel.y + partRect.top});
+        return m_data->backendTexture->isTransparentPixel({pixel.x + partRect.left + m_data->atlasRect.left,
+                                                           pixel.y + partRect.top + m_data->atlasRect.top});
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool Texture::isLoading() const
+    {
+        return m_data && m_data->loading;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -450,35 +533,15 @@ namespace tgui
 
         m_data = data;
 
-        if (partRect == UIntRect{})
+        // The size of the image isn't known yet while it is being loaded in the background
+        m_rectsPending = m_data->loading;
+        if (m_rectsPending)
         {
-            if (m_data->svgImage)
-                m_partRect = {0, 0, static_cast<unsigned int>(m_data->svgImage->getSize().x), static_cast<unsigned int>(m_data->svgImage->getSize().y)};
-            else
-            {
-                const Vector2u textureSize = m_data->backendTexture->getSize();
-                m_partRect = {0, 0, textureSize.x, textureSize.y};
-            }
-        }
-        else
             m_partRect = partRect;
-
-        if (middleRect == UIntRect{})
-            m_middleRect = {0, 0, m_partRect.width, m_partRect.height};
-        else
-        {
             m_middleRect = middleRect;
-
-            // If the middle rect was only partially provided then we need to calculate the width and height ourselves
-            if (((middleRect.left > 0) || (middleRect.top > 0)) && (middleRect.width == 0) && (middleRect.height == 0))
-            {
-                if (m_partRect.width > 2 * middleRect.left)
-                    m_middleRect.width = m_partRect.width - (2 * middleRect.left);
-
-                if (m_partRect.width > 2 * middleRect.left)
-                    m_middleRect.height = m_partRect.height - (2 * middleRect.top);
-            }
         }
+        else
+            calculateRects(*m_data, partRect, middleRect, m_partRect, m_middleRect);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -28,12 +28,228 @@
 #include <TGUI/Backend.hpp>
 #include <TGUI/Exception.hpp>
 
+#include <algorithm>
+#include <condition_variable>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <thread>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Backend texture that only keeps the pixels in memory. It is used to read images that will be copied into an atlas
+        // page and to decode images on worker threads, as it doesn't need the backend. An empty one acts as placeholder.
+        class CpuImageTexture : public BackendTextureBase
+        {
+        public:
+            Vector2u getSize() const override
+            {
+                return m_imageSize;
+            }
+
+            void setSmooth(bool smooth) override
+            {
+                m_smooth = smooth;
+            }
+
+            bool isSmooth() const override
+            {
+                return m_smooth;
+            }
+
+            bool load(Vector2u size, std::unique_ptr<std::uint8_t[]> pixels) override
+            {
+                m_imageSize = size;
+                m_pixels = std::move(pixels);
+                return true;
+            }
+
+            std::unique_ptr<std::uint8_t[]> takePixels()
+            {
+                return std::move(m_pixels);
+            }
+
+        private:
+            std::unique_ptr<std::uint8_t[]> m_pixels;
+            bool m_smooth = true;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // An image that is being loaded in the background
+        struct AsyncLoadJob
+        {
+            // Filled in on the gui thread before the job is queued
+            std::weak_ptr<TextureData> data;
+            String filename;
+            bool smooth = true;
+            bool isSvg = false;
+            Texture::BackendTextureLoaderFunc loader;
+
+            // Filled in by the worker thread
+            bool loaderSucceeded = false;
+            Vector2u imageSize;
+            std::unique_ptr<std::uint8_t[]> pixels;
+            std::unique_ptr<SvgImage> svgImage;
+        };
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Pool of worker threads that read and decode images. Only the data of the job is touched on the worker threads,
+        // textures are created on the gui thread when the finished jobs are taken.
+        class AsyncImageLoader
+        {
+        public:
+            ~AsyncImageLoader()
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_stopping = true;
+                }
+
+                m_jobQueued.notify_all();
+                for (auto& thread : m_threads)
+                    thread.join();
+            }
+
+            void addJob(std::unique_ptr<AsyncLoadJob> job)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(m_mutex);
+                    m_queuedJobs.push_back(std::move(job));
+                    ++m_pendingCount;
+
+                    // Threads are only started when there is work for them
+                    const unsigned int cores = std::thread::hardware_concurrency();
+                    const std::size_t maxThreads = (cores > 2) ? std::min(cores - 1, 4u) : 1u;
+                    if ((m_threads.size() < maxThreads) && (m_threads.size() < m_pendingCount))
+                        m_threads.emplace_back([this]{ run(); });
+                }
+
+                m_jobQueued.notify_one();
+            }
+
+            std::vector<std::unique_ptr<AsyncLoadJob>> takeFinishedJobs(bool wait)
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                if (wait)
+                    m_jobFinished.wait(lock, [this]{ return m_finishedJobs.size() == m_pendingCount; });
+
+                std::vector<std::unique_ptr<AsyncLoadJob>> finishedJobs;
+                finishedJobs.swap(m_finishedJobs);
+                m_pendingCount -= finishedJobs.size();
+                return finishedJobs;
+            }
+
+            std::size_t getPendingCount()
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                return m_pendingCount;
+            }
+
+        private:
+            void run()
+            {
+                while (true)
+                {
+                    std::unique_ptr<AsyncLoadJob> job;
+                    {
+                        std::unique_lock<std::mutex> lock(m_mutex);
+                        m_jobQueued.wait(lock, [this]{ return m_stopping || !m_queuedJobs.empty(); });
+                        if (m_stopping)
+                            return;
+
+                        job = std::move(m_queuedJobs.front());
+                        m_queuedJobs.pop_front();
+                    }
+
+                    decode(*job);
+
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        m_finishedJobs.push_back(std::move(job));
+                    }
+
+                    m_jobFinished.notify_all();
+                }
+            }
+
+            static void decode(AsyncLoadJob& job)
+            {
+                // The loader may be a custom function and reading the svg may fail (e.g. when running out of memory),
+                // an exception must not escape from the worker thread
+                try
+                {
+                    if (job.isSvg)
+                    {
+                        job.svgImage = std::make_unique<SvgImage>(job.filename);
+                        return;
+                    }
+
+                    CpuImageTexture image;
+                    job.loaderSucceeded = job.loader(image, job.filename);
+                    if (job.loaderSucceeded)
+                    {
+                        job.imageSize = image.getSize();
+                        job.pixels = image.takePixels();
+                    }
+                }
+                catch (...)
+                {
+                    job.svgImage = nullptr;
+                    job.loaderSucceeded = false;
+                }
+            }
+
+        private:
+            std::mutex m_mutex;
+            std::condition_variable m_jobQueued;
+            std::condition_variable m_jobFinished;
+            std::vector<std::thread> m_threads;
+            std::deque<std::unique_ptr<AsyncLoadJob>> m_queuedJobs;
+            std::vector<std::unique_ptr<AsyncLoadJob>> m_finishedJobs;
+            std::size_t m_pendingCount = 0; // Jobs that were added but weren't taken from the finished list yet
+            bool m_stopping = false;
+        };
+
+        AsyncImageLoader& getAsyncImageLoader()
+        {
+            static AsyncImageLoader loader;
+            return loader;
+        }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // Returns the memory used by an image that has a texture of its own, images in atlas pages are counted with their page
+        std::size_t getOwnTextureBytes(const TextureData& data)
+        {
+            if (data.loading || data.evicted || data.svgImage || !data.backendTexture || (data.atlasRect != UIntRect{}))
+                return 0;
+
+            const Vector2u size = data.backendTexture->getSize();
+            return static_cast<std::size_t>(size.x) * size.y * 4;
+        }
+    }
+
     std::map<String, std::list<TextureDataHolder>> TextureManager::m_imageMap;
 
+    bool TextureManager::m_atlasEnabled = false;
+    unsigned int TextureManager::m_atlasPageSize = 1024;
+    std::vector<TextureManager::AtlasPage> TextureManager::m_atlasPages;
+
+    bool TextureManager::m_asyncLoadingEnabled = false;
+    std::function<void(const String& filename, bool success)> TextureManager::m_asyncLoadFinishedCallback;
+
+    std::size_t TextureManager::m_memoryBudget = 0;
+    std::size_t TextureManager::m_residentBytes = 0;
+    std::uint64_t TextureManager::m_frameCounter = 1;
+    std::size_t TextureManager::m_evictionCount = 0;
+    std::size_t TextureManager::m_reloadCount = 0;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::shared_ptr<TextureData> TextureManager::getTexture(Texture& texture, const String& filename, bool smooth)
@@ -51,8 +267,10 @@ namespace tgui
             // Loop all our textures to find the one containing the image
             for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
             {
-                // We can reuse everything only if the image is loaded with the same settings
-                if (dataIt->smooth == smooth)
+                // We can reuse everything only if the image is loaded with the same settings.
+                // An image that failed to load in the background is skipped so that loading it is tried again.
+                const TextureData& existingData = *dataIt->data;
+                if ((dataIt->smooth == smooth) && (existingData.loading || existingData.svgImage || existingData.backendTexture))
                 {
                     // The exact same texture is now used at multiple places
                     ++(dataIt->users);
@@ -71,27 +289,58 @@ namespace tgui
         dataHolder.filename = filename;
         dataHolder.users = 1;
         dataHolder.smooth = smooth;
+        dataHolder.loader = texture.getBackendTextureLoader();
         dataHolder.data = std::make_shared<TextureData>();
+        dataHolder.data->lastUsedFrame = m_frameCounter;
+        dataHolder.data->managed = true;
+        dataHolder.data->imageMapIt = imageIt;
+        dataHolder.data->holderIt = std::prev(imageIt->second.end());
 
         // Load the image
         auto data = imageIt->second.back().data;
-        if (isSvg)
+        if (m_asyncLoadingEnabled)
+        {
+            // Return a placeholder immediately, the image will be finished in updateAsyncLoads once a worker thread decoded it
+            data->loading = true;
+            data->backendTexture = std::make_shared<CpuImageTexture>();
+            data->backendTexture->setSmooth(smooth);
+
+            auto job = std::make_unique<AsyncLoadJob>();
+            job->data = data;
+            job->filename = filename;
+            job->smooth = smooth;
+            job->isSvg = isSvg;
+            job->loader = texture.getBackendTextureLoader();
+            getAsyncImageLoader().addJob(std::move(job));
+            return data;
+        }
+        else if (isSvg)
         {
             data->svgImage.emplace(filename);
             if (data->svgImage->isSet())
                 return data;
         }
+        else if (m_atlasEnabled)
+        {
+            if (loadIntoAtlas(texture, *data, filename, smooth))
+            {
+                m_residentBytes += getOwnTextureBytes(*data);
+                return data;
+            }
+        }
         else // Not an svg
         {
             data->backendTexture = getBackend()->createTexture();
             if (texture.getBackendTextureLoader()(*data->backendTexture, filename))
             {
                 data->backendTexture->setSmooth(smooth);
+                m_residentBytes += getOwnTextureBytes(*data);
                 return data;
             }
         }
 
         // The image could not be loaded
+        data->managed = false;
         if (imageIt->second.size() > 1)
             imageIt->second.pop_back();
         else
@@ -104,57 +353,538 @@ namespace tgui
 
     void TextureManager::copyTexture(std::shared_ptr<TextureData> textureDataToCopy)
     {
-        // Loop all our textures to check if we already have this one
-        for (auto& dataHolder : m_imageMap)
+        if (!textureDataToCopy || !textureDataToCopy->managed)
+            throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+
+        // The texture is now used at multiple places
+        ++(textureDataToCopy->holderIt->users);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    {
+        if (!textureDataToRemove || !textureDataToRemove->managed)
+            throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+
+        // If this was the only place where the texture is used then delete it
+        TextureData& data = *textureDataToRemove;
+        if (--(data.holderIt->users) == 0)
+        {
+            m_residentBytes -= getOwnTextureBytes(data);
+            if (data.atlasRect != UIntRect{})
+                removeFromAtlas(data);
+
+            const auto imageIt = data.imageMapIt;
+            imageIt->second.erase(data.holderIt);
+            if (imageIt->second.empty())
+                m_imageMap.erase(imageIt);
+
+            data.managed = false;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getCachedImagesCount()
+    {
+        return m_imageMap.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasEnabled(bool enabled)
+    {
+        m_atlasEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAtlasEnabled()
+    {
+        return m_atlasEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAtlasPageSize(unsigned int size)
+    {
+        TGUI_ASSERT(size > 2, "TextureManager::setAtlasPageSize called with a size that can't contain any image");
+        m_atlasPageSize = size;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int TextureManager::getAtlasPageSize()
+    {
+        return m_atlasPageSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAtlasPageCount()
+    {
+        return m_atlasPages.size();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    float TextureManager::getAtlasFillRatio()
+    {
+        std::size_t usedArea = 0;
+        std::size_t totalArea = 0;
+        for (const auto& page : m_atlasPages)
+        {
+            usedArea += page.usedArea;
+            totalArea += static_cast<std::size_t>(page.size) * page.size;
+        }
+
+        if (totalArea == 0)
+            return 0;
+
+        return static_cast<float>(usedArea) / static_cast<float>(totalArea);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncLoadingEnabled(bool enabled)
+    {
+        m_asyncLoadingEnabled = enabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::isAsyncLoadingEnabled()
+    {
+        return m_asyncLoadingEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::setAsyncLoadFinishedCallback(const std::function<void(const String& filename, bool success)>& func)
+    {
+        m_asyncLoadFinishedCallback = func;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getAsyncLoadsPending()
+    {
+        return getAsyncImageLoader().getPendingCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::updateAsyncLoads(bool wait)
+    {
+        const auto finishedJobs = getAsyncImageLoader().takeFinishedJobs(wait);
+        for (const auto& job : finishedJobs)
         {
-            for (auto& data : dataHolder.second)
+            // Skip the image if the texture was already removed while it was being loaded
+            const auto data = job->data.lock();
+            if (!data)
+                continue;
+
+            bool success = false;
+            if (job->svgImage)
+            {
+                if (job->svgImage->isSet())
+                {
+                    data->svgImage = std::move(*job->svgImage);
+                    data->backendTexture = nullptr;
+                    success = true;
+                }
+            }
+            else if (job->pixels && (job->imageSize.x > 0) && (job->imageSize.y > 0))
+            {
+                if (m_atlasEnabled)
+                    success = addToAtlas(*data, job->imageSize, std::move(job->pixels), job->smooth);
+                else
+                {
+                    auto backendTexture = getBackend()->createTexture();
+                    if (backendTexture->load(job->imageSize, std::move(job->pixels)))
+                    {
+                        backendTexture->setSmooth(job->smooth);
+                        data->backendTexture = backendTexture;
+                        success = true;
+                    }
+                }
+            }
+            else if (job->loaderSucceeded)
             {
-                // Check if the pointer points to our texture
-                if (data.data == textureDataToCopy)
+                // A custom loader might not pass the pixels to the texture, in which case it has to load on this thread
+                auto backendTexture = getBackend()->createTexture();
+                if (job->loader(*backendTexture, job->filename))
                 {
-                    // The texture is now used at multiple places
-                    ++data.users;
-                    return;
+                    backendTexture->setSmooth(job->smooth);
+                    data->backendTexture = backendTexture;
+                    success = true;
                 }
             }
+
+            if (!success)
+                data->backendTexture = nullptr;
+
+            data->loading = false;
+            data->lastUsedFrame = m_frameCounter;
+
+            // A texture that was removed while its image was loading is no longer counted
+            if (data->managed)
+                m_residentBytes += getOwnTextureBytes(*data);
+
+            if (m_asyncLoadFinishedCallback)
+                m_asyncLoadFinishedCallback(job->filename, success);
         }
 
-        throw Exception{"Trying to copy texture data that was not loaded by the TextureManager."};
+        return !finishedJobs.empty();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void TextureManager::removeTexture(std::shared_ptr<TextureData> textureDataToRemove)
+    void TextureManager::setMemoryBudget(std::size_t bytes)
+    {
+        m_memoryBudget = bytes;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::getMemoryBudget()
+    {
+        return m_memoryBudget;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextureManager::MemoryStatistics TextureManager::getMemoryStatistics()
     {
-        // Loop all our textures to check which one it is
-        for (auto imageIt = m_imageMap.begin(); imageIt != m_imageMap.end(); ++imageIt)
+        MemoryStatistics statistics;
+        statistics.residentBytes = m_residentBytes;
+        statistics.evictions = m_evictionCount;
+        statistics.reloads = m_reloadCount;
+        return statistics;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::resetMemoryStatistics()
+    {
+        m_evictionCount = 0;
+        m_reloadCount = 0;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::enforceMemoryBudget()
+    {
+        if (m_memoryBudget > 0)
         {
-            for (auto dataIt = imageIt->second.begin(); dataIt != imageIt->second.end(); ++dataIt)
+            if (m_residentBytes > m_memoryBudget)
             {
-                // Check if the pointer points to our texture
-                if (dataIt->data == textureDataToRemove)
+                // Images that were drawn in the last frame are still visible and are never evicted
+                std::vector<TextureDataHolder*> candidates;
+                for (auto& pair : m_imageMap)
                 {
-                    // If this was the only place where the texture is used then delete it
-                    if (--(dataIt->users) == 0)
+                    for (auto& dataHolder : pair.second)
                     {
-                        imageIt->second.erase(dataIt);
-                        if (imageIt->second.empty())
-                            m_imageMap.erase(imageIt);
+                        if ((dataHolder.data->lastUsedFrame < m_frameCounter) && dataHolder.loader && (getOwnTextureBytes(*dataHolder.data) > 0))
+                            candidates.push_back(&dataHolder);
                     }
+                }
 
-                    return;
+                std::sort(candidates.begin(), candidates.end(), [](const TextureDataHolder* left, const TextureDataHolder* right)
+                    { return left->data->lastUsedFrame < right->data->lastUsedFrame; });
+
+                for (auto* dataHolder : candidates)
+                {
+                    if (m_residentBytes <= m_memoryBudget)
+                        break;
+
+                    TextureData& data = *dataHolder->data;
+                    m_residentBytes -= getOwnTextureBytes(data);
+
+                    // Replace the texture by one that only remembers the size and which pixels are transparent,
+                    // so that the image keeps its layout and still ignores mouse events on its transparent pixels
+                    auto placeholder = std::make_shared<CpuImageTexture>();
+                    placeholder->load(data.backendTexture->getSize(), nullptr);
+                    placeholder->takeAlphaMask(*data.backendTexture);
+                    placeholder->setSmooth(dataHolder->smooth);
+                    data.backendTexture = placeholder;
+                    data.evicted = true;
+                    ++m_evictionCount;
                 }
             }
         }
 
-        throw Exception{"Trying to remove a texture that was not loaded by the TextureManager."};
+        return (m_memoryBudget > 0) && (m_residentBytes > m_memoryBudget);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    std::size_t TextureManager::getCachedImagesCount()
+    void TextureManager::startFrame()
     {
-        return m_imageMap.size();
+        ++m_frameCounter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::useTexture(TextureData& data)
+    {
+        data.lastUsedFrame = m_frameCounter;
+        if (data.evicted)
+            reloadTexture(data);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::reloadTexture(TextureData& data)
+    {
+        data.evicted = false;
+
+        // The texture data no longer belongs to the texture manager, there is nothing to reload it from
+        if (!data.managed)
+            return;
+
+        const TextureDataHolder& dataHolder = *data.holderIt;
+        const Vector2u size = data.backendTexture->getSize();
+        auto backendTexture = getBackend()->createTexture();
+        if (!dataHolder.loader(*backendTexture, dataHolder.filename) || (backendTexture->getSize() != size))
+        {
+            // The file was changed or removed since it was first loaded. The widgets were laid out for the original image,
+            // so a transparent image of the same size is shown instead.
+            backendTexture = getBackend()->createTexture();
+            backendTexture->load(size, std::make_unique<std::uint8_t[]>(static_cast<std::size_t>(size.x) * size.y * 4));
+        }
+
+        backendTexture->setSmooth(dataHolder.smooth);
+        data.backendTexture = backendTexture;
+        m_residentBytes += getOwnTextureBytes(data);
+        ++m_reloadCount;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::loadIntoAtlas(Texture& texture, TextureData& data, const String& filename, bool smooth)
+    {
+        CpuImageTexture image;
+        if (!texture.getBackendTextureLoader()(image, filename))
+            return false;
+
+        const Vector2u imageSize = image.getSize();
+        auto imagePixels = image.takePixels();
+
+        // A custom loader might not pass the pixels to the texture, in which case the image can't be copied into a page
+        if (!imagePixels || (imageSize.x == 0) || (imageSize.y == 0))
+        {
+            data.backendTexture = getBackend()->createTexture();
+            if (!texture.getBackendTextureLoader()(*data.backendTexture, filename))
+                return false;
+
+            data.backendTexture->setSmooth(smooth);
+            return true;
+        }
+
+        return addToAtlas(data, imageSize, std::move(imagePixels), smooth);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool TextureManager::addToAtlas(TextureData& data, Vector2u imageSize, std::unique_ptr<std::uint8_t[]> imagePixels, bool smooth)
+    {
+        // Large images get their own texture, they would fill the pages too quickly.
+        // The image is surrounded by a border of 1 pixel to prevent neighbouring images from bleeding into it when smoothing.
+        const Vector2u paddedSize{imageSize.x + 2, imageSize.y + 2};
+        if ((paddedSize.x > m_atlasPageSize) || (paddedSize.y > m_atlasPageSize)
+         || (static_cast<std::size_t>(imageSize.x) * imageSize.y > static_cast<std::size_t>(m_atlasPageSize) * m_atlasPageSize / 4))
+        {
+            data.backendTexture = getBackend()->createTexture();
+            if (!data.backendTexture->load(imageSize, std::move(imagePixels)))
+                return false;
+
+            data.backendTexture->setSmooth(smooth);
+            return true;
+        }
+
+        Vector2u position;
+        const std::size_t pageIndex = findAtlasSpace(paddedSize, smooth, position);
+        AtlasPage& page = m_atlasPages[pageIndex];
+
+        // A new page is created empty, only the parts that are filled with images are uploaded
+        if (page.texture->getSize() != Vector2u{page.size, page.size})
+        {
+            if (!page.texture->load({page.size, page.size}, nullptr))
+            {
+                m_residentBytes -= static_cast<std::size_t>(page.size) * page.size * 4;
+                m_atlasPages.erase(m_atlasPages.begin() + static_cast<std::ptrdiff_t>(pageIndex));
+                return false;
+            }
+
+            page.texture->setSmooth(page.smooth);
+        }
+
+        // Surround the image with a copy of its outer pixels
+        auto paddedPixels = std::make_unique<std::uint8_t[]>(static_cast<std::size_t>(paddedSize.x) * paddedSize.y * 4);
+        for (unsigned int y = 0; y < paddedSize.y; ++y)
+        {
+            const unsigned int srcY = std::min(std::max(y, 1u) - 1, imageSize.y - 1);
+            const std::uint8_t* src = &imagePixels[static_cast<std::size_t>(srcY) * imageSize.x * 4];
+            std::uint8_t* dest = &paddedPixels[static_cast<std::size_t>(y) * paddedSize.x * 4];
+
+            std::memcpy(dest, src, 4);
+            std::memcpy(dest + 4, src, static_cast<std::size_t>(imageSize.x) * 4);
+            std::memcpy(dest + (static_cast<std::size_t>(imageSize.x) + 1) * 4, src + (static_cast<std::size_t>(imageSize.x) - 1) * 4, 4);
+        }
+
+        if (!page.texture->update(position, paddedSize, paddedPixels.get()))
+        {
+            addFreeAtlasSpace(page, {position.x, position.y, paddedSize.x, paddedSize.y});
+            if (page.imageCount == 0)
+            {
+                m_residentBytes -= static_cast<std::size_t>(page.size) * page.size * 4;
+                m_atlasPages.erase(m_atlasPages.begin() + static_cast<std::ptrdiff_t>(pageIndex));
+            }
+
+            return false;
+        }
+
+        page.usedArea += static_cast<std::size_t>(imageSize.x) * imageSize.y;
+        ++page.imageCount;
+
+        data.backendTexture = page.texture;
+        data.atlasRect = {position.x + 1, position.y + 1, imageSize.x, imageSize.y};
+        return true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t TextureManager::findAtlasSpace(Vector2u size, bool smooth, Vector2u& position)
+    {
+        for (std::size_t i = 0; i < m_atlasPages.size(); ++i)
+        {
+            AtlasPage& page = m_atlasPages[i];
+            if ((page.smooth != smooth) || (size.x > page.size) || (size.y > page.size))
+                continue;
+
+            // Reuse the space of a removed image when possible, picking the smallest spot in which the image fits
+            auto bestIt = page.freeRects.end();
+            for (auto it = page.freeRects.begin(); it != page.freeRects.end(); ++it)
+            {
+                if ((it->width >= size.x) && (it->height >= size.y)
+                 && ((bestIt == page.freeRects.end()) || (it->width * it->height < bestIt->width * bestIt->height)))
+                    bestIt = it;
+            }
+
+            if (bestIt != page.freeRects.end())
+            {
+                // The part of the free space that isn't used by the image remains available for other images
+                const UIntRect freeRect = *bestIt;
+                page.freeRects.erase(bestIt);
+                if (freeRect.width > size.x)
+                    addFreeAtlasSpace(page, {freeRect.left + size.x, freeRect.top, freeRect.width - size.x, freeRect.height});
+                if (freeRect.height > size.y)
+                    addFreeAtlasSpace(page, {freeRect.left, freeRect.top + size.y, size.x, freeRect.height - size.y});
+
+                position = freeRect.getPosition();
+                return i;
+            }
+
+            // Add the image to an existing row if it fits without wasting too much vertical space
+            for (auto& row : page.rows)
+            {
+                if ((row.height >= size.y) && (row.height <= size.y + size.y / 4) && (row.width + size.x <= page.size))
+                {
+                    // The space below the image is kept free, so that the whole column can be merged again when the image is removed
+                    position = {row.width, row.top};
+                    row.width += size.x;
+                    if (row.height > size.y)
+                        addFreeAtlasSpace(page, {position.x, row.top + size.y, size.x, row.height - size.y});
+
+                    return i;
+                }
+            }
+
+            // Start a new row below the existing ones
+            const unsigned int top = page.rows.empty() ? 0 : page.rows.back().top + page.rows.back().height;
+            if (top + size.y <= page.size)
+            {
+                page.rows.push_back({top, size.y, size.x});
+                position = {0, top};
+                return i;
+            }
+        }
+
+        // None of the existing pages has enough free space, so create a new one
+        AtlasPage page;
+        page.size = m_atlasPageSize;
+        page.smooth = smooth;
+        page.texture = getBackend()->createTexture();
+        page.rows.push_back({0, size.y, size.x});
+        m_residentBytes += static_cast<std::size_t>(page.size) * page.size * 4;
+        m_atlasPages.push_back(std::move(page));
+
+        position = {0, 0};
+        return m_atlasPages.size() - 1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::removeFromAtlas(const TextureData& data)
+    {
+        for (auto it = m_atlasPages.begin(); it != m_atlasPages.end(); ++it)
+        {
+            if (it->texture != data.backendTexture)
+                continue;
+
+            it->usedArea -= static_cast<std::size_t>(data.atlasRect.width) * data.atlasRect.height;
+            if (--(it->imageCount) == 0)
+            {
+                m_residentBytes -= static_cast<std::size_t>(it->size) * it->size * 4;
+                m_atlasPages.erase(it);
+            }
+            else
+                addFreeAtlasSpace(*it, {data.atlasRect.left - 1, data.atlasRect.top - 1, data.atlasRect.width + 2, data.atlasRect.height + 2});
+
+            return;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void TextureManager::addFreeAtlasSpace(AtlasPage& page, UIntRect rect)
+    {
+        // Merge the space with the free neighbours that share an entire edge with it, so that the page doesn't
+        // get fragmented into pieces that are too small to hold any image
+        while (true)
+        {
+            const auto neighbourIt = std::find_if(page.freeRects.begin(), page.freeRects.end(), [&rect](const UIntRect& freeRect){
+                return ((freeRect.top == rect.top) && (freeRect.height == rect.height)
+                        && ((freeRect.left + freeRect.width == rect.left) || (rect.left + rect.width == freeRect.left)))
+                    || ((freeRect.left == rect.left) && (freeRect.width == rect.width)
+                        && ((freeRect.top + freeRect.height == rect.top) || (rect.top + rect.height == freeRect.top)));
+            });
+            if (neighbourIt == page.freeRects.end())
+                break;
+
+            const UIntRect neighbour = *neighbourIt;
+            page.freeRects.erase(neighbourIt);
+            if (neighbour.top == rect.top && neighbour.height == rect.height)
+                rect = {std::min(neighbour.left, rect.left), rect.top, neighbour.width + rect.width, rect.height};
+            else
+                rect = {rect.left, std::min(neighbour.top, rect.top), rect.width, neighbour.height + rect.height};
+        }
+
+        // Space at the end of a row is given back to the row, so that it can also be used by images of a different size
+        const auto rowIt = std::find_if(page.rows.begin(), page.rows.end(), [&rect](const AtlasRow& row){
+            return (row.top == rect.top) && (row.height == rect.height) && (row.width == rect.left + rect.width);
+        });
+        if (rowIt == page.rows.end())
+        {
+            page.freeRects.push_back(rect);
+            return;
+        }
+
+        rowIt->width = rect.left;
+        while (!page.rows.empty() && (page.rows.back().width == 0))
+            page.rows.pop_back();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -31,6 +31,8 @@
 #include <TGUI/Loading/WidgetFactory.hpp>
 #include <TGUI/SignalManager.hpp>
 
+#include <algorithm>
+
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
@@ -109,6 +111,18 @@ namespace tgui
 
             return {x, y};
         }
+
+        /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+        // The stored value is accessed by reference, as copying the ObjectConverter would also copy the texture
+        bool isTextureLoading(RendererData& rendererData, const String& property)
+        {
+            const auto propertyIt = rendererData.propertyValuePairs.find(property);
+            if ((propertyIt == rendererData.propertyValuePairs.end()) || (propertyIt->second.getType() != ObjectConverter::Type::Texture))
+                return false;
+
+            return propertyIt->second.getTexture().isLoading();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -185,6 +199,7 @@ namespace tgui
         m_showAnimations               {other.m_showAnimations},
         m_fontCached                   {other.m_fontCached},
         m_opacityCached                {other.m_opacityCached},
+        m_loadingTextureProperties     {other.m_loadingTextureProperties},
         m_mouseCursor                  {other.m_mouseCursor}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
@@ -232,6 +247,7 @@ namespace tgui
         m_showAnimations               {std::move(other.m_showAnimations)},
         m_fontCached                   {std::move(other.m_fontCached)},
         m_opacityCached                {std::move(other.m_opacityCached)},
+        m_loadingTextureProperties     {std::move(other.m_loadingTextureProperties)},
         m_mouseCursor                  {std::move(other.m_mouseCursor)}
     {
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
@@ -292,6 +308,7 @@ namespace tgui
             m_showAnimations       = {};
             m_fontCached           = other.m_fontCached;
             m_opacityCached        = other.m_opacityCached;
+            m_loadingTextureProperties = other.m_loadingTextureProperties;
             m_mouseCursor          = other.m_mouseCursor;
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
@@ -349,6 +366,7 @@ namespace tgui
             m_showAnimations       = std::move(other.m_showAnimations);
             m_fontCached           = std::move(other.m_fontCached);
             m_opacityCached        = std::move(other.m_opacityCached);
+            m_loadingTextureProperties = std::move(other.m_loadingTextureProperties);
             m_mouseCursor          = std::move(other.m_mouseCursor);
 
             m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
@@ -390,13 +408,13 @@ namespace tgui
             if (oldIt->first < newIt->first)
             {
                 // Update values that no longer exist in the new renderer and are now reset to the default value
-                rendererChanged(oldIt->first);
+                rendererChangedCallback(oldIt->first);
                 ++oldIt;
             }
             else
             {
                 // Update changed and new properties
-                rendererChanged(newIt->first);
+                rendererChangedCallback(newIt->first);
 
                 if (newIt->first < oldIt->first)
                     ++newIt;
@@ -409,12 +427,12 @@ namespace tgui
         }
         while (oldIt != oldData->propertyValuePairs.end())
         {
-            rendererChanged(oldIt->first);
+            rendererChangedCallback(oldIt->first);
             ++oldIt;
         }
         while (newIt != rendererData->propertyValuePairs.end())
         {
-            rendererChanged(newIt->first);
+            rendererChangedCallback(newIt->first);
             ++newIt;
         }
     }
@@ -469,6 +487,9 @@ namespace tgui
 
     void Widget::setPosition(const Layout2d& position)
     {
+        // Both the old and new location of the widget have to be redrawn
+        invalidate();
+
         m_position = position;
         m_position.x.connectWidget(this, true, [this]{ setPosition(getPositionLayout()); });
         m_position.y.connectWidget(this, false, [this]{ setPosition(getPositionLayout()); });
@@ -476,6 +497,7 @@ namespace tgui
         if (getPosition() != m_prevPosition)
         {
             m_prevPosition = getPosition();
+            invalidate();
             onPositionChange.emit(this, getPosition());
 
             for (auto& layout : m_boundPositionLayouts)
@@ -487,6 +509,8 @@ namespace tgui
 
     void Widget::setSize(const Layout2d& size)
     {
+        invalidate();
+
         m_size = size;
         m_size.x.connectWidget(this, true, [this]{ setSize(getSizeLayout()); });
         m_size.y.connectWidget(this, false, [this]{ setSize(getSizeLayout()); });
@@ -494,6 +518,7 @@ namespace tgui
         if (getSize() != m_prevSize)
         {
             m_prevSize = getSize();
+            invalidate();
             onSizeChange.emit(this, getSize());
 
             for (auto& layout : m_boundSizeLayouts)
@@ -546,23 +571,29 @@ namespace tgui
 
     void Widget::setOrigin(Vector2f origin)
     {
+        invalidate();
         m_origin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin.reset();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setScale(Vector2f scaleFactors, Vector2f origin)
     {
+        invalidate();
         m_scaleFactors = scaleFactors;
         m_scaleOrigin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -579,16 +610,20 @@ namespace tgui
 
     void Widget::setRotation(float angle)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin.reset();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void Widget::setRotation(float angle, Vector2f origin)
     {
+        invalidate();
         m_rotationDeg = angle;
         m_rotationOrigin = origin;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -777,7 +812,10 @@ namespace tgui
 
     void Widget::setVisible(bool visible)
     {
+        // Only one of these calls does something, as nothing is redrawn for hidden widgets
+        invalidate();
         m_visible = visible;
+        invalidate();
 
         // If the widget is hiden while still focused then it must be unfocused
         if (!visible)
@@ -800,6 +838,8 @@ namespace tgui
         // Refresh widget opacity if there is a different value set for enabled and disabled widgets
         if (getSharedRenderer()->getOpacityDisabled() != -1)
             rendererChanged("OpacityDisabled");
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -826,6 +866,10 @@ namespace tgui
             m_focused = false;
             onUnfocus.emit(this);
         }
+
+        // Containers don't look different when focused, only the focused child widget inside them does
+        if (!isContainer())
+            invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -860,10 +904,79 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void Widget::invalidate()
+    {
+        // Containers that keep their child widgets in a texture have to update it when one of the widgets inside them changes
+        Widget* ancestor = this;
+        while (ancestor)
+        {
+            if (ancestor->getParent())
+            {
+                ancestor->getParent()->invalidateRenderCache();
+                ancestor = ancestor->getParent();
+            }
+            else if (ancestor->isContainer())
+                ancestor = static_cast<Container*>(ancestor)->getSubwidgetOwner();
+            else
+                ancestor = nullptr;
+        }
+
+        if (!m_parentGui || !m_parentGui->isDamageTrackingEnabled())
+            return;
+
+        // Hidden widgets aren't drawn, so nothing has to be redrawn when they change. If a container in which the widget is
+        // located is rotated or scaled then the entire screen is redrawn, instead of calculating the transformed region.
+        const Widget* widget = this;
+        while (widget)
+        {
+            if (!widget->isVisible())
+                return;
+
+            if ((widget != this) && ((widget->getRotation() != 0) || (widget->getScale().x != 1) || (widget->getScale().y != 1)))
+            {
+                m_parentGui->invalidate();
+                return;
+            }
+
+            if (widget->getParent())
+                widget = widget->getParent();
+            else if (widget->isContainer())
+                widget = static_cast<const Container*>(widget)->getSubwidgetOwner();
+            else
+                widget = nullptr;
+        }
+
+        Vector2f parentPos;
+        if (m_parent)
+            parentPos = m_parent->getAbsolutePosition() + m_parent->getChildWidgetsOffset();
+        else if (isContainer() && static_cast<const Container*>(this)->getSubwidgetOwner())
+            parentPos = static_cast<const Container*>(this)->getSubwidgetOwner()->getAbsolutePosition();
+
+        // The region is transformed in the same way as the container transforms the widget when drawing it
+        const Vector2f origin{getOrigin().x * getSize().x, getOrigin().y * getSize().y};
+        Transform transform;
+        transform.translate(parentPos + getPosition() - origin);
+        if (getRotation() != 0)
+        {
+            const Vector2f rotOrigin{getRotationOrigin().x * getSize().x, getRotationOrigin().y * getSize().y};
+            transform.rotate(getRotation(), rotOrigin);
+        }
+        if ((getScale().x != 1) || (getScale().y != 1))
+        {
+            const Vector2f scaleOrigin{getScaleOrigin().x * getSize().x, getScaleOrigin().y * getSize().y};
+            transform.scale(getScale(), scaleOrigin);
+        }
+
+        m_parentGui->addDamagedRegion(transform.transformRect({getWidgetOffset(), getFullSize()}));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void Widget::setInheritedFont(const Font& font)
     {
         m_inheritedFont = font;
         rendererChanged("Font");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -879,6 +992,7 @@ namespace tgui
     {
         m_inheritedOpacity = opacity;
         rendererChanged("Opacity");
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -893,6 +1007,7 @@ namespace tgui
     void Widget::setTextSize(unsigned int size)
     {
         m_textSize = size;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1028,7 +1143,7 @@ namespace tgui
     {
         m_animationTimeElapsed += elapsedTime;
 
-        const bool screenRefreshRequired = !m_showAnimations.empty();
+        bool screenRefreshRequired = !m_showAnimations.empty();
         for (unsigned int i = 0; i < m_showAnimations.size();)
         {
             if (m_showAnimations[i]->update(elapsedTime))
@@ -1037,6 +1152,20 @@ namespace tgui
                 i++;
         }
 
+        // Pass textures that finished loading in the background to the widget again, now that their size is known
+        for (unsigned int i = 0; i < m_loadingTextureProperties.size();)
+        {
+            if (isTextureLoading(*m_renderer->getData(), m_loadingTextureProperties[i]))
+            {
+                i++;
+                continue;
+            }
+
+            // This also removes the property from the list
+            rendererChangedCallback(String{m_loadingTextureProperties[i]});
+            screenRefreshRequired = true;
+        }
+
         return screenRefreshRequired;
     }
 
@@ -1486,7 +1615,18 @@ namespace tgui
 
     void Widget::rendererChangedCallback(const String& property)
     {
+        // The property may change the size of the widget, so both the old and new area are redrawn
+        invalidate();
         rendererChanged(property);
+        invalidate();
+
+        // Remember textures that are still being loaded in the background, so that they can be updated once they are ready
+        const bool textureLoading = isTextureLoading(*m_renderer->getData(), property);
+        const auto loadingIt = std::find(m_loadingTextureProperties.begin(), m_loadingTextureProperties.end(), property);
+        if (textureLoading && (loadingIt == m_loadingTextureProperties.end()))
+            m_loadingTextureProperties.push_back(property);
+        else if (!textureLoading && (loadingIt != m_loadingTextureProperties.end()))
+            m_loadingTextureProperties.erase(loadingIt);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
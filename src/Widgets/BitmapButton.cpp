@@ -46,7 +46,8 @@ namespace tgui
         Button               (other),
         icon                 (other.icon),
         m_imageComponent     (std::make_shared<priv::dev::ImageComponent>(*other.m_imageComponent, &icon)),
-        m_relativeGlyphHeight(other.m_relativeGlyphHeight)
+        m_relativeGlyphHeight(other.m_relativeGlyphHeight),
+        m_imageLoading       (other.m_imageLoading)
     {
         initComponentsBitmapButton();
     }
@@ -57,7 +58,8 @@ namespace tgui
         Button               (std::move(other)),
         icon                 (std::move(other.icon)),
         m_imageComponent     (std::make_shared<priv::dev::ImageComponent>(*other.m_imageComponent, &icon)),
-        m_relativeGlyphHeight(std::move(other.m_relativeGlyphHeight))
+        m_relativeGlyphHeight(std::move(other.m_relativeGlyphHeight)),
+        m_imageLoading       (std::move(other.m_imageLoading))
     {
         initComponentsBitmapButton();
     }
@@ -74,6 +76,7 @@ namespace tgui
             icon = other.icon;
             m_imageComponent = std::make_shared<priv::dev::ImageComponent>(*other.m_imageComponent, &icon);
             m_relativeGlyphHeight = other.m_relativeGlyphHeight;
+            m_imageLoading = other.m_imageLoading;
 
             initComponentsBitmapButton();
         }
@@ -93,6 +96,7 @@ namespace tgui
             icon = std::move(other.icon);
             m_imageComponent = std::make_shared<priv::dev::ImageComponent>(*other.m_imageComponent, &icon);
             m_relativeGlyphHeight = std::move(other.m_relativeGlyphHeight);
+            m_imageLoading = std::move(other.m_imageLoading);
 
             initComponentsBitmapButton();
         }
@@ -155,6 +159,8 @@ namespace tgui
         }
         else
             updateComponentPositions();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -163,6 +169,9 @@ namespace tgui
     {
         priv::dev::setOptionalPropertyValue(icon, image, priv::dev::ComponentState::Normal);
 
+        // The size of the image is only known once it has finished loading, so setImage is called again when that happens
+        m_imageLoading = image.isLoading();
+
         if (image.getData())
         {
             m_textComponent->setPositionAlignment(priv::dev::PositionAlignment::None);
@@ -176,6 +185,8 @@ namespace tgui
         }
 
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -191,6 +202,7 @@ namespace tgui
     {
         m_relativeGlyphHeight = relativeHeight;
         updateSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -215,6 +227,21 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool BitmapButton::updateTime(Duration elapsedTime)
+    {
+        bool screenRefreshRequired = Button::updateTime(elapsedTime);
+
+        if (m_imageLoading && !getImage().isLoading())
+        {
+            setImage(Texture{getImage()});
+            screenRefreshRequired = true;
+        }
+
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     std::unique_ptr<DataIO::Node> BitmapButton::save(SavingRenderersMap& renderers) const
     {
         auto node = Button::save(renderers);
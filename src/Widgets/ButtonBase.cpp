@@ -245,6 +245,8 @@ namespace tgui
                     m_textComponent->setCharacterSize(static_cast<unsigned int>(textSize * innerSize.y * 0.85f / m_textComponent->getSize().y));
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -265,6 +267,8 @@ namespace tgui
             // Call setText to reposition the text
             setText(getText());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -551,6 +555,7 @@ namespace tgui
     void ButtonBase::addComponent(const std::shared_ptr<priv::dev::Component>& component)
     {
         m_components.emplace_back(component);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
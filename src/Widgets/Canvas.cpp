@@ -193,9 +193,9 @@ namespace tgui
             transformMatrix[1], transformMatrix[5], transformMatrix[13],
             transformMatrix[3], transformMatrix[7], transformMatrix[15]);
 
-        TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSFML>(sprite.getTexture().getData()->backendTexture),
+        TGUI_ASSERT(std::dynamic_pointer_cast<BackendTextureSFML>(sprite.getTexture().getBackendTexture()),
                     "CanvasSFML::draw requires sprite to have a backend texture of type BackendTextureSFML");
-        statesSFML.texture = &std::static_pointer_cast<BackendTextureSFML>(sprite.getTexture().getData()->backendTexture)->getInternalTexture();
+        statesSFML.texture = &std::static_pointer_cast<BackendTextureSFML>(sprite.getTexture().getBackendTexture())->getInternalTexture();
 
         static_assert(sizeof(Vertex) == sizeof(sf::Vertex), "Size of sf::Vertex has to match with tgui::Vertex for optimization to work");
         const sf::Vertex* sfmlVertices = reinterpret_cast<const sf::Vertex*>(triangleVertices.data());
@@ -211,6 +211,8 @@ namespace tgui
         const Vector2f& size = getSize();
         const sf::Texture& texture = m_renderTexture.getTexture();
         m_sprite.setTexture({texture, {0, 0, static_cast<unsigned int>(std::max(0.f, size.x)), static_cast<unsigned int>(std::max(0.f, size.y))}});
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -157,6 +157,8 @@ namespace tgui
             m_lines.push_front(std::move(line));
 
         recalculateFullTextHeight();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -202,6 +204,7 @@ namespace tgui
             m_lines.erase(m_lines.begin() + lineIndex);
 
             recalculateFullTextHeight();
+            invalidate();
             return true;
         }
         else // Index too high
@@ -215,6 +218,7 @@ namespace tgui
         m_lines.clear();
 
         recalculateFullTextHeight();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -240,6 +244,8 @@ namespace tgui
 
             recalculateFullTextHeight();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -260,6 +266,8 @@ namespace tgui
             line.text.setCharacterSize(size);
 
         recalculateAllLines();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -267,6 +275,7 @@ namespace tgui
     void ChatBox::setTextColor(Color color)
     {
         m_textColor = color;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -281,6 +290,7 @@ namespace tgui
     void ChatBox::setTextStyle(TextStyles style)
     {
         m_textStyle = style;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,7 +305,10 @@ namespace tgui
     void ChatBox::setLinesStartFromTop(bool startFromTop)
     {
         if (m_linesStartFromTop != startFromTop)
+        {
             m_linesStartFromTop = startFromTop;
+            invalidate();
+        }
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -310,6 +323,7 @@ namespace tgui
     void ChatBox::setNewLinesBelowOthers(bool newLinesBelowOthers)
     {
         m_newLinesBelowOthers = newLinesBelowOthers;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -324,6 +338,7 @@ namespace tgui
     void ChatBox::setScrollbarValue(unsigned int value)
     {
         m_scroll->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -156,6 +156,8 @@ namespace tgui
         }
         else
             RadioButton::setChecked(checked);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -271,6 +271,8 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -290,6 +292,8 @@ namespace tgui
             m_titleText.setCharacterSize(m_titleTextSize);
         else
             m_titleText.setCharacterSize(Text::findBestTextSize(m_fontCached, m_titleBarHeightCached * 0.8f));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -307,6 +311,8 @@ namespace tgui
 
         // Reposition the images and text
         setPosition(m_position);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -365,6 +371,8 @@ namespace tgui
             m_minimizeButton->setVisible(false);
 
         updateTitleBarHeight();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -530,6 +538,9 @@ namespace tgui
             if (!m_focused)
                 setFocused(true);
 
+            // The title buttons are drawn as part of the child window
+            invalidate();
+
             // Send the mouse press event to the title buttons
             for (auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
             {
@@ -569,6 +580,8 @@ namespace tgui
             for (auto& widget : m_widgets)
                 widget->leftMouseButtonNoLongerDown();
 
+            invalidate();
+
             // Check if the mouse is on top of the title bar
             if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getClientSize().x, m_titleBarHeightCached}.contains(pos))
             {
@@ -692,6 +705,9 @@ namespace tgui
                 if (!m_mouseHover)
                     mouseEnteredWidget();
 
+                // The title buttons, which are drawn as part of the child window, may change how they look
+                invalidate();
+
                 // Check if the mouse is on top of the title bar
                 if (FloatRect{m_bordersCached.getLeft(), m_bordersCached.getTop(), getClientSize().x, m_titleBarHeightCached}.contains(pos))
                 {
@@ -743,6 +759,8 @@ namespace tgui
             if (button->isVisible())
                 button->mouseNoLongerOnWidget();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -753,8 +771,14 @@ namespace tgui
 
         for (const auto& button : {m_closeButton.get(), m_maximizeButton.get(), m_minimizeButton.get()})
         {
-            if (button->isVisible())
-                button->leftMouseButtonNoLongerDown();
+            if (!button->isVisible())
+                continue;
+
+            // Only redraw the child window when one of its title buttons looked pressed
+            if (button->isMouseDown())
+                invalidate();
+
+            button->leftMouseButtonNoLongerDown();
         }
     }
 
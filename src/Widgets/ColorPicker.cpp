@@ -359,6 +359,8 @@ namespace tgui
 
         if (colorLast != color)
             onColorChange.emit(this, color);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -283,11 +283,22 @@ namespace tgui
     {
         const std::size_t itemIndex = m_listBox->addItem(item, id);
         updateListBoxHeight();
+
+        invalidate();
         return itemIndex;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::addMultipleItems(const std::vector<String>& itemNames, const std::vector<String>& ids)
+    {
+        m_listBox->addMultipleItems(itemNames, ids);
+        updateListBoxHeight();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ComboBox::setSelectedItem(const String& itemName)
     {
         const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
@@ -298,6 +309,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
 
+        invalidate();
         return ret;
     }
 
@@ -313,6 +325,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
 
+        invalidate();
         return ret;
     }
 
@@ -328,6 +341,7 @@ namespace tgui
         if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
             onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
 
+        invalidate();
         return ret;
     }
 
@@ -337,6 +351,7 @@ namespace tgui
     {
         m_text.setString("");
         m_listBox->deselectItem();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -353,6 +368,7 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        invalidate();
         return ret;
     }
 
@@ -360,14 +376,11 @@ namespace tgui
 
     bool ComboBox::removeItemById(const String& id)
     {
-        const auto& ids = m_listBox->getItemIds();
-        for (std::size_t i = 0; i < ids.size(); ++i)
-        {
-            if (ids[i] == id)
-                return removeItemByIndex(i);
-        }
+        const int index = m_listBox->getIndexById(id);
+        if (index < 0)
+            return false;
 
-        return false;
+        return removeItemByIndex(static_cast<std::size_t>(index));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -382,6 +395,7 @@ namespace tgui
         if ((m_nrOfItemsToDisplay == 0) || (m_listBox->getItemCount() < m_nrOfItemsToDisplay))
             updateListBoxHeight();
 
+        invalidate();
         return ret;
     }
 
@@ -393,6 +407,8 @@ namespace tgui
         m_listBox->removeAllItems();
 
         updateListBoxHeight();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -429,6 +445,8 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItem(originalValue, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        invalidate();
         return ret;
     }
 
@@ -438,6 +456,8 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemById(id, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        invalidate();
         return ret;
     }
 
@@ -447,6 +467,8 @@ namespace tgui
     {
         const bool ret = m_listBox->changeItemByIndex(index, newValue);
         m_text.setString(m_listBox->getSelectedItem());
+
+        invalidate();
         return ret;
     }
 
@@ -469,6 +491,7 @@ namespace tgui
     void ComboBox::setMaximumItems(std::size_t maximumItems)
     {
         m_listBox->setMaximumItems(maximumItems);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -485,6 +508,7 @@ namespace tgui
         m_listBox->setTextSize(textSize);
         m_text.setCharacterSize(m_listBox->getTextSize());
         m_defaultText.setCharacterSize(m_listBox->getTextSize());
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -499,6 +523,7 @@ namespace tgui
     void ComboBox::setDefaultText(const String& defaultText)
     {
         m_defaultText.setString(defaultText);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -526,16 +551,14 @@ namespace tgui
 
     bool ComboBox::contains(const String& item) const
     {
-        const auto& items = getItems();
-        return std::find(items.begin(), items.end(), item) != items.end();
+        return m_listBox->contains(item);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ComboBox::containsId(const String& id) const
     {
-        const auto& ids = getItemIds();
-        return std::find(ids.begin(), ids.end(), id) != ids.end();
+        return m_listBox->containsId(id);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -554,6 +577,34 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::setSearchIndexEnabled(bool enabled)
+    {
+        m_listBox->setSearchIndexEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isSearchIndexEnabled() const
+    {
+        return m_listBox->isSearchIndexEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ComboBox::setTypeAheadEnabled(bool enabled)
+    {
+        m_listBox->setTypeAheadEnabled(enabled);
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ComboBox::isTypeAheadEnabled() const
+    {
+        return m_listBox->isTypeAheadEnabled();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::setParent(Container* parent)
     {
         hideListBox();
@@ -632,6 +683,26 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ComboBox::textEntered(char32_t key)
+    {
+        Widget::textEntered(key);
+
+        // While the list is open, it has focus and handles the typed text itself
+        if (m_listBox->isVisible() || !m_listBox->isTypeAheadEnabled())
+            return;
+
+        const int previousSelectedItemIndex = m_listBox->getSelectedItemIndex();
+        m_listBox->textEntered(key);
+
+        if (previousSelectedItemIndex != m_listBox->getSelectedItemIndex())
+        {
+            m_text.setString(m_listBox->getSelectedItem());
+            onItemSelect.emit(this, m_listBox->getSelectedItemIndex(), m_listBox->getSelectedItem(), m_listBox->getSelectedItemId());
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& ComboBox::getSignal(String signalName)
     {
         if (signalName == onItemSelect.getName())
@@ -811,6 +882,11 @@ namespace tgui
         node->propertyValuePairs["MaximumItems"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(getMaximumItems()));
         node->propertyValuePairs["ChangeItemOnScroll"] = std::make_unique<DataIO::ValueNode>(Serializer::serialize(m_changeItemOnScroll));
 
+        if (isSearchIndexEnabled())
+            node->propertyValuePairs["SearchIndexEnabled"] = std::make_unique<DataIO::ValueNode>("true");
+        if (isTypeAheadEnabled())
+            node->propertyValuePairs["TypeAheadEnabled"] = std::make_unique<DataIO::ValueNode>("true");
+
         if (getExpandDirection() == ComboBox::ExpandDirection::Down)
             node->propertyValuePairs["ExpandDirection"] = std::make_unique<DataIO::ValueNode>("Down");
         else if (getExpandDirection() == ComboBox::ExpandDirection::Up)
@@ -841,16 +917,26 @@ namespace tgui
                 if (node->propertyValuePairs["Items"]->valueList.size() != node->propertyValuePairs["ItemIds"]->valueList.size())
                     throw Exception{"Amounts of values for 'Items' differs from the amount in 'ItemIds'"};
 
+                std::vector<String> items;
+                std::vector<String> ids;
+                items.reserve(node->propertyValuePairs["Items"]->valueList.size());
+                ids.reserve(node->propertyValuePairs["ItemIds"]->valueList.size());
                 for (std::size_t i = 0; i < node->propertyValuePairs["Items"]->valueList.size(); ++i)
                 {
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Items"]->valueList[i]).getString(),
-                            Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["ItemIds"]->valueList[i]).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Items"]->valueList[i]).getString());
+                    ids.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["ItemIds"]->valueList[i]).getString());
                 }
+
+                addMultipleItems(items, ids);
             }
             else // There are no item ids
             {
+                std::vector<String> items;
+                items.reserve(node->propertyValuePairs["Items"]->valueList.size());
                 for (const auto& item : node->propertyValuePairs["Items"]->valueList)
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+
+                addMultipleItems(items);
             }
         }
         else // If there are no items, there should be no item ids
@@ -869,6 +955,10 @@ namespace tgui
             setSelectedItemByIndex(node->propertyValuePairs["SelectedItemIndex"]->value.toInt());
         if (node->propertyValuePairs["ChangeItemOnScroll"])
             m_changeItemOnScroll = Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["ChangeItemOnScroll"]->value).getBool();
+        if (node->propertyValuePairs["SearchIndexEnabled"])
+            setSearchIndexEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["SearchIndexEnabled"]->value).getBool());
+        if (node->propertyValuePairs["TypeAheadEnabled"])
+            setTypeAheadEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["TypeAheadEnabled"]->value).getBool());
 
         if (node->propertyValuePairs["ExpandDirection"])
         {
@@ -981,6 +1071,20 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ComboBox::updateTime(Duration elapsedTime)
+    {
+        const bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+
+        // The list box only receives time updates from its parent while it is open, but it also handles the text
+        // that is typed while the combo box is closed.
+        if (!m_listBox->getParent())
+            static_cast<Widget&>(*m_listBox).updateTime(elapsedTime);
+
+        return screenRefreshRequired;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ComboBox::draw(BackendRenderTargetBase& target, RenderStates states) const
     {
         // Draw the borders
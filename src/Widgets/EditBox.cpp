@@ -159,6 +159,8 @@ namespace tgui
         setPasswordCharacter(m_passwordChar);
 
         onTextChange.emit(this, m_text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -173,6 +175,7 @@ namespace tgui
     void EditBox::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -189,6 +192,7 @@ namespace tgui
         m_selStart = start;
         m_selEnd = std::min(m_text.length(), start + length);
         updateSelection();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -204,6 +208,7 @@ namespace tgui
     {
         m_textSize = size;
         updateTextSize();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -229,6 +234,8 @@ namespace tgui
         m_textAfterSelection.setString("");
 
         updateTextSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -261,6 +268,8 @@ namespace tgui
             // Set the caret behind the last character
             setCaretPosition(m_displayedText.length());
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -279,6 +288,8 @@ namespace tgui
         setText(getText());
 
         //updateTextSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -332,6 +343,7 @@ namespace tgui
     void EditBox::setReadOnly(bool readOnly)
     {
         m_readOnly = readOnly;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -353,6 +365,8 @@ namespace tgui
         m_selStart = charactersBeforeCaret;
         m_selEnd = charactersBeforeCaret;
         updateSelection();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -393,6 +407,7 @@ namespace tgui
     {
         m_textSuffix.setString(suffix);
         recalculateTextPositions();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -121,6 +121,7 @@ namespace tgui
     {
         m_string = string;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -139,6 +140,8 @@ namespace tgui
             m_textSize = size;
             rearrangeText();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +150,7 @@ namespace tgui
     {
         m_horizontalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -162,6 +166,7 @@ namespace tgui
     {
         m_verticalAlignment = alignment;
         rearrangeText();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -180,6 +185,8 @@ namespace tgui
         // The policy only has an effect when not auto-sizing
         if (!m_autoSize)
             rearrangeText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -198,6 +205,8 @@ namespace tgui
 
         m_autoSize = autoSize;
         rearrangeText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -216,6 +225,8 @@ namespace tgui
 
         m_maximumTextWidth = maximumWidth;
         rearrangeText();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -24,11 +24,18 @@
 
 
 #include <TGUI/Widgets/ListBox.hpp>
+#include <algorithm>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Time after which the text typed for type-ahead is forgotten
+        const Duration TypeAheadResetTime = std::chrono::seconds(1);
+    }
+
    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListBox::ListBox(const char* typeName, bool initRenderer) :
@@ -99,9 +106,6 @@ namespace tgui
     {
         Widget::setPosition(position);
 
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-            m_items[i].text.setPosition({0, (i * m_itemHeight) + ((m_itemHeight - m_items[i].text.getSize().y) / 2.0f)});
-
         m_scroll->setPosition(getSize().x - m_bordersCached.getRight() - m_scroll->getSize().x, m_bordersCached.getTop());
     }
 
@@ -136,35 +140,65 @@ namespace tgui
         if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
             m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
 
-        // Create the new item
-        Text newItem;
-        newItem.setFont(m_fontCached);
-        newItem.setColor(m_textColorCached);
-        newItem.setOpacity(m_opacityCached);
-        newItem.setStyle(m_textStyleCached);
-        newItem.setCharacterSize(m_textSize);
-        newItem.setString(itemName);
-        newItem.setPosition({0, (m_items.size() * m_itemHeight) + ((m_itemHeight - newItem.getSize().y) / 2.0f)});
-
-        // Add the new item to the list
+        // Add the new item to the list. Its text object is only created once the item becomes visible.
         m_items.emplace_back();
-        m_items.back().text = std::move(newItem);
+        m_items.back().text = itemName;
         m_items.back().id = id;
+        m_items.back().serial = m_nextItemSerial++;
+
+        if (m_searchIndexEnabled)
+            addItemToSearchIndex(m_items.size() - 1);
+
+        invalidate();
         return m_items.size() - 1;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ListBox::setSelectedItem(const String& itemName)
+    void ListBox::addMultipleItems(const std::vector<String>& itemNames, const std::vector<String>& ids)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
+        std::size_t itemCount = itemNames.size();
+        if (m_maxItems > 0)
+            itemCount = std::min(itemCount, (m_maxItems > m_items.size()) ? (m_maxItems - m_items.size()) : 0);
+
+        if (itemCount == 0)
+            return;
+
+        m_items.reserve(m_items.size() + itemCount);
+        for (std::size_t i = 0; i < itemCount; ++i)
         {
-            if (m_items[i].text.getString() == itemName)
-                return setSelectedItemByIndex(i);
+            m_items.emplace_back();
+            m_items.back().text = itemNames[i];
+            if (i < ids.size())
+                m_items.back().id = ids[i];
+
+            m_items.back().serial = m_nextItemSerial++;
+
+            if (m_searchIndexEnabled)
+                addItemToSearchIndex(m_items.size() - 1);
         }
 
+        m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
+
+        // Scroll down when auto-scrolling is enabled
+        if (m_autoScroll && (m_scroll->getViewportSize() < m_scroll->getMaximum()))
+            m_scroll->setValue(m_scroll->getMaximum() - m_scroll->getViewportSize());
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::setSelectedItem(const String& itemName)
+    {
+        const int index = findItemIndex(itemName);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
+
         // No match was found
         deselectItem();
+
+        invalidate();
         return false;
     }
 
@@ -172,14 +206,14 @@ namespace tgui
 
     bool ListBox::setSelectedItemById(const String& id)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return setSelectedItemByIndex(i);
-        }
+        const int index = getIndexById(id);
+        if (index >= 0)
+            return setSelectedItemByIndex(static_cast<std::size_t>(index));
 
         // No match was found
         deselectItem();
+
+        invalidate();
         return false;
     }
 
@@ -201,6 +235,7 @@ namespace tgui
         else if ((m_selectedItem + 1) * getItemHeight() > m_scroll->getValue() + m_scroll->getViewportSize())
             m_scroll->setValue((m_selectedItem + 1) * getItemHeight() - m_scroll->getViewportSize());
 
+        invalidate();
         return true;
     }
 
@@ -209,32 +244,31 @@ namespace tgui
     void ListBox::deselectItem()
     {
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::removeItem(const String& itemName)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].text.getString() == itemName)
-                return removeItemByIndex(i);
-        }
+        const int index = findItemIndex(itemName);
+        if (index < 0)
+            return false;
 
-        return false;
+        invalidate();
+        return removeItemByIndex(static_cast<std::size_t>(index));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::removeItemById(const String& id)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return removeItemByIndex(i);
-        }
+        const int index = getIndexById(id);
+        if (index < 0)
+            return false;
 
-        return false;
+        invalidate();
+        return removeItemByIndex(static_cast<std::size_t>(index));
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -257,11 +291,15 @@ namespace tgui
         }
 
         // Remove the item
+        if (m_searchIndexEnabled)
+            removeItemFromSearchIndex(index);
+
         m_items.erase(m_items.begin() + index);
+        m_visibleItemTextsOutdated = true;
 
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
 
+        invalidate();
         return true;
     }
 
@@ -275,21 +313,28 @@ namespace tgui
 
         // Clear the list, remove all items
         m_items.clear();
+        m_visibleItemTexts.clear();
+        m_visibleItemTextsFirstIndex = 0;
+
+        m_itemSerialsByText.clear();
+        m_itemSerialsById.clear();
+        m_prefixIndex.clear();
+        m_prefixIndexOutdated = false;
 
         m_scroll->setMaximum(0);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListBox::getItemById(const String& id) const
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return m_items[i].text.getString();
-        }
+        const int index = getIndexById(id);
+        if (index < 0)
+            return "";
 
-        return "";
+        return m_items[static_cast<std::size_t>(index)].text;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -299,13 +344,22 @@ namespace tgui
         if (index >= m_items.size())
             return "";
 
-        return m_items[index].text.getString();
+        return m_items[index].text;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     int ListBox::getIndexById(const String& id) const
     {
+        if (m_searchIndexEnabled)
+        {
+            const auto it = m_itemSerialsById.find(id.toUtf32());
+            if (it == m_itemSerialsById.end())
+                return -1;
+
+            return static_cast<int>(getIndexOfSerial(it->second.front()));
+        }
+
         for (std::size_t i = 0; i < m_items.size(); ++i)
         {
             if (m_items[i].id == id)
@@ -329,7 +383,7 @@ namespace tgui
 
     String ListBox::getSelectedItem() const
     {
-        return (m_selectedItem >= 0) ? m_items[m_selectedItem].text.getString() : "";
+        return (m_selectedItem >= 0) ? m_items[m_selectedItem].text : "";
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -350,26 +404,24 @@ namespace tgui
 
     bool ListBox::changeItem(const String& originalValue, const String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].text.getString() == originalValue)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = findItemIndex(originalValue);
+        if (index < 0)
+            return false;
 
-        return false;
+        invalidate();
+        return changeItemByIndex(static_cast<std::size_t>(index), newValue);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::changeItemById(const String& id, const String& newValue)
     {
-        for (std::size_t i = 0; i < m_items.size(); ++i)
-        {
-            if (m_items[i].id == id)
-                return changeItemByIndex(i, newValue);
-        }
+        const int index = getIndexById(id);
+        if (index < 0)
+            return false;
 
-        return false;
+        invalidate();
+        return changeItemByIndex(static_cast<std::size_t>(index), newValue);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -379,7 +431,16 @@ namespace tgui
         if (index >= m_items.size())
             return false;
 
-        m_items[index].text.setString(newValue);
+        if (m_searchIndexEnabled)
+            removeItemFromSearchIndex(index);
+
+        m_items[index].text = newValue;
+        m_visibleItemTextsOutdated = true;
+
+        if (m_searchIndexEnabled)
+            addItemToSearchIndex(index);
+
+        invalidate();
         return true;
     }
 
@@ -395,8 +456,9 @@ namespace tgui
     std::vector<String> ListBox::getItems() const
     {
         std::vector<String> items;
+        items.reserve(m_items.size());
         for (const auto& item : m_items)
-            items.push_back(item.text.getString());
+            items.push_back(item.text);
 
         return items;
     }
@@ -406,6 +468,7 @@ namespace tgui
     std::vector<String> ListBox::getItemIds() const
     {
         std::vector<String> ids;
+        ids.reserve(m_items.size());
         for (const auto& item : m_items)
             ids.push_back(item.id);
 
@@ -432,15 +495,14 @@ namespace tgui
         // Set the new heights
         m_itemHeight = itemHeight;
         if (m_requestedTextSize == 0)
-        {
             m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-                item.text.setCharacterSize(m_textSize);
-        }
+
+        m_visibleItemTextsOutdated = true;
 
         m_scroll->setScrollAmount(m_itemHeight);
         m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-        setPosition(m_position);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -461,10 +523,9 @@ namespace tgui
         else
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
-        for (auto& item : m_items)
-            item.text.setCharacterSize(m_textSize);
+        m_visibleItemTextsOutdated = true;
 
-        setPosition(m_position);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -478,11 +539,19 @@ namespace tgui
         if ((m_maxItems > 0) && (m_maxItems < m_items.size()))
         {
             // Remove the items that passed the limitation
+            if (m_searchIndexEnabled)
+            {
+                for (std::size_t i = m_maxItems; i < m_items.size(); ++i)
+                    removeItemFromSearchIndex(i);
+            }
+
             m_items.erase(m_items.begin() + m_maxItems, m_items.end());
+            m_visibleItemTextsOutdated = true;
 
             m_scroll->setMaximum(static_cast<unsigned int>(m_items.size() * m_itemHeight));
-            setPosition(m_position);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -510,21 +579,128 @@ namespace tgui
 
     bool ListBox::contains(const String& itemStr) const
     {
-        return std::find_if(m_items.begin(), m_items.end(), [itemStr](const Item& item){ return item.text.getString() == itemStr; }) != m_items.end();
+        if (m_searchIndexEnabled)
+            return m_itemSerialsByText.find(itemStr.toUtf32()) != m_itemSerialsByText.end();
+
+        return std::find_if(m_items.begin(), m_items.end(), [itemStr](const Item& item){ return item.text == itemStr; }) != m_items.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     bool ListBox::containsId(const String& id) const
     {
+        if (m_searchIndexEnabled)
+            return m_itemSerialsById.find(id.toUtf32()) != m_itemSerialsById.end();
+
         return std::find_if(m_items.begin(), m_items.end(), [id](const Item& item){ return item.id == id; }) != m_items.end();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::setSearchIndexEnabled(bool enabled)
+    {
+        if (m_searchIndexEnabled == enabled)
+            return;
+
+        m_searchIndexEnabled = enabled;
+
+        m_itemSerialsByText.clear();
+        m_itemSerialsById.clear();
+        m_prefixIndex.clear();
+        m_prefixIndexOutdated = m_searchIndexEnabled;
+
+        if (m_searchIndexEnabled)
+        {
+            m_itemSerialsByText.reserve(m_items.size());
+            m_itemSerialsById.reserve(m_items.size());
+            for (std::size_t i = 0; i < m_items.size(); ++i)
+                addItemToSearchIndex(i);
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isSearchIndexEnabled() const
+    {
+        return m_searchIndexEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemByPrefix(const String& prefix, std::size_t startIndex) const
+    {
+        if (m_items.empty())
+            return -1;
+
+        if (startIndex >= m_items.size())
+            startIndex = 0;
+
+        // Every item starts with an empty prefix, so the start item is found without the index
+        const String lowercasePrefix = prefix.toLower();
+        if (m_searchIndexEnabled && !lowercasePrefix.empty())
+        {
+            if (m_prefixIndexOutdated)
+                updatePrefixIndex();
+
+            // The texts that start with the prefix are stored next to each other in the sorted index
+            using PrefixIndexEntry = std::pair<std::u32string, std::size_t>;
+            const std::u32string key = lowercasePrefix.toUtf32();
+            const auto first = std::lower_bound(m_prefixIndex.begin(), m_prefixIndex.end(), key,
+                [](const PrefixIndexEntry& entry, const std::u32string& value){ return entry.first.compare(0, value.length(), value) < 0; });
+            const auto last = std::upper_bound(first, m_prefixIndex.end(), key,
+                [](const std::u32string& value, const PrefixIndexEntry& entry){ return entry.first.compare(0, value.length(), value) > 0; });
+            if (first == last)
+                return -1;
+
+            // The matching item with the lowest serial number from the start item onwards is the first one that comes after it.
+            // If there is no such item then the search continues from the first item.
+            const std::size_t startSerial = m_items[startIndex].serial;
+            std::size_t lowestSerial = first->second;
+            std::size_t lowestSerialAfterStart = std::numeric_limits<std::size_t>::max();
+            for (auto it = first; it != last; ++it)
+            {
+                lowestSerial = std::min(lowestSerial, it->second);
+                if (it->second >= startSerial)
+                    lowestSerialAfterStart = std::min(lowestSerialAfterStart, it->second);
+            }
+
+            if (lowestSerialAfterStart != std::numeric_limits<std::size_t>::max())
+                return static_cast<int>(getIndexOfSerial(lowestSerialAfterStart));
+            else
+                return static_cast<int>(getIndexOfSerial(lowestSerial));
+        }
+
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            const std::size_t index = (startIndex + i) % m_items.size();
+            if (m_items[index].text.toLower().startsWith(lowercasePrefix))
+                return static_cast<int>(index);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::setTypeAheadEnabled(bool enabled)
+    {
+        m_typeAheadEnabled = enabled;
+        m_typeAheadText.clear();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListBox::isTypeAheadEnabled() const
+    {
+        return m_typeAheadEnabled;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     void ListBox::setScrollbarValue(unsigned int value)
     {
         m_scroll->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -581,7 +757,7 @@ namespace tgui
 
                 // Call the MousePress event after the item has already been changed, so that selected item represents the clicked item
                 if (m_selectedItem >= 0)
-                    onMousePress.emit(this, m_selectedItem, m_items[m_selectedItem].text.getString(), m_items[m_selectedItem].id);
+                    onMousePress.emit(this, m_selectedItem, m_items[m_selectedItem].text, m_items[m_selectedItem].id);
             }
         }
     }
@@ -593,7 +769,7 @@ namespace tgui
         if (m_mouseDown && !m_scroll->isMouseDown())
         {
             if (m_selectedItem >= 0)
-                onMouseRelease.emit(this, m_selectedItem, m_items[m_selectedItem].text.getString(), m_items[m_selectedItem].id);
+                onMouseRelease.emit(this, m_selectedItem, m_items[m_selectedItem].text, m_items[m_selectedItem].id);
 
             // Check if you double-clicked
             if (m_possibleDoubleClick)
@@ -601,7 +777,7 @@ namespace tgui
                 m_possibleDoubleClick = false;
 
                 if (m_selectedItem >= 0)
-                    onDoubleClick.emit(this, m_selectedItem, m_items[m_selectedItem].text.getString(), m_items[m_selectedItem].id);
+                    onDoubleClick.emit(this, m_selectedItem, m_items[m_selectedItem].text, m_items[m_selectedItem].id);
             }
             else // This is the first click
             {
@@ -715,6 +891,41 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    void ListBox::textEntered(char32_t key)
+    {
+        Widget::textEntered(key);
+
+        if (!m_typeAheadEnabled || (key < ' '))
+            return;
+
+        if (m_typeAheadTimeElapsed >= TypeAheadResetTime)
+            m_typeAheadText.clear();
+
+        m_typeAheadText += key;
+        m_typeAheadTimeElapsed = {};
+
+        // The first character searches after the selected item, so that typing it again moves to the next item.
+        // Additional characters refine the search, so the selected item is kept as long as it still matches.
+        const std::size_t itemAfterSelection = static_cast<std::size_t>(m_selectedItem + 1);
+        int index;
+        if (m_typeAheadText.length() == 1)
+            index = findItemByPrefix(m_typeAheadText, itemAfterSelection);
+        else
+        {
+            index = findItemByPrefix(m_typeAheadText, (m_selectedItem >= 0) ? static_cast<std::size_t>(m_selectedItem) : 0);
+
+            // When the same character is typed repeatedly without an item starting with all of them then cycle through
+            // the items that start with that character.
+            if ((index < 0) && (m_typeAheadText.find_first_not_of(key) == String::npos))
+                index = findItemByPrefix(String(1, key), itemAfterSelection);
+        }
+
+        if ((index >= 0) && (index != m_selectedItem))
+            setSelectedItemByIndex(static_cast<std::size_t>(index));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     Signal& ListBox::getSignal(String signalName)
     {
         if (signalName == onItemSelect.getName())
@@ -770,24 +981,14 @@ namespace tgui
         else if (property == "TextStyle")
         {
             m_textStyleCached = getSharedRenderer()->getTextStyle();
-
-            for (auto& item : m_items)
-                item.text.setStyle(m_textStyleCached);
-
-            if ((m_selectedItem >= 0) && m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].text.setStyle(m_selectedTextStyleCached);
+            m_visibleItemTextsOutdated = true;
         }
         else if (property == "SelectedTextStyle")
         {
             m_selectedTextStyleCached = getSharedRenderer()->getSelectedTextStyle();
 
             if (m_selectedItem >= 0)
-            {
-                if (m_selectedTextStyleCached.isSet())
-                    m_items[m_selectedItem].text.setStyle(m_selectedTextStyleCached);
-                else
-                    m_items[m_selectedItem].text.setStyle(m_textStyleCached);
-            }
+                updateVisibleItemColorAndStyle(static_cast<std::size_t>(m_selectedItem));
         }
         else if (property == "Scrollbar")
         {
@@ -832,25 +1033,17 @@ namespace tgui
 
             m_scroll->setInheritedOpacity(m_opacityCached);
             m_spriteBackground.setOpacity(m_opacityCached);
-            for (auto& item : m_items)
-                item.text.setOpacity(m_opacityCached);
+            m_visibleItemTextsOutdated = true;
         }
         else if (property == "Font")
         {
             Widget::rendererChanged(property);
 
-            for (auto& item : m_items)
-                item.text.setFont(m_fontCached);
-
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
-            {
                 m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
-                for (auto& item : m_items)
-                    item.text.setCharacterSize(m_textSize);
-            }
 
-            setPosition(m_position);
+            m_visibleItemTextsOutdated = true;
         }
         else
             Widget::rendererChanged(property);
@@ -888,6 +1081,10 @@ namespace tgui
 
         if (!m_autoScroll)
             node->propertyValuePairs["AutoScroll"] = std::make_unique<DataIO::ValueNode>("false");
+        if (m_searchIndexEnabled)
+            node->propertyValuePairs["SearchIndexEnabled"] = std::make_unique<DataIO::ValueNode>("true");
+        if (m_typeAheadEnabled)
+            node->propertyValuePairs["TypeAheadEnabled"] = std::make_unique<DataIO::ValueNode>("true");
 
         if (m_selectedItem >= 0)
             node->propertyValuePairs["SelectedItemIndex"] = std::make_unique<DataIO::ValueNode>(String::fromNumber(m_selectedItem));
@@ -918,16 +1115,26 @@ namespace tgui
                 if (node->propertyValuePairs["Items"]->valueList.size() != node->propertyValuePairs["ItemIds"]->valueList.size())
                     throw Exception{"Amounts of values for 'Items' differs from the amount in 'ItemIds'"};
 
+                std::vector<String> items;
+                std::vector<String> ids;
+                items.reserve(node->propertyValuePairs["Items"]->valueList.size());
+                ids.reserve(node->propertyValuePairs["ItemIds"]->valueList.size());
                 for (std::size_t i = 0; i < node->propertyValuePairs["Items"]->valueList.size(); ++i)
                 {
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Items"]->valueList[i]).getString(),
-                            Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["ItemIds"]->valueList[i]).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["Items"]->valueList[i]).getString());
+                    ids.push_back(Deserializer::deserialize(ObjectConverter::Type::String, node->propertyValuePairs["ItemIds"]->valueList[i]).getString());
                 }
+
+                addMultipleItems(items, ids);
             }
             else // There are no item ids
             {
+                std::vector<String> items;
+                items.reserve(node->propertyValuePairs["Items"]->valueList.size());
                 for (const auto& item : node->propertyValuePairs["Items"]->valueList)
-                    addItem(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+                    items.push_back(Deserializer::deserialize(ObjectConverter::Type::String, item).getString());
+
+                addMultipleItems(items);
             }
         }
         else // If there are no items, there should be no item ids
@@ -938,6 +1145,10 @@ namespace tgui
 
         if (node->propertyValuePairs["AutoScroll"])
             setAutoScroll(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["AutoScroll"]->value).getBool());
+        if (node->propertyValuePairs["SearchIndexEnabled"])
+            setSearchIndexEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["SearchIndexEnabled"]->value).getBool());
+        if (node->propertyValuePairs["TypeAheadEnabled"])
+            setTypeAheadEnabled(Deserializer::deserialize(ObjectConverter::Type::Bool, node->propertyValuePairs["TypeAheadEnabled"]->value).getBool());
         if (node->propertyValuePairs["TextSize"])
             setTextSize(node->propertyValuePairs["TextSize"]->value.toInt());
         if (node->propertyValuePairs["ItemHeight"])
@@ -958,37 +1169,174 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateSelectedAndHoveringItemColorsAndStyle()
+    Color ListBox::getItemTextColor(std::size_t index) const
     {
-        if (m_selectedItem >= 0)
+        const bool hovered = (m_hoveringItem >= 0) && (index == static_cast<std::size_t>(m_hoveringItem));
+        if ((m_selectedItem >= 0) && (index == static_cast<std::size_t>(m_selectedItem)))
         {
-            if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorHoverCached.isSet())
-                m_items[m_selectedItem].text.setColor(m_selectedTextColorHoverCached);
+            if (hovered && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
             else if (m_selectedTextColorCached.isSet())
-                m_items[m_selectedItem].text.setColor(m_selectedTextColorCached);
-
-            if (m_selectedTextStyleCached.isSet())
-                m_items[m_selectedItem].text.setStyle(m_selectedTextStyleCached);
+                return m_selectedTextColorCached;
         }
 
-        if ((m_hoveringItem >= 0) && (m_selectedItem != m_hoveringItem))
+        if (hovered && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+        else
+            return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    TextStyles ListBox::getItemTextStyle(std::size_t index) const
+    {
+        if ((m_selectedItem >= 0) && (index == static_cast<std::size_t>(m_selectedItem)) && m_selectedTextStyleCached.isSet())
+            return m_selectedTextStyleCached;
+        else
+            return m_textStyleCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    Text ListBox::createItemText(std::size_t index) const
+    {
+        Text text;
+        text.setFont(m_fontCached);
+        text.setColor(getItemTextColor(index));
+        text.setOpacity(m_opacityCached);
+        text.setStyle(getItemTextStyle(index));
+        text.setCharacterSize(m_textSize);
+        text.setString(m_items[index].text);
+        text.setPosition({0, (index * m_itemHeight) + ((m_itemHeight - text.getSize().y) / 2.0f)});
+        return text;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateVisibleItemTexts(std::size_t firstItem, std::size_t lastItem) const
+    {
+        const std::size_t oldFirstItem = m_visibleItemTextsFirstIndex;
+        const std::size_t oldLastItem = m_visibleItemTextsFirstIndex + m_visibleItemTexts.size();
+        if (!m_visibleItemTextsOutdated && (firstItem == oldFirstItem) && (lastItem == oldLastItem))
+            return;
+
+        // Items that remain visible keep their text, only the items that scrolled into view need a new one
+        std::vector<Text> texts;
+        texts.reserve(lastItem - firstItem);
+        for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (m_textColorHoverCached.isSet())
-                m_items[m_hoveringItem].text.setColor(m_textColorHoverCached);
+            if (!m_visibleItemTextsOutdated && (i >= oldFirstItem) && (i < oldLastItem))
+                texts.push_back(std::move(m_visibleItemTexts[i - oldFirstItem]));
+            else
+                texts.push_back(createItemText(i));
         }
+
+        m_visibleItemTexts = std::move(texts);
+        m_visibleItemTextsFirstIndex = firstItem;
+        m_visibleItemTextsOutdated = false;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListBox::updateItemColorsAndStyle()
+    void ListBox::updateVisibleItemColorAndStyle(std::size_t index)
     {
-        for (auto& item : m_items)
+        if (m_visibleItemTextsOutdated || (index < m_visibleItemTextsFirstIndex) || (index >= m_visibleItemTextsFirstIndex + m_visibleItemTexts.size()))
+            return;
+
+        Text& text = m_visibleItemTexts[index - m_visibleItemTextsFirstIndex];
+        text.setColor(getItemTextColor(index));
+        text.setStyle(getItemTextStyle(index));
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    int ListBox::findItemIndex(const String& itemName) const
+    {
+        if (m_searchIndexEnabled)
         {
-            item.text.setColor(m_textColorCached);
-            item.text.setStyle(m_textStyleCached);
+            const auto it = m_itemSerialsByText.find(itemName.toUtf32());
+            if (it == m_itemSerialsByText.end())
+                return -1;
+
+            return static_cast<int>(getIndexOfSerial(it->second.front()));
         }
 
-        updateSelectedAndHoveringItemColorsAndStyle();
+        for (std::size_t i = 0; i < m_items.size(); ++i)
+        {
+            if (m_items[i].text == itemName)
+                return static_cast<int>(i);
+        }
+
+        return -1;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::addItemToSearchIndex(std::size_t index)
+    {
+        const std::size_t serial = m_items[index].serial;
+        const auto insertSerial = [serial](std::vector<std::size_t>& serials){
+            // Items are usually added at the end, so the serial tends to be inserted at the back of the vector
+            serials.insert(std::lower_bound(serials.begin(), serials.end(), serial), serial);
+        };
+
+        insertSerial(m_itemSerialsByText[m_items[index].text.toUtf32()]);
+        insertSerial(m_itemSerialsById[m_items[index].id.toUtf32()]);
+
+        // Sorting the prefix index after every item would make adding many items slow, it is only sorted when it is needed
+        m_prefixIndexOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::removeItemFromSearchIndex(std::size_t index)
+    {
+        const std::size_t serial = m_items[index].serial;
+        const auto eraseSerial = [serial](std::unordered_map<std::u32string, std::vector<std::size_t>>& map, const String& key){
+            const auto it = map.find(key.toUtf32());
+            if (it == map.end())
+                return;
+
+            auto& serials = it->second;
+            const auto serialIt = std::lower_bound(serials.begin(), serials.end(), serial);
+            if ((serialIt != serials.end()) && (*serialIt == serial))
+                serials.erase(serialIt);
+            if (serials.empty())
+                map.erase(it);
+        };
+
+        eraseSerial(m_itemSerialsByText, m_items[index].text);
+        eraseSerial(m_itemSerialsById, m_items[index].id);
+        m_prefixIndexOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updatePrefixIndex() const
+    {
+        m_prefixIndex.clear();
+        m_prefixIndex.reserve(m_items.size());
+        for (const auto& item : m_items)
+            m_prefixIndex.emplace_back(item.text.toLower().toUtf32(), item.serial);
+
+        std::sort(m_prefixIndex.begin(), m_prefixIndex.end());
+        m_prefixIndexOutdated = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListBox::getIndexOfSerial(std::size_t serial) const
+    {
+        const auto it = std::lower_bound(m_items.begin(), m_items.end(), serial, [](const Item& item, std::size_t value){ return item.serial < value; });
+        TGUI_ASSERT((it != m_items.end()) && (it->serial == serial), "Serial number in search index has to belong to an item");
+        return static_cast<std::size_t>(it - m_items.begin());
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListBox::updateItemColorsAndStyle()
+    {
+        m_visibleItemTextsOutdated = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -997,17 +1345,13 @@ namespace tgui
     {
         if (m_hoveringItem != item)
         {
-            if (m_hoveringItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_selectedTextColorCached.isSet())
-                    m_items[m_hoveringItem].text.setColor(m_selectedTextColorCached);
-                else
-                    m_items[m_hoveringItem].text.setColor(m_textColorCached);
-            }
-
+            const int oldHoveringItem = m_hoveringItem;
             m_hoveringItem = item;
 
-            updateSelectedAndHoveringItemColorsAndStyle();
+            if (oldHoveringItem >= 0)
+                updateVisibleItemColorAndStyle(static_cast<std::size_t>(oldHoveringItem));
+            if (m_hoveringItem >= 0)
+                updateVisibleItemColorAndStyle(static_cast<std::size_t>(m_hoveringItem));
         }
     }
 
@@ -1017,23 +1361,18 @@ namespace tgui
     {
         if (m_selectedItem != item)
         {
-            if (m_selectedItem >= 0)
-            {
-                if ((m_selectedItem == m_hoveringItem) && m_textColorHoverCached.isSet())
-                    m_items[m_selectedItem].text.setColor(m_textColorHoverCached);
-                else
-                    m_items[m_selectedItem].text.setColor(m_textColorCached);
+            const int oldSelectedItem = m_selectedItem;
+            m_selectedItem = item;
 
-                m_items[m_selectedItem].text.setStyle(m_textStyleCached);
-            }
+            if (oldSelectedItem >= 0)
+                updateVisibleItemColorAndStyle(static_cast<std::size_t>(oldSelectedItem));
+            if (m_selectedItem >= 0)
+                updateVisibleItemColorAndStyle(static_cast<std::size_t>(m_selectedItem));
 
-            m_selectedItem = item;
             if (m_selectedItem >= 0)
-                onItemSelect.emit(this, m_selectedItem, m_items[m_selectedItem].text.getString(), m_items[m_selectedItem].id);
+                onItemSelect.emit(this, m_selectedItem, m_items[m_selectedItem].text, m_items[m_selectedItem].id);
             else
                 onItemSelect.emit(this, m_selectedItem, "", "");
-
-            updateSelectedAndHoveringItemColorsAndStyle();
         }
     }
 
@@ -1049,6 +1388,9 @@ namespace tgui
             m_possibleDoubleClick = false;
         }
 
+        if (!m_typeAheadText.empty())
+            m_typeAheadTimeElapsed += elapsedTime;
+
         return screenRefreshRequired;
     }
 
@@ -1090,8 +1432,13 @@ namespace tgui
                 // Show another item when the scrollbar is standing between two items
                 if ((m_scroll->getValue() + m_scroll->getViewportSize()) % m_itemHeight != 0)
                     ++lastItem;
+
+                lastItem = std::min(lastItem, m_items.size());
+                firstItem = std::min(firstItem, lastItem);
             }
 
+            updateVisibleItemTexts(firstItem, lastItem);
+
             states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop() - m_scroll->getValue()});
 
             // Draw the background of the selected item
@@ -1118,8 +1465,8 @@ namespace tgui
 
             // Draw the items
             states.transform.translate({Text::getExtraHorizontalPadding(m_fontCached, m_textSize, m_textStyleCached), 0});
-            for (std::size_t i = firstItem; i < lastItem; ++i)
-                target.drawText(states, m_items[i].text);
+            for (const auto& text : m_visibleItemTexts)
+                target.drawText(states, text);
 
             target.removeClippingLayer();
         }
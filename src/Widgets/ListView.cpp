@@ -25,12 +25,271 @@
 
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Keyboard.hpp>
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <iterator>
+#include <locale>
+#include <mutex>
+#include <thread>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 namespace tgui
 {
+    namespace
+    {
+        // Amount of items from which sorting and filtering happens on a background thread instead of blocking the gui
+        const std::size_t BackgroundItemOrderMinItems = 10000;
+
+        // Value on which a cell is sorted. Numbers are placed before texts.
+        struct SortKey
+        {
+            bool isNumber = false;
+            double number = 0;
+            std::wstring collationKey;
+        };
+
+        // Removes one item from the amount of items that have a certain width
+        void removeItemWidth(std::map<float, std::size_t>& itemWidths, float width)
+        {
+            const auto it = itemWidths.find(width);
+            if (it == itemWidths.end())
+                return;
+
+            if (--it->second == 0)
+                itemWidths.erase(it);
+        }
+
+        // Parses a decimal number, optionally with a sign and fractional part. Returns false if the text contains anything else.
+        bool parseSortNumber(const char32_t* it, const char32_t* end, double& number)
+        {
+            const bool negative = (it != end) && (*it == U'-');
+            if ((it != end) && ((*it == U'-') || (*it == U'+')))
+                ++it;
+
+            bool digitFound = false;
+            double value = 0;
+            for (; (it != end) && (*it >= U'0') && (*it <= U'9'); ++it)
+            {
+                value = (value * 10) + (*it - U'0');
+                digitFound = true;
+            }
+
+            if ((it != end) && (*it == U'.'))
+            {
+                double scale = 0.1;
+                for (++it; (it != end) && (*it >= U'0') && (*it <= U'9'); ++it)
+                {
+                    value += (*it - U'0') * scale;
+                    scale /= 10;
+                    digitFound = true;
+                }
+            }
+
+            if (!digitFound || (it != end))
+                return false;
+
+            number = negative ? -value : value;
+            return true;
+        }
+
+        // Creates the key on which the text of a cell is sorted
+        SortKey makeSortKey(const char32_t* textStart, const char32_t* textEnd, const std::collate<wchar_t>& collate)
+        {
+            SortKey key;
+            if (parseSortNumber(textStart, textEnd, key.number))
+                key.isNumber = true;
+            else
+            {
+                const std::wstring text = String(textStart, static_cast<std::size_t>(textEnd - textStart)).toWideString();
+                key.collationKey = collate.transform(text.data(), text.data() + text.size());
+            }
+            return key;
+        }
+
+        // Returns whether the left cell goes before the right cell when sorting in ascending order
+        bool compareSortKeys(const SortKey& leftKey, const SortKey& rightKey)
+        {
+            if (leftKey.isNumber != rightKey.isNumber)
+                return leftKey.isNumber;
+            else if (leftKey.isNumber)
+                return leftKey.number < rightKey.number;
+            else
+                return leftKey.collationKey < rightKey.collationKey;
+        }
+
+        // Filtering ignores the case of ASCII letters
+        char32_t toLowerAscii(char32_t c)
+        {
+            return ((c >= U'A') && (c <= U'Z')) ? static_cast<char32_t>(c - U'A' + U'a') : c;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Data for sorting and filtering the items, which is copied from the list view so that it can be processed on another thread
+    struct ListView::ItemOrderJob
+    {
+        void run()
+        {
+            std::vector<std::size_t> rows;
+            rows.reserve(itemCount);
+            if (filter.empty())
+            {
+                for (std::size_t i = 0; i < itemCount; ++i)
+                    rows.push_back(i);
+            }
+            else
+            {
+                std::transform(filterChars.begin(), filterChars.end(), filterChars.begin(), toLowerAscii);
+
+                std::u32string lowercaseFilter = filter.toUtf32();
+                std::transform(lowercaseFilter.begin(), lowercaseFilter.end(), lowercaseFilter.begin(), toLowerAscii);
+
+                for (std::size_t i = 0; i < itemCount; ++i)
+                {
+                    if (cancelled.load(std::memory_order_relaxed))
+                        break;
+
+                    const auto itemEnd = filterChars.begin() + static_cast<std::ptrdiff_t>(filterOffsets[i + 1]);
+                    if (std::search(filterChars.begin() + static_cast<std::ptrdiff_t>(filterOffsets[i]), itemEnd,
+                                    lowercaseFilter.begin(), lowercaseFilter.end()) != itemEnd)
+                        rows.push_back(i);
+                }
+            }
+
+            if (sort && !cancelled.load(std::memory_order_relaxed))
+            {
+                // Convert each cell only once instead of every time it is compared
+                const auto& collate = std::use_facet<std::collate<wchar_t>>(locale);
+                std::vector<SortKey> keys(itemCount);
+                for (const std::size_t i : rows)
+                {
+                    if (cancelled.load(std::memory_order_relaxed))
+                        break;
+
+                    keys[i] = makeSortKey(sortChars.data() + sortOffsets[i], sortChars.data() + sortOffsets[i + 1], collate);
+                }
+
+                const auto compare = [&keys](std::size_t left, std::size_t right){ return compareSortKeys(keys[left], keys[right]); };
+
+                if (cancelled.load(std::memory_order_relaxed))
+                    rows.clear();
+                else if (ascending)
+                    std::stable_sort(rows.begin(), rows.end(), compare);
+                else
+                    std::stable_sort(rows.begin(), rows.end(), [&compare](std::size_t left, std::size_t right){ return compare(right, left); });
+            }
+
+            order = std::move(rows);
+            finished.store(true, std::memory_order_release);
+        }
+
+        // Finishes a job that will never run, so that a list view that still waits for it throws away its result
+        void abandon()
+        {
+            cancelled.store(true, std::memory_order_relaxed);
+            finished.store(true, std::memory_order_release);
+        }
+
+        std::size_t itemCount = 0;
+        std::size_t generation = 0;
+        bool sort = false;
+        bool ascending = true;
+        std::u32string sortChars; // Texts in the sort column of all items, stored one after another
+        std::vector<std::size_t> sortOffsets; // Position in sortChars where the text of each item starts, followed by the end
+        std::u32string filterChars; // Texts of all cells of all items, with a null character after each cell
+        std::vector<std::size_t> filterOffsets; // Position in filterChars where the texts of each item start, followed by the end
+        String filter;
+        std::locale locale;
+        std::vector<std::size_t> order;
+        std::atomic<bool> finished{false};
+        std::atomic<bool> cancelled{false};
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    // Thread that runs the jobs of a single list view, one at a time. A job that is added while another one is running replaces
+    // the job that is waiting, as only the newest order is still of interest.
+    class ListView::ItemOrderWorker
+    {
+    public:
+        ~ItemOrderWorker()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_stopping = true;
+                if (m_runningJob)
+                    m_runningJob->cancelled.store(true, std::memory_order_relaxed);
+                if (m_queuedJob)
+                    m_queuedJob->abandon();
+            }
+
+            m_jobQueued.notify_one();
+            m_thread.join();
+        }
+
+        void addJob(std::shared_ptr<ItemOrderJob> job)
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_queuedJob)
+                    m_queuedJob->abandon();
+
+                m_queuedJob = std::move(job);
+
+                // The thread is only started when the list view gets enough items to sort or filter them in the background
+                if (!m_thread.joinable())
+                    m_thread = std::thread([this]{ run(); });
+            }
+
+            m_jobQueued.notify_one();
+        }
+
+    private:
+        void run()
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            while (true)
+            {
+                m_jobQueued.wait(lock, [this]{ return m_stopping || m_queuedJob; });
+                if (m_stopping)
+                    return;
+
+                m_runningJob = std::move(m_queuedJob);
+                lock.unlock();
+                m_runningJob->run();
+                lock.lock();
+                m_runningJob = nullptr;
+            }
+        }
+
+    private:
+        std::mutex m_mutex;
+        std::condition_variable m_jobQueued;
+        std::thread m_thread;
+        std::shared_ptr<ItemOrderJob> m_queuedJob;
+        std::shared_ptr<ItemOrderJob> m_runningJob;
+        bool m_stopping = false;
+    };
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    ListView::ItemOrderWorkerHolder::ItemOrderWorkerHolder() = default;
+
+    ListView::ItemOrderWorkerHolder::ItemOrderWorkerHolder(const ItemOrderWorkerHolder&)
+    {
+    }
+
+    ListView::ItemOrderWorkerHolder& ListView::ItemOrderWorkerHolder::operator=(const ItemOrderWorkerHolder&)
+    {
+        return *this;
+    }
+
+    ListView::ItemOrderWorkerHolder::~ItemOrderWorkerHolder() = default;
+
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     ListView::ListView(const char* typeName, bool initRenderer) :
@@ -128,10 +387,12 @@ namespace tgui
             column.width = calculateAutoColumnWidth(column.text);
 
         m_columns.push_back(std::move(column));
+        m_virtualItemsOutdated = true;
 
         updateLastColumnMaxItemWidth();
         updateHorizontalScrollbarMaximum();
 
+        invalidate();
         return m_columns.size()-1;
     }
 
@@ -150,6 +411,8 @@ namespace tgui
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
 
         updateHorizontalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -182,6 +445,8 @@ namespace tgui
             m_columns[index].width = calculateAutoColumnWidth(m_columns[index].text);
 
         updateHorizontalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -202,9 +467,12 @@ namespace tgui
     void ListView::removeAllColumns()
     {
         m_columns.clear();
+        m_virtualItemsOutdated = true;
 
         updateLastColumnMaxItemWidth();
         updateHorizontalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -220,6 +488,7 @@ namespace tgui
     {
         m_requestedHeaderHeight = height;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -252,6 +521,8 @@ namespace tgui
         {
             TGUI_PRINT_WARNING("setColumnAlignment called with invalid columnIndex.");
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -273,6 +544,7 @@ namespace tgui
     {
         m_headerVisible = showHeader;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -286,11 +558,19 @@ namespace tgui
 
     std::size_t ListView::addItem(const String& text)
     {
+        if (m_virtualCellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while the list view has virtual items.");
+            return 0;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.push_back(createText(text));
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
+        updateItemOrderWithInsertedItems(m_items.size() - 1, 1);
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -299,6 +579,7 @@ namespace tgui
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
 
+        invalidate();
         return m_items.size()-1;
     }
 
@@ -306,6 +587,12 @@ namespace tgui
 
     std::size_t ListView::addItem(const std::vector<String>& itemTexts)
     {
+        if (m_virtualCellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addItem can't be used while the list view has virtual items.");
+            return 0;
+        }
+
         TGUI_EMPLACE_BACK(item, m_items)
         item.texts.reserve(itemTexts.size());
         for (const auto& text : itemTexts)
@@ -314,6 +601,8 @@ namespace tgui
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
+        updateItemOrderWithInsertedItems(m_items.size() - 1, 1);
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -322,6 +611,7 @@ namespace tgui
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
 
+        invalidate();
         return m_items.size()-1;
     }
 
@@ -329,6 +619,12 @@ namespace tgui
 
     void ListView::addMultipleItems(const std::vector<std::vector<String>>& items)
     {
+        if (m_virtualCellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::addMultipleItems can't be used while the list view has virtual items.");
+            return;
+        }
+
         bool updatedLastColumnMaxItemWidth = false;
 
         for (unsigned int i = 0; i < items.size(); ++i)
@@ -343,6 +639,8 @@ namespace tgui
             updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidthWithNewItem(item);
         }
 
+        updateItemOrderWithInsertedItems(m_items.size() - items.size(), items.size());
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -350,6 +648,8 @@ namespace tgui
         // Scroll down when auto-scrolling is enabled
         if (m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
             m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -367,6 +667,8 @@ namespace tgui
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
+        updateItemOrderWithInsertedItems(index, 1);
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -374,6 +676,8 @@ namespace tgui
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
             m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -394,6 +698,8 @@ namespace tgui
         item.icon.setOpacity(m_opacityCached);
 
         const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(item);
+        updateItemOrderWithInsertedItems(index, 1);
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -401,6 +707,8 @@ namespace tgui
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
             m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +735,8 @@ namespace tgui
             updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidthWithNewItem(item);
         }
 
+        updateItemOrderWithInsertedItems(index, items.size());
+
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
@@ -434,6 +744,8 @@ namespace tgui
         // Scroll to the item when auto-scrolling is enabled
         if (m_autoScroll)
             m_verticalScrollbar->setValue(static_cast<unsigned int>(m_itemHeight * index));
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -467,6 +779,10 @@ namespace tgui
                 item.texts.push_back(createText(text));
         }
 
+        // The item may have to be moved to a different position or be hidden by the filter
+        updateItemOrderWithChangedItem(index);
+
+        invalidate();
         return true;
     }
 
@@ -501,6 +817,10 @@ namespace tgui
             item.texts[column] = createText(itemText);
         }
 
+        // The item may have to be moved to a different position or be hidden by the filter
+        updateItemOrderWithChangedItem(index);
+
+        invalidate();
         return true;
     }
 
@@ -508,6 +828,12 @@ namespace tgui
 
     bool ListView::removeItem(std::size_t index)
     {
+        if (m_virtualCellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::removeItem can't be used while the list view has virtual items.");
+            return false;
+        }
+
         // Update the hovered item
         if (m_hoveredItem >= 0)
         {
@@ -554,6 +880,7 @@ namespace tgui
 
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items.erase(m_items.begin() + index);
+        updateItemOrderWithRemovedItem(index);
 
         if (wasIconSet)
         {
@@ -576,25 +903,12 @@ namespace tgui
             }
         }
 
-        bool updatedLastColumnMaxItemWidth = false;
-
-        // Recalculate the last column's max item width if the old max was removed
-        const float epsilon = 0.00001f;
-        if (m_columns.empty())
-        {
-            if (std::abs(oldDesiredWidthInLastColumn - m_maxItemWidth) < epsilon)
-                updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidth();
-        }
-        else
-        {
-            if (std::abs(oldDesiredWidthInLastColumn - m_columns.back().maxItemWidth) < epsilon)
-                updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidth();
-        }
-
+        const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithRemovedItem(oldDesiredWidthInLastColumn);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
 
+        invalidate();
         return true;
     }
 
@@ -607,6 +921,23 @@ namespace tgui
 
         m_items.clear();
 
+        m_virtualCellProvider = nullptr;
+        m_virtualItemCount = 0;
+        m_virtualItems.clear();
+        m_virtualItemsFirstIndex = 0;
+
+        // The items remain sorted and filtered when new items are added later
+        if (m_itemOrderJob)
+        {
+            m_itemOrderJob->cancelled = true;
+            m_itemOrderJob = nullptr;
+        }
+        ++m_itemOrderGeneration;
+        m_itemOrder.clear();
+        m_itemsChangedDuringOrderJob.clear();
+        m_itemRowsOutdated = true;
+        m_itemOrderOutdated = false;
+
         m_iconCount = 0;
         m_maxIconWidth = m_fixedIconSize.x;
 
@@ -614,13 +945,15 @@ namespace tgui
        if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
         updateVerticalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     void ListView::setSelectedItem(std::size_t index)
     {
-        if (index >= m_items.size())
+        if (index >= getItemCount())
         {
             updateSelectedItem(-1);
             return;
@@ -629,10 +962,16 @@ namespace tgui
         updateSelectedItem(static_cast<int>(index));
 
         // Move the scrollbar
-        if (index * getItemHeight() < m_verticalScrollbar->getValue())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index * getItemHeight()));
-        else if (static_cast<unsigned int>(index + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
-            m_verticalScrollbar->setValue(static_cast<unsigned int>(index + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+        const std::size_t row = getRowOfItem(index);
+        if (row == String::npos)
+            return;
+
+        if (row * getItemHeight() < m_verticalScrollbar->getValue())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row * getItemHeight()));
+        else if (static_cast<unsigned int>(row + 1) * getItemHeight() > m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize())
+            m_verticalScrollbar->setValue(static_cast<unsigned int>(row + 1) * getItemHeight() - m_verticalScrollbar->getViewportSize());
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -661,6 +1000,8 @@ namespace tgui
             onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
         else
             onItemSelect.emit(this, -1);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -668,6 +1009,7 @@ namespace tgui
     void ListView::deselectItems()
     {
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -726,6 +1068,8 @@ namespace tgui
             return;
         }
 
+        const float oldDesiredWidthInLastColumn = getItemTotalWidth(m_items[index], m_columns.empty() ? 0 : m_columns.size() - 1);
+
         const bool wasIconSet = m_items[index].icon.isSet();
         m_items[index].icon.setTexture(texture);
 
@@ -768,9 +1112,11 @@ namespace tgui
             }
         }
 
-        const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(m_items[index]);
+        const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithModifiedItem(m_items[index], oldDesiredWidthInLastColumn);
         if (updatedLastColumnMaxItemWidth)
             updateHorizontalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -790,19 +1136,25 @@ namespace tgui
 
     std::size_t ListView::getItemCount() const
     {
-        return m_items.size();
+        if (m_virtualCellProvider)
+            return m_virtualItemCount;
+        else
+            return m_items.size();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     String ListView::getItemCell(std::size_t rowIndex, std::size_t columnIndex) const
     {
-        if (rowIndex >= m_items.size())
+        if (rowIndex >= getItemCount())
             return "";
 
         if (columnIndex != 0 && columnIndex >= m_columns.size())
             return "";
 
+        if (m_virtualCellProvider)
+            return m_virtualCellProvider(rowIndex, columnIndex);
+
         if (columnIndex < m_items[rowIndex].texts.size())
             return m_items[rowIndex].texts[columnIndex].getString();
 
@@ -813,6 +1165,9 @@ namespace tgui
 
     String ListView::getItem(std::size_t index) const
     {
+        if (m_virtualCellProvider)
+            return getItemCell(index, 0);
+
         if (index >= m_items.size())
             return "";
 
@@ -827,7 +1182,15 @@ namespace tgui
     std::vector<String> ListView::getItemRow(std::size_t index) const
     {
         std::vector<String> row;
-        if (index < m_items.size())
+        if (m_virtualCellProvider)
+        {
+            if (index < m_virtualItemCount)
+            {
+                for (std::size_t i = 0; i < std::max<std::size_t>(1, m_columns.size()); ++i)
+                    row.push_back(m_virtualCellProvider(index, i));
+            }
+        }
+        else if (index < m_items.size())
         {
             for (const auto& text : m_items[index].texts)
                 row.push_back(text.getString());
@@ -857,15 +1220,24 @@ namespace tgui
 
                 return cmp(s1, s2);
             });
+
+        // The sorted or filtered order refers to the old item indices
+        if (isItemOrderRequired())
+        {
+            ++m_itemOrderGeneration;
+            startItemOrderJob(false);
+        }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
     std::vector<String> ListView::getItems() const
     {
-        std::vector<String> items(m_items.size());
+        std::vector<String> items(getItemCount());
 
-        for (std::size_t i = 0; i < m_items.size(); i++)
+        for (std::size_t i = 0; i < items.size(); i++)
             items[i] = getItemCell(i, 0);
 
         return items;
@@ -877,6 +1249,15 @@ namespace tgui
     {
         std::vector<std::vector<String>> rows;
 
+        if (m_virtualCellProvider)
+        {
+            rows.reserve(m_virtualItemCount);
+            for (std::size_t i = 0; i < m_virtualItemCount; ++i)
+                rows.push_back(getItemRow(i));
+
+            return rows;
+        }
+
         for (const auto& item : m_items)
         {
             std::vector<String> row;
@@ -892,123 +1273,292 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::setItemHeight(unsigned int itemHeight)
+    void ListView::setVirtualItems(std::size_t itemCount, CellProvider cellProvider)
     {
-        // Set the new heights
-        m_itemHeight = itemHeight;
-        if (m_requestedTextSize == 0)
-        {
-            m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
-            for (auto& item : m_items)
-            {
-                for (auto& text : item.texts)
-                    text.setCharacterSize(m_textSize);
-            }
-        }
+        removeAllItems();
+        if (!cellProvider)
+            return;
 
+        m_sortColumn = -1;
+        m_itemFilter.clear();
+        m_useItemOrder = false;
+
+        m_virtualCellProvider = std::move(cellProvider);
+        m_virtualItemCount = itemCount;
         updateVerticalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int ListView::getItemHeight() const
+    void ListView::setVirtualItemCount(std::size_t itemCount)
     {
-        return m_itemHeight;
-    }
+        if (!m_virtualCellProvider)
+        {
+            TGUI_PRINT_WARNING("ListView::setVirtualItemCount called while the list view doesn't have virtual items.");
+            return;
+        }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        if (itemCount == m_virtualItemCount)
+            return;
 
-    void ListView::setTextSize(unsigned int textSize)
-    {
-        m_requestedTextSize = textSize;
+        const bool itemsAdded = (itemCount > m_virtualItemCount);
+        m_virtualItemCount = itemCount;
 
-        if (textSize)
-            m_textSize = textSize;
-        else
-            m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+        if (m_hoveredItem >= static_cast<int>(itemCount))
+            updateHoveredItem(-1);
 
-        for (auto& item : m_items)
+        if (!m_selectedItems.empty() && (*m_selectedItems.rbegin() >= itemCount))
         {
-            for (auto& text : item.texts)
-                text.setCharacterSize(m_textSize);
+            m_selectedItems.erase(m_selectedItems.lower_bound(itemCount), m_selectedItems.end());
+            if (!m_selectedItems.empty())
+                onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
+            else
+                onItemSelect.emit(this, -1);
         }
 
-        const unsigned int headerTextSize = getHeaderTextSize();
-        for (Column& column : m_columns)
-            column.text.setCharacterSize(headerTextSize);
+        // Rows past the end may still be in the pool, they will be dropped when the list view is drawn again
+        updateVerticalScrollbarMaximum();
 
-        const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidth();
-        if (updatedLastColumnMaxItemWidth)
-            updateHorizontalScrollbarMaximum();
+        // Scroll down when auto-scrolling is enabled
+        if (itemsAdded && m_autoScroll && (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum()))
+            m_verticalScrollbar->setValue(m_verticalScrollbar->getMaximum() - m_verticalScrollbar->getViewportSize());
 
-        m_horizontalScrollbar->setScrollAmount(m_textSize);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::setHeaderTextSize(unsigned int textSize)
+    void ListView::refreshVirtualItems()
     {
-        m_headerTextSize = textSize;
-
-        const unsigned int headerTextSize = getHeaderTextSize();
-        for (Column& column : m_columns)
-        {
-            column.text.setCharacterSize(headerTextSize);
-
-            if (column.designWidth == 0)
-                column.width = calculateAutoColumnWidth(column.text);
-        }
-
-        updateHorizontalScrollbarMaximum();
+        m_virtualItemsOutdated = true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int ListView::getHeaderTextSize() const
+    bool ListView::hasVirtualItems() const
     {
-        if (m_headerTextSize)
-            return m_headerTextSize;
-        else
-            return m_textSize;
+        return static_cast<bool>(m_virtualCellProvider);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::setSeparatorWidth(unsigned int width)
+    void ListView::setSortColumn(int columnIndex, bool ascending)
     {
-        m_separatorWidth = width;
-        updateHorizontalScrollbarMaximum();
-    }
+        if (m_virtualCellProvider && (columnIndex >= 0))
+        {
+            TGUI_PRINT_WARNING("ListView::setSortColumn can't be used while the list view has virtual items.");
+            return;
+        }
 
-    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+        if ((columnIndex == m_sortColumn) && ((columnIndex < 0) || (ascending == m_sortAscending)))
+            return;
 
-    unsigned int ListView::getSeparatorWidth() const
-    {
-        return m_separatorWidth;
+        m_sortColumn = std::max(-1, columnIndex);
+        m_sortAscending = ascending;
+        startItemOrderJob(true);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::setHeaderSeparatorHeight(unsigned int height)
+    int ListView::getSortColumn() const
     {
-        m_headerSeparatorHeight = height;
-        updateVerticalScrollbarMaximum();
+        return m_sortColumn;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    unsigned int ListView::getHeaderSeparatorHeight() const
+    bool ListView::getSortAscending() const
     {
-        return m_headerSeparatorHeight;
+        return m_sortAscending;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    void ListView::setGridLinesWidth(unsigned int width)
+    void ListView::setItemFilter(const String& filter)
     {
-        m_gridLinesWidth = width;
-        updateHorizontalScrollbarMaximum();
+        if (m_virtualCellProvider && !filter.empty())
+        {
+            TGUI_PRINT_WARNING("ListView::setItemFilter can't be used while the list view has virtual items.");
+            return;
+        }
+
+        if (filter == m_itemFilter)
+            return;
+
+        m_itemFilter = filter;
+        startItemOrderJob(true);
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    String ListView::getItemFilter() const
+    {
+        return m_itemFilter;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::vector<std::size_t> ListView::getDisplayedItemIndices() const
+    {
+        if (m_useItemOrder)
+            return m_itemOrder;
+
+        std::vector<std::size_t> indices(getItemCount());
+        for (std::size_t i = 0; i < indices.size(); ++i)
+            indices[i] = i;
+
+        return indices;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isSortingOrFiltering() const
+    {
+        return m_itemOrderJob || m_itemOrderOutdated;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setItemHeight(unsigned int itemHeight)
+    {
+        // Set the new heights
+        m_itemHeight = itemHeight;
+        if (m_requestedTextSize == 0)
+        {
+            m_textSize = Text::findBestTextSize(m_fontCached, itemHeight * 0.8f);
+            for (auto& item : m_items)
+            {
+                for (auto& text : item.texts)
+                    text.setCharacterSize(m_textSize);
+            }
+
+            m_virtualItems.clear();
+
+            const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidth();
+            if (updatedLastColumnMaxItemWidth)
+                updateHorizontalScrollbarMaximum();
+        }
+
+        updateVerticalScrollbarMaximum();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getItemHeight() const
+    {
+        return m_itemHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setTextSize(unsigned int textSize)
+    {
+        m_requestedTextSize = textSize;
+
+        if (textSize)
+            m_textSize = textSize;
+        else
+            m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
+
+        for (auto& item : m_items)
+        {
+            for (auto& text : item.texts)
+                text.setCharacterSize(m_textSize);
+        }
+
+        m_virtualItems.clear();
+
+        const unsigned int headerTextSize = getHeaderTextSize();
+        for (Column& column : m_columns)
+            column.text.setCharacterSize(headerTextSize);
+
+        const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidth();
+        if (updatedLastColumnMaxItemWidth)
+            updateHorizontalScrollbarMaximum();
+
+        m_horizontalScrollbar->setScrollAmount(m_textSize);
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setHeaderTextSize(unsigned int textSize)
+    {
+        m_headerTextSize = textSize;
+
+        const unsigned int headerTextSize = getHeaderTextSize();
+        for (Column& column : m_columns)
+        {
+            column.text.setCharacterSize(headerTextSize);
+
+            if (column.designWidth == 0)
+                column.width = calculateAutoColumnWidth(column.text);
+        }
+
+        updateHorizontalScrollbarMaximum();
+
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getHeaderTextSize() const
+    {
+        if (m_headerTextSize)
+            return m_headerTextSize;
+        else
+            return m_textSize;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setSeparatorWidth(unsigned int width)
+    {
+        m_separatorWidth = width;
+        updateHorizontalScrollbarMaximum();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getSeparatorWidth() const
+    {
+        return m_separatorWidth;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setHeaderSeparatorHeight(unsigned int height)
+    {
+        m_headerSeparatorHeight = height;
         updateVerticalScrollbarMaximum();
+        invalidate();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    unsigned int ListView::getHeaderSeparatorHeight() const
+    {
+        return m_headerSeparatorHeight;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::setGridLinesWidth(unsigned int width)
+    {
+        m_gridLinesWidth = width;
+        updateHorizontalScrollbarMaximum();
+        updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1038,6 +1588,7 @@ namespace tgui
     {
         m_showVerticalGridLines = showGridLines;
         updateHorizontalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1053,6 +1604,7 @@ namespace tgui
     {
         m_showHorizontalGridLines = showGridLines;
         updateVerticalScrollbarMaximum();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1071,10 +1623,12 @@ namespace tgui
 
         m_expandLastColumn = expand;
 
-        if (expand)
-            updateLastColumnMaxItemWidth();
+        // When the last column no longer expands, this only clears the widths that are no longer needed
+        updateLastColumnMaxItemWidth();
 
         updateHorizontalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1106,6 +1660,8 @@ namespace tgui
         }
 
         updateScrollbars();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1137,6 +1693,8 @@ namespace tgui
         }
 
         updateScrollbars();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1151,6 +1709,7 @@ namespace tgui
     void ListView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1165,6 +1724,7 @@ namespace tgui
     void ListView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1207,6 +1767,12 @@ namespace tgui
             item.icon.setSize(iconSize);
             m_maxIconWidth = std::max(m_maxIconWidth, iconSize.x);
         }
+
+        const bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidth();
+        if (updatedLastColumnMaxItemWidth)
+            updateHorizontalScrollbarMaximum();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1264,13 +1830,7 @@ namespace tgui
                 if (m_lastMouseDownItem < 0)
                     m_lastMouseDownItem = m_hoveredItem;
 
-                std::set<std::size_t> selectedItems;
-                const std::size_t rangeStart = static_cast<std::size_t>(std::min(m_lastMouseDownItem, m_hoveredItem));
-                const std::size_t rangeEnd = static_cast<std::size_t>(std::max(m_lastMouseDownItem, m_hoveredItem));
-                for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-                    selectedItems.insert(i);
-
-                setSelectedItems(selectedItems);
+                setSelectedItems(getItemsBetween(m_lastMouseDownItem, m_hoveredItem));
             }
             else
             {
@@ -1405,13 +1965,7 @@ namespace tgui
                                 if (m_lastMouseDownItem < 0)
                                     m_lastMouseDownItem = m_hoveredItem;
 
-                                std::set<std::size_t> selectedItems;
-                                const std::size_t rangeStart = static_cast<std::size_t>(std::min(m_lastMouseDownItem, m_hoveredItem));
-                                const std::size_t rangeEnd = static_cast<std::size_t>(std::max(m_lastMouseDownItem, m_hoveredItem));
-                                for (std::size_t i = rangeStart; i <= rangeEnd; ++i)
-                                    selectedItems.insert(i);
-
-                                setSelectedItems(selectedItems);
+                                setSelectedItems(getItemsBetween(m_lastMouseDownItem, m_hoveredItem));
                             }
                         }
                     }
@@ -1475,15 +2029,15 @@ namespace tgui
         Widget::keyPressed(event);
         if (event.code == Event::KeyboardKey::Up && m_selectedItems.size() == 1)
         {
-            const std::size_t index = *m_selectedItems.begin();
-            if (index != 0)
-                setSelectedItem(index - 1);
+            const std::size_t row = getRowOfItem(*m_selectedItems.begin());
+            if ((row != String::npos) && (row != 0))
+                setSelectedItem(getItemIndexAtRow(row - 1));
         }
         else if (event.code == Event::KeyboardKey::Down && m_selectedItems.size() == 1)
         {
-            const std::size_t index = *m_selectedItems.begin();
-            if (index != m_items.size() - 1)
-                setSelectedItem(index + 1);
+            const std::size_t row = getRowOfItem(*m_selectedItems.begin());
+            if ((row != String::npos) && (row + 1 < getRowCount()))
+                setSelectedItem(getItemIndexAtRow(row + 1));
         }
         else if (keyboard::isKeyPressCopy(event))
         {
@@ -1491,8 +2045,16 @@ namespace tgui
             for (const std::size_t index : m_selectedItems)
             {
                 String temp;
-                for (const auto& text : m_items[index].texts)
-                    temp.append(text.getString() + '\t');
+                if (m_virtualCellProvider)
+                {
+                    for (const auto& cell : getItemRow(index))
+                        temp.append(cell + '\t');
+                }
+                else
+                {
+                    for (const auto& text : m_items[index].texts)
+                        temp.append(text.getString() + '\t');
+                }
 
                 if (*temp.rbegin() == '\t')
                     temp.pop_back();
@@ -1631,6 +2193,8 @@ namespace tgui
 
                 item.icon.setOpacity(m_opacityCached);
             }
+
+            m_virtualItems.clear();
         }
         else if (property == "Font")
         {
@@ -1645,6 +2209,8 @@ namespace tgui
                     text.setFont(m_fontCached);
             }
 
+            m_virtualItems.clear();
+
             // Recalculate the text size with the new font
             if (m_requestedTextSize == 0)
             {
@@ -1668,6 +2234,8 @@ namespace tgui
                 if (column.designWidth == 0)
                     column.width = calculateAutoColumnWidth(column.text);
             }
+
+            updateLastColumnMaxItemWidth();
             updateHorizontalScrollbarMaximum();
         }
         else
@@ -1903,7 +2471,7 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    Text ListView::createText(const String& caption)
+    Text ListView::createText(const String& caption) const
     {
         Text text;
         text.setFont(m_fontCached);
@@ -1936,12 +2504,460 @@ namespace tgui
 
     void ListView::setItemColor(std::size_t index, const Color& color)
     {
+        if (m_virtualCellProvider)
+        {
+            // Only the rows that are currently visible exist, the others get their color when they are created
+            if ((index < m_virtualItemsFirstIndex) || (index >= m_virtualItemsFirstIndex + m_virtualItems.size()))
+                return;
+
+            for (auto& text : m_virtualItems[index - m_virtualItemsFirstIndex].texts)
+                text.setColor(color);
+            return;
+        }
+
         for (auto& text : m_items[index].texts)
             text.setColor(color);
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    Color ListView::getItemTextColor(std::size_t index) const
+    {
+        const bool hovered = (static_cast<int>(index) == m_hoveredItem);
+        if (m_selectedItems.find(index) != m_selectedItems.end())
+        {
+            if (hovered && m_selectedTextColorHoverCached.isSet())
+                return m_selectedTextColorHoverCached;
+            else if (m_selectedTextColorCached.isSet())
+                return m_selectedTextColorCached;
+        }
+        else if (hovered && m_textColorHoverCached.isSet())
+            return m_textColorHoverCached;
+
+        return m_textColorCached;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateVirtualItems(std::size_t firstItem, std::size_t lastItem) const
+    {
+        const std::size_t oldFirstItem = m_virtualItemsFirstIndex;
+        const std::size_t oldLastItem = m_virtualItemsFirstIndex + m_virtualItems.size();
+        if (!m_virtualItemsOutdated && (firstItem == oldFirstItem) && (lastItem == oldLastItem))
+            return;
+
+        // Rows that remain visible are kept as-is, the Text objects of the other rows are recycled
+        std::vector<Item> items(lastItem - firstItem);
+        std::vector<Item> unusedItems;
+        for (std::size_t i = oldFirstItem; i < oldLastItem; ++i)
+        {
+            if (!m_virtualItemsOutdated && (i >= firstItem) && (i < lastItem))
+                items[i - firstItem] = std::move(m_virtualItems[i - oldFirstItem]);
+            else
+                unusedItems.push_back(std::move(m_virtualItems[i - oldFirstItem]));
+        }
+
+        const std::size_t columnCount = std::max<std::size_t>(1, m_columns.size());
+        for (std::size_t i = firstItem; i < lastItem; ++i)
+        {
+            if (!m_virtualItemsOutdated && (i >= oldFirstItem) && (i < oldLastItem))
+                continue;
+
+            Item& item = items[i - firstItem];
+            if (!unusedItems.empty())
+            {
+                item = std::move(unusedItems.back());
+                unusedItems.pop_back();
+            }
+
+            if (item.texts.size() > columnCount)
+                item.texts.erase(item.texts.begin() + static_cast<std::ptrdiff_t>(columnCount), item.texts.end());
+
+            const Color textColor = getItemTextColor(i);
+            for (std::size_t column = 0; column < columnCount; ++column)
+            {
+                if (column < item.texts.size())
+                {
+                    item.texts[column].setString(m_virtualCellProvider(i, column));
+                    item.texts[column].setColor(textColor);
+                }
+                else
+                {
+                    item.texts.push_back(createText(m_virtualCellProvider(i, column)));
+                    item.texts.back().setColor(textColor);
+                }
+            }
+        }
+
+        m_virtualItems = std::move(items);
+        m_virtualItemsFirstIndex = firstItem;
+        m_virtualItemsOutdated = false;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::isItemOrderRequired() const
+    {
+        return (m_sortColumn >= 0) || !m_itemFilter.empty();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getRowCount() const
+    {
+        if (m_useItemOrder)
+            return m_itemOrder.size();
+        else
+            return getItemCount();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getItemIndexAtRow(std::size_t row) const
+    {
+        if (m_useItemOrder)
+            return m_itemOrder[row];
+        else
+            return row;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::size_t ListView::getRowOfItem(std::size_t index) const
+    {
+        if (!m_useItemOrder)
+            return index;
+
+        if (m_itemRowsOutdated)
+        {
+            m_itemRows.assign(m_items.size(), String::npos);
+            for (std::size_t row = 0; row < m_itemOrder.size(); ++row)
+                m_itemRows[m_itemOrder[row]] = row;
+
+            m_itemRowsOutdated = false;
+        }
+
+        if (index < m_itemRows.size())
+            return m_itemRows[index];
+        else
+            return String::npos;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    std::set<std::size_t> ListView::getItemsBetween(int firstIndex, int secondIndex) const
+    {
+        std::size_t firstRow = getRowOfItem(static_cast<std::size_t>(firstIndex));
+        const std::size_t secondRow = getRowOfItem(static_cast<std::size_t>(secondIndex));
+        if (firstRow == String::npos) // The item where the selection started may have been filtered out in the meantime
+            firstRow = secondRow;
+
+        std::set<std::size_t> items;
+        for (std::size_t row = std::min(firstRow, secondRow); row <= std::max(firstRow, secondRow); ++row)
+            items.insert(getItemIndexAtRow(row));
+
+        return items;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::startItemOrderJob(bool allowBackgroundThread)
+    {
+        if (m_itemOrderJob)
+        {
+            m_itemOrderJob->cancelled = true;
+            m_itemOrderJob = nullptr;
+        }
+
+        m_itemOrderOutdated = false;
+        m_itemsChangedDuringOrderJob.clear();
+        if (!isItemOrderRequired())
+        {
+            if (m_useItemOrder)
+            {
+                m_useItemOrder = false;
+                m_itemOrder.clear();
+                m_itemRows.clear();
+                updateHoveredItem(-1);
+                updateVerticalScrollbarMaximum();
+            }
+            return;
+        }
+
+        // The cells are copied, so that the items can still be changed while the job runs. They are stored in a single buffer
+        // because allocating a string per cell would take longer than what is gained by sorting on another thread.
+        auto job = std::make_shared<ItemOrderJob>();
+        job->itemCount = m_items.size();
+        job->generation = m_itemOrderGeneration;
+        job->sort = (m_sortColumn >= 0);
+        job->ascending = m_sortAscending;
+        job->filter = m_itemFilter;
+        if (job->sort)
+        {
+            const auto column = static_cast<std::size_t>(m_sortColumn);
+            job->sortOffsets.reserve(m_items.size() + 1);
+            for (const auto& item : m_items)
+            {
+                job->sortOffsets.push_back(job->sortChars.length());
+                if (column < item.texts.size())
+                    job->sortChars.append(item.texts[column].getString().data(), item.texts[column].getString().length());
+            }
+            job->sortOffsets.push_back(job->sortChars.length());
+        }
+        if (!m_itemFilter.empty())
+        {
+            job->filterOffsets.reserve(m_items.size() + 1);
+            for (const auto& item : m_items)
+            {
+                job->filterOffsets.push_back(job->filterChars.length());
+                for (const auto& text : item.texts)
+                {
+                    job->filterChars.append(text.getString().data(), text.getString().length());
+                    job->filterChars.push_back(U'\0');
+                }
+            }
+            job->filterOffsets.push_back(job->filterChars.length());
+        }
+
+        m_itemOrderJob = job;
+        if (allowBackgroundThread && (m_items.size() >= BackgroundItemOrderMinItems))
+        {
+            if (!m_itemOrderWorker.worker)
+                m_itemOrderWorker.worker = std::make_unique<ItemOrderWorker>();
+
+            m_itemOrderWorker.worker->addJob(std::move(job));
+        }
+        else
+        {
+            job->run();
+            finishItemOrderJob();
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::finishItemOrderJob()
+    {
+        const auto job = std::move(m_itemOrderJob);
+
+        // Throw away the result if items were inserted or removed while the job was running, as the indices would be wrong
+        if (job->cancelled || (job->generation != m_itemOrderGeneration))
+        {
+            m_itemsChangedDuringOrderJob.clear();
+            m_itemOrderOutdated = true;
+            return;
+        }
+
+        // The order is copied instead of moved, because a copy of the list view that was made while the job was running
+        // shares the job and also waits for its result
+        m_itemOrder = job->order;
+        m_useItemOrder = true;
+
+        // Items that were added or changed while the job was running are sorted and filtered separately
+        std::vector<std::size_t> items = std::move(m_itemsChangedDuringOrderJob);
+        m_itemsChangedDuringOrderJob.clear();
+        std::sort(items.begin(), items.end());
+        items.erase(std::unique(items.begin(), items.end()), items.end());
+        if (!items.empty())
+        {
+            m_itemOrder.erase(std::remove_if(m_itemOrder.begin(), m_itemOrder.end(),
+                [&items](std::size_t index){ return std::binary_search(items.begin(), items.end(), index); }), m_itemOrder.end());
+        }
+
+        for (std::size_t i = job->itemCount; i < m_items.size(); ++i)
+            items.push_back(i);
+
+        insertItemsInOrder(std::move(items));
+        m_itemRowsOutdated = true;
+        updateHoveredItem(-1);
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateItemOrderWithInsertedItems(std::size_t index, std::size_t count)
+    {
+        if (!isItemOrderRequired())
+            return;
+
+        // When the items were added at the end then the indices of other items didn't change and a running job remains valid
+        const bool appended = (index + count == m_items.size());
+        if (!appended)
+        {
+            ++m_itemOrderGeneration;
+            for (auto& itemIndex : m_itemOrder)
+            {
+                if (itemIndex >= index)
+                    itemIndex += count;
+            }
+        }
+
+        if (!m_useItemOrder)
+        {
+            m_itemOrderOutdated = true;
+            return;
+        }
+
+        if (!m_itemOrderJob && !m_itemOrderOutdated)
+        {
+            std::vector<std::size_t> items(count);
+            for (std::size_t i = 0; i < count; ++i)
+                items[i] = index + i;
+
+            insertItemsInOrder(std::move(items));
+        }
+        else
+        {
+            // The items are displayed at the bottom until the job finishes, which sorts and filters the appended items
+            for (std::size_t i = index; i < index + count; ++i)
+                m_itemOrder.push_back(i);
+
+            if (!appended || !m_itemOrderJob)
+                m_itemOrderOutdated = true;
+        }
+
+        m_itemRowsOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateItemOrderWithChangedItem(std::size_t index)
+    {
+        if (!isItemOrderRequired())
+            return;
+
+        if (!m_useItemOrder || m_itemOrderOutdated)
+        {
+            m_itemOrderOutdated = true;
+            return;
+        }
+
+        // A running job still has the old texts, the item is placed again when it finishes
+        if (m_itemOrderJob)
+        {
+            m_itemsChangedDuringOrderJob.push_back(index);
+            return;
+        }
+
+        m_itemOrder.erase(std::remove(m_itemOrder.begin(), m_itemOrder.end(), index), m_itemOrder.end());
+        insertItemsInOrder({index});
+
+        m_itemRowsOutdated = true;
+        updateHoveredItem(-1);
+        updateVerticalScrollbarMaximum();
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::insertItemsInOrder(std::vector<std::size_t> items)
+    {
+        if (!m_itemFilter.empty())
+        {
+            std::u32string lowercaseFilter = m_itemFilter.toUtf32();
+            std::transform(lowercaseFilter.begin(), lowercaseFilter.end(), lowercaseFilter.begin(), toLowerAscii);
+
+            // Same as in ItemOrderJob::run, the filter has to be found inside the text of a single cell
+            const auto isFilteredOut = [this,&lowercaseFilter](std::size_t index){
+                for (const auto& text : m_items[index].texts)
+                {
+                    std::u32string lowercaseText = text.getString().toUtf32();
+                    std::transform(lowercaseText.begin(), lowercaseText.end(), lowercaseText.begin(), toLowerAscii);
+                    if (lowercaseText.find(lowercaseFilter) != std::u32string::npos)
+                        return false;
+                }
+                return true;
+            };
+            items.erase(std::remove_if(items.begin(), items.end(), isFilteredOut), items.end());
+        }
+
+        if (items.empty())
+            return;
+
+        std::sort(items.begin(), items.end());
+
+        std::vector<std::size_t> order;
+        order.reserve(m_itemOrder.size() + items.size());
+        if (m_sortColumn < 0)
+        {
+            // Without sorting, the rows are displayed in the order of the item indices
+            std::merge(m_itemOrder.begin(), m_itemOrder.end(), items.begin(), items.end(), std::back_inserter(order));
+        }
+        else
+        {
+            // Only the new items and the rows that are visited by the binary search have their sort key calculated
+            const auto column = static_cast<std::size_t>(m_sortColumn);
+            const auto& collate = std::use_facet<std::collate<wchar_t>>(std::locale{});
+            const auto getSortKey = [this,column,&collate](std::size_t index){
+                if (column >= m_items[index].texts.size())
+                    return makeSortKey(nullptr, nullptr, collate);
+
+                const String& text = m_items[index].texts[column].getString();
+                return makeSortKey(text.data(), text.data() + text.length(), collate);
+            };
+
+            // Items with the same key remain ordered on their index, like with the stable sort in ItemOrderJob::run
+            const bool ascending = m_sortAscending;
+            const auto isBefore = [ascending](const SortKey& leftKey, std::size_t left, const SortKey& rightKey, std::size_t right){
+                if (compareSortKeys(ascending ? leftKey : rightKey, ascending ? rightKey : leftKey))
+                    return true;
+                else if (compareSortKeys(ascending ? rightKey : leftKey, ascending ? leftKey : rightKey))
+                    return false;
+                else
+                    return left < right;
+            };
+
+            std::vector<std::pair<SortKey, std::size_t>> newRows;
+            newRows.reserve(items.size());
+            for (const std::size_t index : items)
+                newRows.emplace_back(getSortKey(index), index);
+
+            std::sort(newRows.begin(), newRows.end(), [&isBefore](const std::pair<SortKey, std::size_t>& left, const std::pair<SortKey, std::size_t>& right)
+                { return isBefore(left.first, left.second, right.first, right.second); });
+
+            auto rowIt = m_itemOrder.cbegin();
+            for (const auto& newRow : newRows)
+            {
+                const auto insertIt = std::lower_bound(rowIt, m_itemOrder.cend(), newRow,
+                    [&isBefore,&getSortKey](std::size_t rowIndex, const std::pair<SortKey, std::size_t>& row)
+                    { return isBefore(getSortKey(rowIndex), rowIndex, row.first, row.second); });
+
+                order.insert(order.end(), rowIt, insertIt);
+                order.push_back(newRow.second);
+                rowIt = insertIt;
+            }
+            order.insert(order.end(), rowIt, m_itemOrder.cend());
+        }
+
+        m_itemOrder = std::move(order);
+        m_itemRowsOutdated = true;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    void ListView::updateItemOrderWithRemovedItem(std::size_t index)
+    {
+        if (!isItemOrderRequired())
+            return;
+
+        ++m_itemOrderGeneration;
+        if (m_itemOrderJob)
+            m_itemOrderOutdated = true;
+
+        if (m_useItemOrder)
+        {
+            m_itemOrder.erase(std::remove(m_itemOrder.begin(), m_itemOrder.end(), index), m_itemOrder.end());
+            for (auto& itemIndex : m_itemOrder)
+            {
+                if (itemIndex > index)
+                    --itemIndex;
+            }
+
+            m_itemRowsOutdated = true;
+        }
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     float ListView::calculateAutoColumnWidth(const Text& text)
     {
         return text.getSize().x + (2.f * text.getExtraHorizontalOffset());
@@ -1964,6 +2980,8 @@ namespace tgui
             if (m_textColorHoverCached.isSet())
                 setItemColor(m_hoveredItem, m_textColorHoverCached);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1973,6 +2991,9 @@ namespace tgui
         for (std::size_t i = 0; i < m_items.size(); ++i)
             setItemColor(i, m_textColorCached);
 
+        for (std::size_t i = 0; i < m_virtualItems.size(); ++i)
+            setItemColor(m_virtualItemsFirstIndex + i, m_textColorCached);
+
         updateSelectedAndhoveredItemColors();
     }
 
@@ -2044,117 +3065,64 @@ namespace tgui
 
     bool ListView::updateLastColumnMaxItemWidth()
     {
-        bool updatedLastColumnMaxItemWidth = false;
+        m_lastColumnItemWidths.clear();
 
         // We don't need to know the maximum item width if all columns have fixed sizes
         if (!m_columns.empty() && !m_expandLastColumn)
-            return updatedLastColumnMaxItemWidth;
+            return false;
 
-        const float textPadding = Text::getExtraHorizontalOffset(m_fontCached, m_textSize);
-        if (m_columns.empty())
-        {
-            m_maxItemWidth = 0;
-            for (const auto& item : m_items)
-            {
-                const float iconWidth = item.icon.isSet() ? item.icon.getSize().x + textPadding : 0;
-                const float itemWidth = item.texts[0].getSize().x + (textPadding * 2) + iconWidth;
-                if (itemWidth > m_maxItemWidth)
-                {
-                    m_maxItemWidth = itemWidth;
-                    updatedLastColumnMaxItemWidth = true;
-                }
-            }
-        }
-        else if (m_columns.size() == 1)
-        {
-            m_columns[0].maxItemWidth = 0;
-            for (const auto& item : m_items)
-            {
-                if (item.texts.size() >= m_columns.size())
-                {
-                    const float iconWidth = item.icon.isSet() ? item.icon.getSize().x + textPadding : 0;
-                    const float itemWidth = item.texts[0].getSize().x + (textPadding * 2) + iconWidth;
-                    if (itemWidth > m_columns[0].maxItemWidth)
-                    {
-                        m_columns[0].maxItemWidth = itemWidth;
-                        updatedLastColumnMaxItemWidth = true;
-                    }
-                }
-            }
-        }
-        else
-        {
-            const std::size_t lastColumnIndex = m_columns.size() - 1;
+        const std::size_t lastColumnIndex = m_columns.empty() ? 0 : m_columns.size() - 1;
+        for (const auto& item : m_items)
+            ++m_lastColumnItemWidths[getItemTotalWidth(item, lastColumnIndex)];
 
-            m_columns[lastColumnIndex].maxItemWidth = 0;
-            for (const auto& item : m_items)
-            {
-                if (item.texts.size() < m_columns.size())
-                    continue;
+        return updateLastColumnMaxItemWidthFromItemWidths();
+    }
 
-                const float itemWidth = item.texts[lastColumnIndex].getSize().x + (textPadding * 2);
-                if (itemWidth > m_columns[lastColumnIndex].maxItemWidth)
-                {
-                    m_columns[lastColumnIndex].maxItemWidth = itemWidth;
-                    updatedLastColumnMaxItemWidth = true;
-                }
-            }
-        }
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-        return updatedLastColumnMaxItemWidth;
+    bool ListView::updateLastColumnMaxItemWidthWithNewItem(const Item& item)
+    {
+        if (!m_columns.empty() && !m_expandLastColumn)
+            return false;
+
+        ++m_lastColumnItemWidths[getItemTotalWidth(item, m_columns.empty() ? 0 : m_columns.size() - 1)];
+        return updateLastColumnMaxItemWidthFromItemWidths();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ListView::updateLastColumnMaxItemWidthWithNewItem(const Item& item)
+    bool ListView::updateLastColumnMaxItemWidthWithModifiedItem(const Item& modifiedItem, float oldDesiredWidthInLastColumn)
     {
-        if (item.texts.size() < m_columns.size() || (!m_columns.empty() && !m_expandLastColumn))
+        if (!m_columns.empty() && !m_expandLastColumn)
             return false;
 
-        const float desiredWidthInLastColumn = getItemTotalWidth(item, m_columns.empty() ? 0 : m_columns.size() - 1);
-        if (m_columns.empty())
-        {
-            if (desiredWidthInLastColumn > m_maxItemWidth)
-            {
-                m_maxItemWidth = desiredWidthInLastColumn;
-                return true;
-            }
-        }
-        else
-        {
-            if (desiredWidthInLastColumn > m_columns.back().maxItemWidth)
-            {
-                m_columns.back().maxItemWidth = desiredWidthInLastColumn;
-                return true;
-            }
-        }
+        removeItemWidth(m_lastColumnItemWidths, oldDesiredWidthInLastColumn);
+        ++m_lastColumnItemWidths[getItemTotalWidth(modifiedItem, m_columns.empty() ? 0 : m_columns.size() - 1)];
+        return updateLastColumnMaxItemWidthFromItemWidths();
+    }
 
-        return false;
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+    bool ListView::updateLastColumnMaxItemWidthWithRemovedItem(float oldDesiredWidthInLastColumn)
+    {
+        if (!m_columns.empty() && !m_expandLastColumn)
+            return false;
+
+        removeItemWidth(m_lastColumnItemWidths, oldDesiredWidthInLastColumn);
+        return updateLastColumnMaxItemWidthFromItemWidths();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
-    bool ListView::updateLastColumnMaxItemWidthWithModifiedItem(const Item& modifiedItem, float oldDesiredWidthInLastColumn)
+    bool ListView::updateLastColumnMaxItemWidthFromItemWidths()
     {
-        bool updatedLastColumnMaxItemWidth = updateLastColumnMaxItemWidthWithNewItem(modifiedItem);
-        // If this item change didn't increase the last column's max item width and the old item's width
-        // was the last column's max item width, do a recalculation.
-        if (!updatedLastColumnMaxItemWidth)
-        {
-            const float epsilon = 0.00001f;
-            if (m_columns.empty())
-            {
-                if (std::abs(oldDesiredWidthInLastColumn - m_maxItemWidth) < epsilon)
-                    updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidth();
-            }
-            else
-            {
-                if (std::abs(oldDesiredWidthInLastColumn - m_columns.back().maxItemWidth) < epsilon)
-                    updatedLastColumnMaxItemWidth |= updateLastColumnMaxItemWidth();
-            }
-        }
+        const float maxItemWidth = m_lastColumnItemWidths.empty() ? 0 : m_lastColumnItemWidths.rbegin()->first;
+        float& lastColumnMaxItemWidth = m_columns.empty() ? m_maxItemWidth : m_columns.back().maxItemWidth;
+        if (lastColumnMaxItemWidth == maxItemWidth)
+            return false;
 
-        return updatedLastColumnMaxItemWidth;
+        lastColumnMaxItemWidth = maxItemWidth;
+        return true;
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2186,6 +3154,8 @@ namespace tgui
             onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
         else
             onItemSelect.emit(this, -1);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2202,6 +3172,8 @@ namespace tgui
             onItemSelect.emit(this, static_cast<int>(*m_selectedItems.begin()));
         else
             onItemSelect.emit(this, -1);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -2216,8 +3188,8 @@ namespace tgui
         else
             hoveredItem = static_cast<int>(std::ceil((mousePos.y + m_verticalScrollbar->getValue() - m_itemHeight + 1) / m_itemHeight));
 
-        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(m_items.size())))
-            updateHoveredItem(hoveredItem);
+        if ((hoveredItem >= 0) && (hoveredItem < static_cast<int>(getRowCount())))
+            updateHoveredItem(static_cast<int>(getItemIndexAtRow(static_cast<std::size_t>(hoveredItem))));
         else
             updateHoveredItem(-1);
     }
@@ -2320,9 +3292,10 @@ namespace tgui
     {
         const bool verticalScrollbarAtBottom = (m_verticalScrollbar->getValue() + m_verticalScrollbar->getViewportSize() >= m_verticalScrollbar->getMaximum());
 
-        unsigned int maximum = static_cast<unsigned int>(m_items.size() * m_itemHeight);
-        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
-            maximum += static_cast<unsigned int>((m_items.size() - 1) * m_gridLinesWidth);
+        const std::size_t rowCount = getRowCount();
+        unsigned int maximum = static_cast<unsigned int>(rowCount * m_itemHeight);
+        if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (rowCount > 0))
+            maximum += static_cast<unsigned int>((rowCount - 1) * m_gridLinesWidth);
 
         m_verticalScrollbar->setMaximum(maximum);
         updateScrollbars();
@@ -2393,6 +3366,10 @@ namespace tgui
         if (firstItem == lastItem)
             return;
 
+        // In virtual mode, only the visible rows are stored and the first one isn't located at index 0
+        const std::vector<Item>& items = m_virtualCellProvider ? m_virtualItems : m_items;
+        const std::size_t firstStoredItem = m_virtualCellProvider ? m_virtualItemsFirstIndex : 0;
+
         const unsigned int requiredItemHeight = m_itemHeight + (m_showHorizontalGridLines ? m_gridLinesWidth : 0);
         const float verticalTextOffset = (m_itemHeight - Text::getLineHeight(m_fontCached, m_textSize)) / 2.0f;
         const float textPadding = Text::getExtraHorizontalOffset(m_fontCached, m_textSize);
@@ -2409,16 +3386,17 @@ namespace tgui
 
             for (std::size_t i = firstItem; i < lastItem; ++i)
             {
-                if (!m_items[i].icon.isSet())
+                const Item& item = items[getItemIndexAtRow(i) - firstStoredItem];
+                if (!item.icon.isSet())
                 {
                     states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                     continue;
                 }
 
-                const float verticalIconOffset = (m_itemHeight - m_items[i].icon.getSize().y) / 2.f;
+                const float verticalIconOffset = (m_itemHeight - item.icon.getSize().y) / 2.f;
 
                 states.transform.translate({textPadding, verticalIconOffset});
-                target.drawSprite(states, m_items[i].icon);
+                target.drawSprite(states, item.icon);
                 states.transform.translate({-textPadding, static_cast<float>(requiredItemHeight) - verticalIconOffset});
             }
 
@@ -2436,7 +3414,8 @@ namespace tgui
         states.transform.translate({0, (requiredItemHeight * firstItem) - static_cast<float>(m_verticalScrollbar->getValue())});
         for (std::size_t i = firstItem; i < lastItem; ++i)
         {
-            if (column >= m_items[i].texts.size())
+            const Item& item = items[getItemIndexAtRow(i) - firstStoredItem];
+            if (column >= item.texts.size())
             {
                 states.transform.translate({0, static_cast<float>(requiredItemHeight)});
                 continue;
@@ -2446,12 +3425,12 @@ namespace tgui
             if ((column >= m_columns.size()) || (m_columns[column].alignment == ColumnAlignment::Left))
                 translateX = textPadding;
             else if (m_columns[column].alignment == ColumnAlignment::Center)
-                translateX = (columnWidth - m_items[i].texts[column].getSize().x) / 2.f;
+                translateX = (columnWidth - item.texts[column].getSize().x) / 2.f;
             else // if (m_columns[column].alignment == ColumnAlignment::Right)
-                translateX = columnWidth - textPadding - m_items[i].texts[column].getSize().x;
+                translateX = columnWidth - textPadding - item.texts[column].getSize().x;
 
             states.transform.translate({translateX, verticalTextOffset});
-            target.drawText(states, m_items[i].texts[column]);
+            target.drawText(states, item.texts[column]);
             states.transform.translate({-translateX, static_cast<float>(requiredItemHeight) - verticalTextOffset});
         }
 
@@ -2462,7 +3441,19 @@ namespace tgui
 
     bool ListView::updateTime(Duration elapsedTime)
     {
-        const bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+        bool screenRefreshRequired = Widget::updateTime(elapsedTime);
+
+        // Show the result of sorting or filtering in the background, and sort or filter items that changed in the meantime
+        if (m_itemOrderJob && m_itemOrderJob->finished.load(std::memory_order_acquire))
+        {
+            finishItemOrderJob();
+            screenRefreshRequired = true;
+        }
+        if (m_itemOrderOutdated && !m_itemOrderJob)
+        {
+            startItemOrderJob(true);
+            screenRefreshRequired = true;
+        }
 
         if (m_animationTimeElapsed >= getDoubleClickTime())
         {
@@ -2493,15 +3484,18 @@ namespace tgui
 
         // Find out which items are visible
         std::size_t firstItem = 0;
-        std::size_t lastItem = m_items.size();
+        std::size_t lastItem = getRowCount();
         if (m_verticalScrollbar->getViewportSize() < m_verticalScrollbar->getMaximum())
         {
             firstItem = m_verticalScrollbar->getValue() / totalItemHeight;
             lastItem = ((static_cast<std::size_t>(m_verticalScrollbar->getValue()) + m_verticalScrollbar->getViewportSize()) / totalItemHeight) + 1;
-            if (lastItem > m_items.size())
-                lastItem = m_items.size();
+            if (lastItem > getRowCount())
+                lastItem = getRowCount();
         }
 
+        if (m_virtualCellProvider)
+            updateVirtualItems(firstItem, lastItem);
+
         states.transform.translate({m_paddingCached.getLeft(), m_paddingCached.getTop()});
 
         // Draw the scrollbars
@@ -2544,7 +3538,7 @@ namespace tgui
             target.addClippingLayer(states, {{}, {availableWidth, innerHeight - totalHeaderHeight}});
 
             // Draw the horizontal grid lines
-            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && !m_items.empty())
+            if (m_showHorizontalGridLines && (m_gridLinesWidth > 0) && (getRowCount() > 0))
             {
                 Transform transformBeforeGridLines = states.transform;
 
@@ -2565,23 +3559,28 @@ namespace tgui
             {
                 for(const std::size_t selectedItem : m_selectedItems)
                 {
-                    states.transform.translate({0, selectedItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                    const std::size_t selectedRow = getRowOfItem(selectedItem);
+                    if (selectedRow == String::npos)
+                        continue;
+
+                    states.transform.translate({0, selectedRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
 
                     if ((static_cast<int>(selectedItem) == m_hoveredItem) && m_selectedBackgroundColorHoverCached.isSet())
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorHoverCached, m_opacityCached));
                     else
                         target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_selectedBackgroundColorCached, m_opacityCached));
 
-                    states.transform.translate({0, -static_cast<int>(selectedItem) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                    states.transform.translate({0, -static_cast<float>(selectedRow) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
                 }
             }
 
             // Draw the background of the item on which the mouse is standing
             if ((m_hoveredItem >= 0) && (m_selectedItems.find(m_hoveredItem) == m_selectedItems.end()) && m_backgroundColorHoverCached.isSet())
             {
-                states.transform.translate({0, m_hoveredItem * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
+                const std::size_t hoveredRow = getRowOfItem(static_cast<std::size_t>(m_hoveredItem));
+                states.transform.translate({0, hoveredRow * static_cast<float>(totalItemHeight) - m_verticalScrollbar->getValue()});
                 target.drawFilledRect(states, {availableWidth, static_cast<float>(m_itemHeight)}, Color::applyOpacity(m_backgroundColorHoverCached, m_opacityCached));
-                states.transform.translate({0, -m_hoveredItem * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
+                states.transform.translate({0, -static_cast<float>(hoveredRow) * static_cast<float>(totalItemHeight) + m_verticalScrollbar->getValue()});
             }
 
             // We haven't drawn the header yet, so move back up
@@ -357,6 +357,7 @@ namespace tgui
     void MenuBar::addMenu(const String& text)
     {
         createMenu(m_menus, text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -388,6 +389,9 @@ namespace tgui
             return false;
 
         createMenu(menu->menuItems, hierarchy.back());
+
+        // The menu items are drawn by the placeholder widget while the menu is open
+        m_menuWidgetPlaceholder->invalidate();
         return true;
     }
 
@@ -396,6 +400,7 @@ namespace tgui
     void MenuBar::removeAllMenus()
     {
         m_menus.clear();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -409,6 +414,7 @@ namespace tgui
 
             closeMenu();
             m_menus.erase(m_menus.begin() + i);
+            invalidate();
             return true;
         }
 
@@ -430,6 +436,8 @@ namespace tgui
         if (hierarchy.size() < 2)
             return false;
 
+        invalidate();
+        m_menuWidgetPlaceholder->invalidate();
         return removeMenuImpl(hierarchy, removeParentsWhenEmpty, 0, m_menus);
     }
 
@@ -447,6 +455,7 @@ namespace tgui
         if (hierarchy.empty())
             return false;
 
+        m_menuWidgetPlaceholder->invalidate();
         return removeSubMenusImpl(hierarchy, 0, m_menus);
     }
 
@@ -464,6 +473,7 @@ namespace tgui
 
             m_menus[i].enabled = enabled;
             updateMenuTextColor(m_menus[i], (m_visibleMenu == static_cast<int>(i)));
+            invalidate();
             return true;
         }
 
@@ -512,6 +522,7 @@ namespace tgui
 
             menuItem.enabled = enabled;
             updateMenuTextColor(menuItem, (menu->selectedMenuItem == static_cast<int>(j)));
+            m_menuWidgetPlaceholder->invalidate();
             return true;
         }
 
@@ -545,6 +556,8 @@ namespace tgui
     {
         m_textSize = size;
         setTextSizeImpl(m_menus, size);
+        invalidate();
+        m_menuWidgetPlaceholder->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -552,6 +565,7 @@ namespace tgui
     void MenuBar::setMinimumSubMenuWidth(float minimumWidth)
     {
         m_minimumSubMenuWidth = minimumWidth;
+        m_menuWidgetPlaceholder->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -566,6 +580,7 @@ namespace tgui
     void MenuBar::setInvertedMenuDirection(bool invertDirection)
     {
         m_invertedMenuDirection = invertDirection;
+        m_menuWidgetPlaceholder->invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -601,6 +616,8 @@ namespace tgui
             m_menuWidgetPlaceholder->setPosition(getAbsolutePosition());
             container->add(m_menuWidgetPlaceholder, "#TGUI_INTERNAL$MenuBarMenuPlaceholder#");
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -614,6 +631,8 @@ namespace tgui
 
         if (m_menuWidgetPlaceholder->getParent())
             m_menuWidgetPlaceholder->getParent()->remove(m_menuWidgetPlaceholder);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -184,7 +184,9 @@ namespace tgui
         {
             const auto& texture = getSharedRenderer()->getTexture();
 
-            if (!m_sprite.isSet() && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
+            // When the texture was loaded in the background then the sprite already had the texture, but its size wasn't known yet
+            const bool textureNewlyAvailable = !m_sprite.isSet() || (m_sprite.getTexture().getData() == texture.getData());
+            if (textureNewlyAvailable && m_size.x.isConstant() && m_size.y.isConstant() && (getSize() == Vector2f{0,0}))
                 setSize(Vector2f{texture.getImageSize()});
 
             m_sprite.setTexture(texture);
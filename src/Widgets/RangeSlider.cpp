@@ -244,6 +244,8 @@ namespace tgui
             setSelectionStart(m_selectionStart);
 
         updateThumbPositions();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -273,6 +275,8 @@ namespace tgui
             setSelectionEnd(m_selectionEnd);
 
         updateThumbPositions();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -308,6 +312,8 @@ namespace tgui
 
             updateThumbPositions();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -343,6 +349,8 @@ namespace tgui
 
             updateThumbPositions();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -223,6 +223,8 @@ namespace tgui
 
             connectPositionAndSize(widget);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -255,6 +257,7 @@ namespace tgui
             }
         }
 
+        invalidate();
         return ret;
     }
 
@@ -271,6 +274,8 @@ namespace tgui
             recalculateMostBottomRightPosition();
             updateScrollbars();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -291,6 +296,8 @@ namespace tgui
         }
 
         updateScrollbars();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,6 +348,8 @@ namespace tgui
         }
 
         updateScrollbars();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -372,6 +381,8 @@ namespace tgui
         }
 
         updateScrollbars();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -427,6 +438,7 @@ namespace tgui
     void ScrollablePanel::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -441,6 +453,7 @@ namespace tgui
     void ScrollablePanel::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -466,9 +479,15 @@ namespace tgui
         m_mouseDown = true;
 
         if (m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar->leftMousePressed(pos - getPosition());
+            invalidate();
+        }
         else if (m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar->leftMousePressed(pos - getPosition());
+            invalidate();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMousePressed({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -481,9 +500,15 @@ namespace tgui
     void ScrollablePanel::leftMouseReleased(Vector2f pos)
     {
         if (m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
             m_verticalScrollbar->leftMouseReleased(pos - getPosition());
+            invalidate();
+        }
         else if (m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
+        {
             m_horizontalScrollbar->leftMouseReleased(pos - getPosition());
+            invalidate();
+        }
         else if (FloatRect{getPosition().x + getChildWidgetsOffset().x, getPosition().y + getChildWidgetsOffset().y, getInnerSize().x, getInnerSize().y}.contains(pos))
         {
             Panel::leftMouseReleased({pos.x + static_cast<float>(m_horizontalScrollbar->getValue()),
@@ -499,10 +524,12 @@ namespace tgui
         if ((m_verticalScrollbar->isMouseDown() && m_verticalScrollbar->isMouseDownOnThumb()) || m_verticalScrollbar->isMouseOnWidget(pos - getPosition()))
         {
             m_verticalScrollbar->mouseMoved(pos - getPosition());
+            invalidate();
         }
         else if ((m_horizontalScrollbar->isMouseDown() && m_horizontalScrollbar->isMouseDownOnThumb()) || m_horizontalScrollbar->isMouseOnWidget(pos - getPosition()))
         {
             m_horizontalScrollbar->mouseMoved(pos - getPosition());
+            invalidate();
         }
         else // Mouse not on scrollbar or dragging the scrollbar thumb
         {
@@ -512,6 +539,9 @@ namespace tgui
                                    pos.y + static_cast<float>(m_verticalScrollbar->getValue())});
             }
 
+            if (m_verticalScrollbar->isMouseHovered() || m_horizontalScrollbar->isMouseHovered())
+                invalidate();
+
             m_verticalScrollbar->mouseNoLongerOnWidget();
             m_horizontalScrollbar->mouseNoLongerOnWidget();
         }
@@ -543,11 +573,13 @@ namespace tgui
         {
             m_horizontalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
             mouseMoved(pos);
+            invalidate();
         }
         else if (m_verticalScrollbar->isShown())
         {
             m_verticalScrollbar->mouseWheelScrolled(delta, pos - getPosition());
             mouseMoved(pos);
+            invalidate();
         }
 
         return true; // We swallowed the event
@@ -560,6 +592,7 @@ namespace tgui
         Panel::mouseNoLongerOnWidget();
         m_verticalScrollbar->mouseNoLongerOnWidget();
         m_horizontalScrollbar->mouseNoLongerOnWidget();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -567,6 +600,9 @@ namespace tgui
     void ScrollablePanel::leftMouseButtonNoLongerDown()
     {
         Panel::leftMouseButtonNoLongerDown();
+        if (m_verticalScrollbar->isMouseDown() || m_horizontalScrollbar->isMouseDown())
+            invalidate();
+
         m_verticalScrollbar->leftMouseButtonNoLongerDown();
         m_horizontalScrollbar->leftMouseButtonNoLongerDown();
     }
@@ -119,6 +119,8 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +149,8 @@ namespace tgui
             // Recalculate the size and position of the thumb image
             updateSize();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -171,6 +175,8 @@ namespace tgui
 
         // Recalculate the size and position of the thumb image
         updateSize();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -199,6 +205,7 @@ namespace tgui
     void Scrollbar::setAutoHide(bool autoHide)
     {
         m_autoHide = autoHide;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -217,6 +224,8 @@ namespace tgui
 
         m_verticalScroll = vertical;
         setSize(getSize().y, getSize().x);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1063,6 +1072,13 @@ namespace tgui
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
+    bool ScrollbarChildWidget::isMouseHovered() const
+    {
+        return m_mouseHover;
+    }
+
+    /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
     bool ScrollbarChildWidget::isShown() const
     {
         return m_visible && (!m_autoHide || (m_maximum > m_viewportSize));
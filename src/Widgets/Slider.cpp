@@ -239,6 +239,8 @@ namespace tgui
             setValue(m_minimum);
 
         updateThumbPosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -264,6 +266,8 @@ namespace tgui
             setValue(m_maximum);
 
         updateThumbPosition();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -295,6 +299,8 @@ namespace tgui
 
             updateThumbPosition();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -330,6 +336,8 @@ namespace tgui
 
         m_verticalScroll = vertical;
         setSize(getSize().y, getSize().x);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -345,6 +353,7 @@ namespace tgui
     {
         m_invertedDirection = invertedDirection;
         updateThumbPosition();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
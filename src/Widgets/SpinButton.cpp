@@ -142,6 +142,8 @@ namespace tgui
         // When the value is below the minimum then adjust it
         if (m_value < m_minimum)
             setValue(m_minimum);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -164,6 +166,8 @@ namespace tgui
         // When the value is above the maximum then adjust it
         if (m_value > m_maximum)
             setValue(m_maximum);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,6 +196,8 @@ namespace tgui
             m_value = value;
             onValueChange.emit(this, value);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -224,6 +230,8 @@ namespace tgui
 
         m_verticalScroll = vertical;
         setSize(getSize().y, getSize().x);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
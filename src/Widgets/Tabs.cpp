@@ -109,6 +109,7 @@ namespace tgui
     {
         Widget::setEnabled(enabled);
         updateTextColors();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -120,6 +121,8 @@ namespace tgui
             m_autoSize = autoSize;
             recalculateTabsWidth();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -137,6 +140,8 @@ namespace tgui
         insert(m_tabs.size(), text, selectTab);
 
         // Return the index of the new tab
+
+        invalidate();
         return m_tabs.size()-1;
     }
 
@@ -171,6 +176,8 @@ namespace tgui
         // If the tab has to be selected then do so
         if (selectTab)
             select(index);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -192,6 +199,8 @@ namespace tgui
 
         m_tabs[index].text.setString(text);
         recalculateTabsWidth();
+
+        invalidate();
         return true;
     }
 
@@ -233,6 +242,8 @@ namespace tgui
 
         // Send the callback
         onTabSelect.emit(this, m_tabs[index].text.getString());
+
+        invalidate();
         return true;
     }
 
@@ -245,6 +256,8 @@ namespace tgui
             m_tabs[m_selectedTab].text.setColor(m_textColorCached);
             m_selectedTab = -1;
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -280,6 +293,8 @@ namespace tgui
         // New hovered tab depends on several factors, we keep it simple and just remove the hover state
         m_hoveringTab = -1;
         recalculateTabsWidth();
+
+        invalidate();
         return true;
     }
 
@@ -292,6 +307,8 @@ namespace tgui
         m_hoveringTab = -1;
 
         recalculateTabsWidth();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -320,6 +337,8 @@ namespace tgui
 
         m_tabs[index].visible = visible;
         recalculateTabsWidth();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -341,6 +360,8 @@ namespace tgui
 
         m_tabs[index].enabled = enabled;
         updateTextColors();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -371,6 +392,8 @@ namespace tgui
 
             recalculateTabsWidth();
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -383,6 +406,8 @@ namespace tgui
         // Recalculate the size when the text is auto sizing
         if (m_requestedTextSize == 0)
             setTextSize(0);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -392,6 +417,7 @@ namespace tgui
         m_maximumTabWidth = maximumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -408,6 +434,7 @@ namespace tgui
         m_minimumTabWidth = minimumWidth;
 
         recalculateTabsWidth();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -27,6 +27,7 @@
 #include <TGUI/Widgets/TextArea.hpp>
 #include <TGUI/Keyboard.hpp>
 
+#include <algorithm>
 #include <cmath>
 
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -140,6 +141,8 @@ namespace tgui
         rearrangeText(false);
 
         onTextChange.emit(this, m_text);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -147,6 +150,7 @@ namespace tgui
     void TextArea::addText(const String& text)
     {
         setText(m_text + text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -161,6 +165,7 @@ namespace tgui
     void TextArea::setDefaultText(const String& text)
     {
         m_defaultText.setString(text);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -179,6 +184,8 @@ namespace tgui
         setCaretPosition(selectionStartIndex);
         m_selEnd = selEnd;
         updateSelectionTexts();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -231,6 +238,8 @@ namespace tgui
         m_horizontalScrollbar->setScrollAmount(m_textSize);
 
         rearrangeText(true);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -247,6 +256,8 @@ namespace tgui
             m_text.erase(m_maxChars, String::npos);
             rearrangeText(false);
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -278,6 +289,8 @@ namespace tgui
         }
 
         rearrangeText(false);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -309,6 +322,8 @@ namespace tgui
         }
 
         rearrangeText(false);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -346,6 +361,8 @@ namespace tgui
                 break;
             }
         }
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -360,6 +377,7 @@ namespace tgui
     void TextArea::setReadOnly(bool readOnly)
     {
         m_readOnly = readOnly;
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -417,6 +435,7 @@ namespace tgui
     void TextArea::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -431,6 +450,7 @@ namespace tgui
     void TextArea::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1220,6 +1240,7 @@ namespace tgui
         m_selStart = {0, 0};
         m_selEnd = Vector2<std::size_t>(m_lines[m_lines.size()-1].length(), m_lines.size()-1);
         updateSelectionTexts();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -1268,29 +1289,28 @@ namespace tgui
             else
                 m_lines.push_back(string.substr(searchPosStart));
 
-            if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+            if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
             {
-                if (m_monospacedFontOptimizationEnabled)
-                {
-                    if (m_lines.back().length() > longestLineCharCount)
-                    {
-                        longestLineCharCount = m_lines.back().length();
-                        longestLineIndex = m_lines.size() - 1;
-                    }
-                }
-                else // Not using optimization for monospaced font, so really calculate the width of every line
+                if (m_lines.back().length() > longestLineCharCount)
                 {
-                    float lineWidth = Text::getLineWidth(m_lines.back(), m_fontCached, m_textSize);
-                    if (lineWidth > m_maxLineWidth)
-                        m_maxLineWidth = lineWidth;
+                    longestLineCharCount = m_lines.back().length();
+                    longestLineIndex = m_lines.size() - 1;
                 }
             }
 
             searchPosStart = newLinePos + 1;
         }
 
-        if ((m_horizontalScrollbarPolicy != Scrollbar::Policy::Never) && m_monospacedFontOptimizationEnabled)
-            m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
+        if (m_horizontalScrollbarPolicy != Scrollbar::Policy::Never)
+        {
+            if (m_monospacedFontOptimizationEnabled)
+                m_maxLineWidth = Text::getLineWidth(m_lines[longestLineIndex], m_fontCached, m_textSize);
+            else // Not using optimization for monospaced font, so really calculate the width of every line
+            {
+                const std::vector<float> lineWidths = Text::getLineWidths(m_lines, m_fontCached, m_textSize);
+                m_maxLineWidth = *std::max_element(lineWidths.begin(), lineWidths.end());
+            }
+        }
 
         // Check if we should try to keep our selection
         if (keepSelection)
@@ -71,6 +71,8 @@ namespace tgui
         updateState();
 
         onToggle.emit(this, m_down);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
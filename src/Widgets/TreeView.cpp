@@ -421,6 +421,8 @@ namespace tgui
             createNode(m_nodes, nullptr, hierarchy.back());
 
         markNodesDirty();
+
+        invalidate();
         return true;
     }
 
@@ -429,6 +431,7 @@ namespace tgui
     void TreeView::expand(const std::vector<String>& hierarchy)
     {
         expandOrCollapse(hierarchy, true);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -437,6 +440,7 @@ namespace tgui
     {
         expandOrCollapseAll(m_nodes, true);
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -444,6 +448,7 @@ namespace tgui
     void TreeView::collapse(const std::vector<String>& hierarchy)
     {
         expandOrCollapse(hierarchy, false);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -452,6 +457,7 @@ namespace tgui
     {
         expandOrCollapseAll(m_nodes, false);
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -474,6 +480,7 @@ namespace tgui
             if (m_visibleNodes[i].get() == node)
             {
                 updateSelectedItem(i);
+                invalidate();
                 return true;
             }
         }
@@ -486,6 +493,7 @@ namespace tgui
     void TreeView::deselectItem()
     {
         updateSelectedItem(-1);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -494,6 +502,8 @@ namespace tgui
     {
         const bool ret = removeItemImpl(hierarchy, removeParentsWhenEmpty, 0, m_nodes);
         markNodesDirty();
+
+        invalidate();
         return ret;
     }
 
@@ -503,6 +513,7 @@ namespace tgui
     {
         m_nodes.clear();
         markNodesDirty();
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -599,6 +610,8 @@ namespace tgui
         m_horizontalScrollbar->setScrollAmount(m_itemHeight);
         markNodesDirty();
         updateIconBounds();
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -620,6 +633,8 @@ namespace tgui
             m_textSize = Text::findBestTextSize(m_fontCached, m_itemHeight * 0.8f);
 
         setTextSizeImpl(m_nodes, textSize);
+
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -627,6 +642,7 @@ namespace tgui
     void TreeView::setVerticalScrollbarValue(unsigned int value)
     {
         m_verticalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -641,6 +657,7 @@ namespace tgui
     void TreeView::setHorizontalScrollbarValue(unsigned int value)
     {
         m_horizontalScrollbar->setValue(value);
+        invalidate();
     }
 
     /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
@@ -23,6 +23,7 @@
 /////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Tests.hpp"
+#include <TGUI/Loading/ImageLoader.hpp>
 #include <fstream>
 #include <cstring>
 
@@ -33,23 +34,24 @@
 // Worse test on Github Actions: Clipping_NestedLayers.png at 1.71%
 void compareImageFiles(const tgui::String& filename1, const tgui::String& filename2)
 {
-    sf::Image image1;
-    if (!image1.loadFromFile(filename1.toStdString()))
-        REQUIRE(image1.loadFromFile(filename1.toStdString()));
+    // The images are read with the image loader of TGUI so that the comparison doesn't depend on the backend
+    tgui::Vector2u imageSize1;
+    const auto pixels1 = tgui::ImageLoader::loadFromFile(filename1, imageSize1);
+    if (!pixels1)
+        REQUIRE(pixels1 != nullptr);
 
-    sf::Image image2;
-    if (!image2.loadFromFile(filename2.toStdString()))
-        REQUIRE(image2.loadFromFile(filename2.toStdString()));
+    tgui::Vector2u imageSize2;
+    const auto pixels2 = tgui::ImageLoader::loadFromFile(filename2, imageSize2);
+    if (!pixels2)
+        REQUIRE(pixels2 != nullptr);
 
-    if (image1.getSize() != image2.getSize())
-        REQUIRE(image1.getSize() == image2.getSize());
+    if (imageSize1 != imageSize2)
+        REQUIRE(imageSize1 == imageSize2);
 
     double totalDiff = 0;
-    const sf::Uint8* pixels1 = image1.getPixelsPtr();
-    const sf::Uint8* pixels2 = image2.getPixelsPtr();
-    for (unsigned int y = 0; y < image1.getSize().y; ++y)
+    for (unsigned int y = 0; y < imageSize1.y; ++y)
     {
-        for (unsigned int x = 0; x < image1.getSize().x; ++x)
+        for (unsigned int x = 0; x < imageSize1.x; ++x)
         {
             unsigned int index = ((y * x) + x) * 4;
             totalDiff += std::abs(int(pixels1[index+0]) - int(pixels2[index+0])) / 255.0;
@@ -58,7 +60,7 @@ void compareImageFiles(const tgui::String& filename1, const tgui::String& filena
         }
     }
 
-    double diffPercentage = (totalDiff * 100)  / (image1.getSize().x * image1.getSize().y * 3);
+    double diffPercentage = (totalDiff * 100)  / (imageSize1.x * imageSize1.y * 3);
     REQUIRE(diffPercentage < 1.75);
 }
 
@@ -24,10 +24,11 @@
 
 #include "Tests.hpp"
 #include <TGUI/TGUI.hpp>
+#include <TGUI/TextureManager.hpp>
 
 TEST_CASE("[Container]")
 {
-    auto container = std::make_shared<tgui::GuiSFML>();
+    auto container = std::make_shared<TestGui>();
 
     auto widget1 = tgui::Label::create();
     auto widget2 = tgui::Panel::create();
@@ -43,7 +44,7 @@ TEST_CASE("[Container]")
     SECTION("default font")
     {
         REQUIRE(tgui::Font::getGlobalFont() != nullptr);
-        REQUIRE(std::make_shared<tgui::GuiSFML>()->getFont() != nullptr);
+        REQUIRE(std::make_shared<TestGui>()->getFont() != nullptr);
         REQUIRE(tgui::Panel::create()->getRenderer()->getFont() == nullptr);
     }
 
@@ -340,11 +341,129 @@ TEST_CASE("[Container]")
         REQUIRE(widget5->getInheritedOpacity() == 0.7f);
     }
 
+    SECTION("Render cache")
+    {
+        REQUIRE(!widget2->isRenderCacheEnabled());
+        widget2->setRenderCacheEnabled(true);
+        REQUIRE(widget2->isRenderCacheEnabled());
+
+        auto copiedPanel = tgui::Panel::copy(widget2);
+        REQUIRE(copiedPanel->isRenderCacheEnabled());
+
+        widget2->setRenderCacheEnabled(false);
+        REQUIRE(!widget2->isRenderCacheEnabled());
+        REQUIRE(copiedPanel->isRenderCacheEnabled());
+
+#if !TGUI_HAS_BACKEND_SFML
+        SECTION("Redrawing only after changes")
+        {
+            tgui::GuiSoftware gui{{200, 100}};
+
+            auto panel = tgui::Panel::create({100, 50});
+            panel->setRenderCacheEnabled(true);
+            gui.add(panel);
+
+            auto label = tgui::Label::create("Text");
+            panel->add(label);
+
+            tgui::Container::resetRenderCacheStatistics();
+            gui.draw();
+            REQUIRE(tgui::Container::getRenderCacheStatistics().misses == 1);
+            REQUIRE(tgui::Container::getRenderCacheStatistics().hits == 0);
+
+            gui.draw();
+            panel->setPosition(20, 30);
+            gui.draw();
+            REQUIRE(tgui::Container::getRenderCacheStatistics().misses == 1);
+            REQUIRE(tgui::Container::getRenderCacheStatistics().hits == 2);
+
+            label->setText("Changed");
+            gui.draw();
+            REQUIRE(tgui::Container::getRenderCacheStatistics().misses == 2);
+
+            panel->add(tgui::Button::create("Button"));
+            gui.draw();
+            REQUIRE(tgui::Container::getRenderCacheStatistics().misses == 3);
+            REQUIRE(tgui::Container::getRenderCacheStatistics().hits == 2);
+        }
+#endif
+    }
+
+#if !TGUI_HAS_BACKEND_SFML
+    SECTION("Damage tracking")
+    {
+        tgui::GuiSoftware gui{{200, 100}};
+
+        auto button = tgui::Button::create("Hello");
+        button->setPosition(20, 20);
+        button->setSize(60, 30);
+        gui.add(button);
+
+        auto label = tgui::Label::create("Text");
+        label->setPosition(120, 60);
+        gui.add(label);
+
+        auto picture = tgui::Picture::create("resources/image.png");
+        picture->setPosition(140, 0);
+        gui.add(picture);
+
+        gui.setDamageTrackingEnabled(true);
+        REQUIRE(gui.getDamagedRegions().size() == 1);
+
+        gui.getRenderTarget()->clear({25, 130, 10});
+        gui.draw();
+        REQUIRE(gui.getDamagedRegions().empty());
+
+        button->setText("World");
+        const auto regions = gui.getDamagedRegions();
+        REQUIRE(regions.size() == 1);
+        REQUIRE(regions[0].left >= 18);
+        REQUIRE(regions[0].top >= 18);
+        REQUIRE(regions[0].left + regions[0].width <= 82);
+        REQUIRE(regions[0].top + regions[0].height <= 52);
+
+        for (const auto& region : regions)
+            gui.getRenderTarget()->clear({25, 130, 10}, region);
+        gui.draw();
+        REQUIRE(gui.getDamagedRegions().empty());
+
+        const std::vector<std::uint8_t> partialRedraw(gui.getRenderTarget()->getPixels(), gui.getRenderTarget()->getPixels() + 200 * 100 * 4);
+
+        gui.invalidate();
+        gui.getRenderTarget()->clear({25, 130, 10});
+        gui.draw();
+
+        const std::vector<std::uint8_t> fullRedraw(gui.getRenderTarget()->getPixels(), gui.getRenderTarget()->getPixels() + 200 * 100 * 4);
+        REQUIRE(partialRedraw == fullRedraw);
+
+        // The picture is still shown when only the button is redrawn, so its image isn't evicted
+        const auto pictureData = picture->getRenderer()->getTexture().getData();
+        tgui::TextureManager::setMemoryBudget(1);
+        button->setText("Hello");
+        gui.draw();
+        gui.draw();
+        REQUIRE(!pictureData->evicted);
+
+        // Once everything was redrawn without the picture, its image is known to be unused
+        picture->setVisible(false);
+        gui.draw();
+        gui.draw();
+        REQUIRE(!pictureData->evicted);
+        gui.draw();
+        REQUIRE(pictureData->evicted);
+        tgui::TextureManager::setMemoryBudget(0);
+    }
+#endif
+
     SECTION("getWidgetAtPosition / getWidgetBelowMouseCursor")
     {
+#if TGUI_HAS_BACKEND_SFML
         sf::RenderTexture renderTexture;
         renderTexture.create(200, 200);
         container->setTarget(renderTexture);
+#else
+        container->setSize({200, 200});
+#endif
         container->setAbsoluteView({-5, 40, 100, 400});
 
         container->removeAllWidgets();
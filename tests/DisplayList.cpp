@@ -0,0 +1,156 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/DisplayList.hpp>
+#include <TGUI/BackendRenderTargetRecorder.hpp>
+
+TEST_CASE("[DisplayList]")
+{
+    using CommandType = tgui::DisplayList::CommandType;
+
+    tgui::BackendRenderTargetRecorder recorder;
+    recorder.setView({0, 0, 400, 300}, {0, 0, 400, 300});
+
+    tgui::RenderStates states;
+    states.transform.translate({10, 20});
+
+    tgui::Sprite sprite{"resources/image.png"};
+    sprite.setPosition({5, 5});
+
+    tgui::Text text;
+    text.setString("Hello");
+    text.setFont(tgui::Font::getGlobalFont());
+
+    const std::vector<tgui::Vertex> vertices = {
+        {{0, 0}, {255, 0, 0}}, {{10, 0}, {255, 0, 0}}, {{0, 10}, {255, 0, 0}}
+    };
+
+    const auto recordCommands = [&]{
+        recorder.addClippingLayer(states, {0, 0, 100, 50});
+        recorder.drawFilledRect(states, {100, 50}, tgui::Color::Red);
+        recorder.drawBorders(states, {1, 2, 3, 4}, {100, 50}, tgui::Color::Blue);
+        recorder.drawSprite(states, sprite);
+        recorder.drawText(states, text);
+        recorder.drawTriangles(states, vertices.data(), vertices.size());
+        recorder.removeClippingLayer();
+    };
+
+    recordCommands();
+
+    const tgui::DisplayList& displayList = recorder.getDisplayList();
+    REQUIRE(displayList.getCommandCount() == 7);
+    REQUIRE(displayList.getCommandType(0) == CommandType::AddClippingLayer);
+    REQUIRE(displayList.getCommandType(1) == CommandType::DrawFilledRect);
+    REQUIRE(displayList.getCommandType(2) == CommandType::DrawBorders);
+    REQUIRE(displayList.getCommandType(3) == CommandType::DrawSprite);
+    REQUIRE(displayList.getCommandType(4) == CommandType::DrawText);
+    REQUIRE(displayList.getCommandType(5) == CommandType::DrawTriangles);
+    REQUIRE(displayList.getCommandType(6) == CommandType::RemoveClippingLayer);
+
+    SECTION("Comparing")
+    {
+        const tgui::DisplayList previousFrame = displayList;
+        REQUIRE(previousFrame == displayList);
+
+        recorder.clear();
+        REQUIRE(displayList.getCommandCount() == 0);
+        REQUIRE(previousFrame != displayList);
+
+        recordCommands();
+        REQUIRE(previousFrame == displayList);
+
+        recorder.clear();
+        text.setString("World");
+        recordCommands();
+        REQUIRE(previousFrame != displayList);
+
+        recorder.clear();
+        text.setString("Hello");
+        states.transform.translate({1, 0});
+        recordCommands();
+        REQUIRE(previousFrame != displayList);
+    }
+
+    SECTION("Bounds")
+    {
+        const tgui::FloatRect bounds = displayList.getBounds();
+        REQUIRE(bounds.left <= 10);
+        REQUIRE(bounds.top <= 20);
+        REQUIRE(bounds.left + bounds.width >= 110);
+        REQUIRE(bounds.top + bounds.height >= 70);
+
+        REQUIRE(tgui::DisplayList{}.getBounds() == tgui::FloatRect{});
+    }
+
+    SECTION("Replaying")
+    {
+        tgui::BackendRenderTargetRecorder otherRecorder;
+        displayList.replay(otherRecorder);
+        REQUIRE(otherRecorder.getDisplayList() == displayList);
+    }
+
+    SECTION("Saving and loading")
+    {
+        REQUIRE_NOTHROW(displayList.saveToFile("DisplayList.tdl"));
+
+        tgui::DisplayList loadedList;
+        REQUIRE_NOTHROW(loadedList.loadFromFile("DisplayList.tdl"));
+        REQUIRE(loadedList.getCommandCount() == displayList.getCommandCount());
+        for (std::size_t i = 0; i < displayList.getCommandCount(); ++i)
+            REQUIRE(loadedList.getCommandType(i) == displayList.getCommandType(i));
+
+        // The texture is reloaded from the same file, so the sprite is shared through the texture manager
+        tgui::BackendRenderTargetRecorder otherRecorder;
+        loadedList.replay(otherRecorder);
+        REQUIRE(otherRecorder.getDisplayList() == loadedList);
+
+        REQUIRE_THROWS_AS(loadedList.loadFromFile("NonExistentFile.tdl"), tgui::Exception);
+        REQUIRE_THROWS_AS(loadedList.loadFromFile("resources/image.png"), tgui::Exception);
+        REQUIRE(loadedList.getCommandCount() == displayList.getCommandCount());
+
+        // Triangle commands without vertices are dropped while loading
+        tgui::DisplayList emptyTrianglesList;
+        emptyTrianglesList.addFilledRect(states, {100, 50}, tgui::Color::Red);
+        emptyTrianglesList.addTriangles(states, nullptr, 0);
+        REQUIRE(emptyTrianglesList.getCommandCount() == 2);
+        REQUIRE_NOTHROW(emptyTrianglesList.saveToFile("DisplayList.tdl"));
+        REQUIRE_NOTHROW(loadedList.loadFromFile("DisplayList.tdl"));
+        REQUIRE(loadedList.getCommandCount() == 1);
+        REQUIRE(loadedList.getCommandType(0) == CommandType::DrawFilledRect);
+
+        // Clipping layers have to be balanced
+        tgui::DisplayList unbalancedList;
+        unbalancedList.addClippingLayer(states, {0, 0, 100, 50});
+        REQUIRE_NOTHROW(unbalancedList.saveToFile("DisplayList.tdl"));
+        REQUIRE_THROWS_AS(loadedList.loadFromFile("DisplayList.tdl"), tgui::Exception);
+
+        unbalancedList.clear();
+        unbalancedList.removeClippingLayer();
+        REQUIRE_NOTHROW(unbalancedList.saveToFile("DisplayList.tdl"));
+        REQUIRE_THROWS_AS(loadedList.loadFromFile("DisplayList.tdl"), tgui::Exception);
+        REQUIRE(loadedList.getCommandCount() == 1);
+    }
+}
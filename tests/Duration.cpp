@@ -41,43 +41,73 @@ TEST_CASE("[Duration]")
             REQUIRE(tgui::Duration(std::chrono::microseconds(10) / 5.0) == std::chrono::nanoseconds(2000));
             REQUIRE(tgui::Duration(0) == std::chrono::nanoseconds(0));
             REQUIRE(tgui::Duration(15) == std::chrono::milliseconds(15));
+#if TGUI_HAS_BACKEND_SFML
             REQUIRE(tgui::Duration(sf::milliseconds(20)) == std::chrono::milliseconds(20));
+#endif
         }
     }
 
     SECTION("Conversions")
     {
+#if TGUI_HAS_BACKEND_SFML
         REQUIRE(sf::Time(tgui::Duration(std::chrono::milliseconds(50))).asMilliseconds() == 50);
         REQUIRE(std::chrono::duration<int>(tgui::Duration(sf::milliseconds(10000))).count() == 10);
         REQUIRE(std::chrono::nanoseconds(tgui::Duration(sf::microseconds(3))).count() == 3000);
+#endif
+        REQUIRE(std::chrono::duration<int>(tgui::Duration(std::chrono::milliseconds(10000))).count() == 10);
     }
 
     SECTION("Comparison operators")
     {
+#if TGUI_HAS_BACKEND_SFML
         REQUIRE(tgui::Duration(std::chrono::microseconds(20000)) == tgui::Duration(sf::milliseconds(20)));
         REQUIRE(tgui::Duration(std::chrono::microseconds(30000)) != tgui::Duration(sf::milliseconds(20)));
         REQUIRE(tgui::Duration(std::chrono::microseconds(19000)) < tgui::Duration(sf::milliseconds(20)));
         REQUIRE(tgui::Duration(std::chrono::microseconds(19000)) <= tgui::Duration(sf::milliseconds(20)));
         REQUIRE(tgui::Duration(std::chrono::microseconds(21000)) >= tgui::Duration(sf::milliseconds(20)));
         REQUIRE(tgui::Duration(std::chrono::microseconds(21000)) >= tgui::Duration(sf::milliseconds(20)));
+#else
+        REQUIRE(tgui::Duration(std::chrono::microseconds(20000)) == tgui::Duration(std::chrono::milliseconds(20)));
+        REQUIRE(tgui::Duration(std::chrono::microseconds(30000)) != tgui::Duration(std::chrono::milliseconds(20)));
+        REQUIRE(tgui::Duration(std::chrono::microseconds(19000)) < tgui::Duration(std::chrono::milliseconds(20)));
+        REQUIRE(tgui::Duration(std::chrono::microseconds(19000)) <= tgui::Duration(std::chrono::milliseconds(20)));
+        REQUIRE(tgui::Duration(std::chrono::microseconds(21000)) >= tgui::Duration(std::chrono::milliseconds(20)));
+        REQUIRE(tgui::Duration(std::chrono::microseconds(21000)) >= tgui::Duration(std::chrono::milliseconds(20)));
+#endif
     }
 
     SECTION("Arithmetic operators")
     {
+#if TGUI_HAS_BACKEND_SFML
         REQUIRE(tgui::Duration(std::chrono::microseconds(20000)) + tgui::Duration(sf::milliseconds(30)) == tgui::Duration(std::chrono::milliseconds(50)));
         REQUIRE(tgui::Duration(std::chrono::microseconds(20000)) - tgui::Duration(sf::milliseconds(5)) == tgui::Duration(std::chrono::milliseconds(15)));
         REQUIRE(tgui::Duration(sf::milliseconds(30)) * 20 == tgui::Duration(std::chrono::milliseconds(600)));
         REQUIRE(10.0 * tgui::Duration(sf::milliseconds(30)) == tgui::Duration(std::chrono::milliseconds(300)));
         REQUIRE(tgui::Duration(sf::milliseconds(30)) / 2.f == tgui::Duration(std::chrono::milliseconds(15)));
         REQUIRE(tgui::Duration(sf::milliseconds(5000)) / tgui::Duration(std::chrono::microseconds(2000000)) == 2.5f);
+#else
+        REQUIRE(tgui::Duration(std::chrono::microseconds(20000)) + tgui::Duration(std::chrono::milliseconds(30)) == tgui::Duration(std::chrono::milliseconds(50)));
+        REQUIRE(tgui::Duration(std::chrono::microseconds(20000)) - tgui::Duration(std::chrono::milliseconds(5)) == tgui::Duration(std::chrono::milliseconds(15)));
+        REQUIRE(tgui::Duration(std::chrono::milliseconds(30)) * 20 == tgui::Duration(std::chrono::milliseconds(600)));
+        REQUIRE(10.0 * tgui::Duration(std::chrono::milliseconds(30)) == tgui::Duration(std::chrono::milliseconds(300)));
+        REQUIRE(tgui::Duration(std::chrono::milliseconds(30)) / 2.f == tgui::Duration(std::chrono::milliseconds(15)));
+        REQUIRE(tgui::Duration(std::chrono::milliseconds(5000)) / tgui::Duration(std::chrono::microseconds(2000000)) == 2.5f);
+#endif
         REQUIRE(tgui::Duration(std::chrono::nanoseconds(100)) % 3 == tgui::Duration(std::chrono::nanoseconds(1)));
         REQUIRE(tgui::Duration(std::chrono::nanoseconds(100)) % std::chrono::nanoseconds(6) == tgui::Duration(std::chrono::nanoseconds(4)));
 
         tgui::Duration d;
+#if TGUI_HAS_BACKEND_SFML
         d = tgui::Duration(std::chrono::microseconds(20000)); REQUIRE((d += tgui::Duration(sf::milliseconds(30))) == tgui::Duration(std::chrono::milliseconds(50)));
         d = tgui::Duration(std::chrono::microseconds(20000)); REQUIRE((d -= tgui::Duration(sf::milliseconds(5))) == tgui::Duration(std::chrono::milliseconds(15)));
         d = tgui::Duration(sf::milliseconds(30)); REQUIRE((d *= 20) == tgui::Duration(std::chrono::milliseconds(600)));
         d = tgui::Duration(sf::milliseconds(30)); REQUIRE((d /= 2.f) == tgui::Duration(std::chrono::milliseconds(15)));
+#else
+        d = tgui::Duration(std::chrono::microseconds(20000)); REQUIRE((d += tgui::Duration(std::chrono::milliseconds(30))) == tgui::Duration(std::chrono::milliseconds(50)));
+        d = tgui::Duration(std::chrono::microseconds(20000)); REQUIRE((d -= tgui::Duration(std::chrono::milliseconds(5))) == tgui::Duration(std::chrono::milliseconds(15)));
+        d = tgui::Duration(std::chrono::milliseconds(30)); REQUIRE((d *= 20) == tgui::Duration(std::chrono::milliseconds(600)));
+        d = tgui::Duration(std::chrono::milliseconds(30)); REQUIRE((d /= 2.f) == tgui::Duration(std::chrono::milliseconds(15)));
+#endif
         d = tgui::Duration(std::chrono::nanoseconds(100)); REQUIRE((d %= 3) == tgui::Duration(std::chrono::nanoseconds(1)));
         d = tgui::Duration(std::chrono::nanoseconds(100)); REQUIRE((d %= std::chrono::nanoseconds(6)) == tgui::Duration(std::chrono::nanoseconds(4)));
     }
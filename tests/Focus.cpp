@@ -136,7 +136,7 @@ static bool widgetFocused(tgui::Widget::Ptr widget)
 
 TEST_CASE("[Focussing widgets]")
 {
-    tgui::GuiSFML gui;
+    TestGui gui;
     rootContainer = gui.getContainer();
 
     auto button = tgui::Button::create("Click me");
@@ -399,6 +399,7 @@ TEST_CASE("[Focussing widgets]")
 
     SECTION("Gui interaction")
     {
+#if TGUI_HAS_BACKEND_SFML
         sf::RenderTexture target;
         target.create(250, 530);
         gui.setTarget(target);
@@ -442,6 +443,37 @@ TEST_CASE("[Focussing widgets]")
         event.type = sf::Event::KeyReleased;
         gui.handleEvent(event);
         REQUIRE(widgetFocused(radioButton1));
+#else
+        gui.setSize({250, 530});
+
+        tgui::Event event;
+        event.type = tgui::Event::Type::MouseButtonPressed;
+        event.mouseButton.button = tgui::Event::MouseButton::Left;
+        event.mouseButton.x = 55;
+        event.mouseButton.y = 145;
+        gui.handleEvent(event);
+        REQUIRE(widgetFocused(radioButton2));
+
+        event.type = tgui::Event::Type::MouseButtonReleased;
+        gui.handleEvent(event);
+        REQUIRE(widgetFocused(radioButton2));
+
+        event.type = tgui::Event::Type::KeyPressed;
+        event.key.control = false;
+        event.key.alt     = false;
+        event.key.shift   = false;
+        event.key.system  = false;
+        event.key.code    = tgui::Event::KeyboardKey::Tab;
+        gui.handleEvent(event);
+        REQUIRE(widgetFocused(editBox));
+
+        event.key.shift = true;
+        gui.handleEvent(event);
+        REQUIRE(widgetFocused(radioButton2));
+
+        gui.handleEvent(event);
+        REQUIRE(widgetFocused(radioButton1));
+#endif
     }
 
     rootContainer = nullptr;
@@ -0,0 +1,84 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/FontFileCache.hpp>
+#include <TGUI/Font.hpp>
+
+TEST_CASE("[FontFileCache]")
+{
+    SECTION("Loading from file")
+    {
+        REQUIRE(tgui::FontFileCache::loadFromFile("resources/NonExistentFont.ttf") == nullptr);
+
+        const auto oldStatistics = tgui::FontFileCache::getStatistics();
+
+        auto contents1 = tgui::FontFileCache::loadFromFile("resources/DejaVuSans.ttf");
+        auto contents2 = tgui::FontFileCache::loadFromFile("resources/DejaVuSans.ttf");
+        REQUIRE(contents1 != nullptr);
+        REQUIRE(contents1 == contents2);
+        REQUIRE(contents1->getSize() > 0);
+
+        const auto statistics = tgui::FontFileCache::getStatistics();
+        REQUIRE(statistics.sharedLoads == oldStatistics.sharedLoads + 1);
+        REQUIRE(statistics.mappedBytes + statistics.copiedBytes >= contents1->getSize());
+    }
+
+    SECTION("Loading from memory")
+    {
+        REQUIRE(tgui::FontFileCache::loadFromMemory(nullptr, 0) == nullptr);
+
+        const tgui::MemoryMappedFile file{"resources/DejaVuSans.ttf"};
+        REQUIRE(file.isOpen());
+
+        const std::size_t fileSize = file.getSize();
+        const auto fileCopy = std::make_unique<std::uint8_t[]>(fileSize);
+        std::copy(file.getData(), file.getData() + fileSize, fileCopy.get());
+
+        auto contents1 = tgui::FontFileCache::loadFromMemory(file.getData(), fileSize);
+        auto contents2 = tgui::FontFileCache::loadFromMemory(fileCopy.get(), fileSize);
+        REQUIRE(contents1 != nullptr);
+        REQUIRE(contents1 == contents2);
+        REQUIRE(contents1->getData() != file.getData());
+        REQUIRE(!contents1->isMapped());
+
+        // Different data isn't shared
+        fileCopy[fileSize - 1] ^= 1;
+        auto contents3 = tgui::FontFileCache::loadFromMemory(fileCopy.get(), fileSize);
+        REQUIRE(contents3 != contents1);
+    }
+
+    SECTION("Fonts share the file")
+    {
+        const auto oldStatistics = tgui::FontFileCache::getStatistics();
+
+        tgui::Font font1{"resources/DejaVuSans.ttf"};
+        tgui::Font font2{"resources/DejaVuSans.ttf"};
+        REQUIRE(font1.getLineSpacing(20) == font2.getLineSpacing(20));
+
+        const auto statistics = tgui::FontFileCache::getStatistics();
+        REQUIRE(statistics.sharedLoads > oldStatistics.sharedLoads);
+    }
+}
@@ -0,0 +1,80 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/GlyphAtlasCache.hpp>
+
+TEST_CASE("[GlyphAtlasCache]")
+{
+    tgui::GlyphAtlasCache::Contents contents;
+    contents.atlasSize = {4, 3};
+    contents.pixels = {0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11};
+    contents.rows.push_back({0, 3, 2});
+    contents.glyphs.push_back({0x410000000041u, {0, 0, 2, 3}, {1.5f, -2.f}, 3.25f});
+
+    SECTION("Directory")
+    {
+        REQUIRE(tgui::GlyphAtlasCache::getDirectory().empty());
+        REQUIRE(tgui::GlyphAtlasCache::getFilename("software", 1).empty());
+
+        tgui::GlyphAtlasCache::setDirectory(".");
+        REQUIRE(tgui::GlyphAtlasCache::getDirectory() == ".");
+        REQUIRE(tgui::GlyphAtlasCache::getFilename("software", 1) != tgui::GlyphAtlasCache::getFilename("software", 2));
+        REQUIRE(tgui::GlyphAtlasCache::getFilename("software", 1) != tgui::GlyphAtlasCache::getFilename("sdl", 1));
+
+        tgui::GlyphAtlasCache::setDirectory("");
+    }
+
+    SECTION("Saving and loading")
+    {
+        REQUIRE(tgui::GlyphAtlasCache::saveToFile("GlyphAtlasCache.glyphs", "software", 1234, contents));
+
+        tgui::GlyphAtlasCache::Contents loadedContents;
+        REQUIRE(tgui::GlyphAtlasCache::loadFromFile("GlyphAtlasCache.glyphs", "software", 1234, loadedContents));
+        REQUIRE(loadedContents.atlasSize == contents.atlasSize);
+        REQUIRE(loadedContents.pixels == contents.pixels);
+        REQUIRE(loadedContents.rows.size() == 1);
+        REQUIRE(loadedContents.rows[0].top == 0);
+        REQUIRE(loadedContents.rows[0].height == 3);
+        REQUIRE(loadedContents.rows[0].width == 2);
+        REQUIRE(loadedContents.glyphs.size() == 1);
+        REQUIRE(loadedContents.glyphs[0].key == contents.glyphs[0].key);
+        REQUIRE(loadedContents.glyphs[0].textureRect == contents.glyphs[0].textureRect);
+        REQUIRE(loadedContents.glyphs[0].offset == contents.glyphs[0].offset);
+        REQUIRE(loadedContents.glyphs[0].advance == contents.glyphs[0].advance);
+    }
+
+    SECTION("Invalid cache files are ignored")
+    {
+        REQUIRE(tgui::GlyphAtlasCache::saveToFile("GlyphAtlasCache.glyphs", "software", 1234, contents));
+
+        tgui::GlyphAtlasCache::Contents loadedContents;
+        REQUIRE(!tgui::GlyphAtlasCache::loadFromFile("NonExistentFile.glyphs", "software", 1234, loadedContents));
+        REQUIRE(!tgui::GlyphAtlasCache::loadFromFile("GlyphAtlasCache.glyphs", "software", 4321, loadedContents));
+        REQUIRE(!tgui::GlyphAtlasCache::loadFromFile("GlyphAtlasCache.glyphs", "sdl", 1234, loadedContents));
+        REQUIRE(!tgui::GlyphAtlasCache::loadFromFile("resources/image.png", "software", 1234, loadedContents));
+        REQUIRE(loadedContents.pixels.empty());
+    }
+}
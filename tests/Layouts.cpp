@@ -25,8 +25,9 @@
 #include "Tests.hpp"
 #include <TGUI/Widgets/Button.hpp>
 #include <TGUI/Widgets/Panel.hpp>
-#include <TGUI/Backends/SFML/GuiSFML.hpp>
-#include <SFML/Graphics/RenderTexture.hpp>
+#if TGUI_HAS_BACKEND_SFML
+    #include <SFML/Graphics/RenderTexture.hpp>
+#endif
 
 using namespace tgui::bind_functions;
 using tgui::Layout;
@@ -221,9 +222,13 @@ TEST_CASE("[Layouts]")
 
             SECTION("Gui")
             {
+#if TGUI_HAS_BACKEND_SFML
                 sf::RenderTexture texture;
                 texture.create(20, 15);
                 tgui::GuiSFML gui{texture};
+#else
+                tgui::GuiSoftware gui{{20, 15}};
+#endif
 
                 auto width = bindWidth(gui);
                 auto height = bindHeight(gui);
@@ -0,0 +1,78 @@
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// TGUI - Texus' Graphical User Interface
+// Copyright (C) 2012-2021 Bruno Van de Velde (vdv_b@tgui.eu)
+//
+// This software is provided 'as-is', without any express or implied warranty.
+// In no event will the authors be held liable for any damages arising from the use of this software.
+//
+// Permission is granted to anyone to use this software for any purpose,
+// including commercial applications, and to alter it and redistribute it freely,
+// subject to the following restrictions:
+//
+// 1. The origin of this software must not be misrepresented;
+//    you must not claim that you wrote the original software.
+//    If you use this software in a product, an acknowledgment
+//    in the product documentation would be appreciated but is not required.
+//
+// 2. Altered source versions must be plainly marked as such,
+//    and must not be misrepresented as being the original software.
+//
+// 3. This notice may not be removed or altered from any source distribution.
+//
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
+
+
+#include "Tests.hpp"
+#include <TGUI/MemoryMappedFile.hpp>
+
+TEST_CASE("[MemoryMappedFile]")
+{
+    SECTION("Open")
+    {
+        tgui::MemoryMappedFile file;
+        REQUIRE(!file.isOpen());
+        REQUIRE(file.getData() == nullptr);
+        REQUIRE(file.getSize() == 0);
+
+        REQUIRE(file.open("resources/image.png"));
+        REQUIRE(file.isOpen());
+        REQUIRE(file.getSize() == 2485);
+        REQUIRE(file.getData()[0] == 0x89);
+        REQUIRE(file.getData()[1] == 'P');
+        REQUIRE(file.getData()[2] == 'N');
+        REQUIRE(file.getData()[3] == 'G');
+
+        file.close();
+        REQUIRE(!file.isOpen());
+        REQUIRE(!file.isMapped());
+        REQUIRE(file.getSize() == 0);
+    }
+
+    SECTION("Non-existent file")
+    {
+        tgui::MemoryMappedFile file("resources/NonExistentFile.png");
+        REQUIRE(!file.isOpen());
+        REQUIRE(file.getData() == nullptr);
+
+        REQUIRE(!file.open("resources"));
+        REQUIRE(!file.isOpen());
+    }
+
+    SECTION("Move")
+    {
+        tgui::MemoryMappedFile file1("resources/image.png");
+        const std::uint8_t* data = file1.getData();
+
+        tgui::MemoryMappedFile file2(std::move(file1));
+        REQUIRE(!file1.isOpen());
+        REQUIRE(file2.isOpen());
+        REQUIRE(file2.getData() == data);
+        REQUIRE(file2.getSize() == 2485);
+
+        tgui::MemoryMappedFile file3;
+        file3 = std::move(file2);
+        REQUIRE(!file2.isOpen());
+        REQUIRE(file3.getData() == data);
+    }
+}
@@ -89,7 +89,9 @@ TEST_CASE("[String]")
         REQUIRE(tgui::String(u16s.begin(), u16s.end()) == u"\u03b1\u03b2\u03b3\u03b4\u03b5");
         REQUIRE(tgui::String(u32s.begin(), u32s.end()) == U"\u03b1\u03b2\u03b3\u03b4\u03b5");
 
+#if TGUI_HAS_BACKEND_SFML
         REQUIRE(tgui::String(sf::String("xyz")) == "xyz");
+#endif
 
 #if defined(__cpp_lib_char8_t) && (__cpp_lib_char8_t >= 201811L)
         REQUIRE(tgui::String(std::u8string(u8"\U00010348")) == u8"\U00010348");
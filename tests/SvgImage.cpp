@@ -25,6 +25,7 @@
 #include "Tests.hpp"
 #include <TGUI/SvgImage.hpp>
 #include <TGUI/Backend.hpp>
+#include <TGUI/Sprite.hpp>
 #include <TGUI/Widgets/Picture.hpp>
 
 TEST_CASE("[SvgImage]")
@@ -53,6 +54,42 @@ TEST_CASE("[SvgImage]")
         REQUIRE(tgui::Vector2u{texture->getSize()} == tgui::Vector2u{100, 100});
     }
 
+    SECTION("Raster cache")
+    {
+        tgui::SvgImage::clearRasterCache();
+        tgui::SvgImage::resetRasterCacheStatistics();
+
+        tgui::Sprite sprite1{"resources/SFML.svg"};
+        tgui::Sprite sprite2{"resources/SFML.svg"};
+        sprite1.setSize({60, 60});
+        sprite2.setSize({60, 60});
+        REQUIRE(sprite1.getSvgTexture() != nullptr);
+        REQUIRE(sprite1.getSvgTexture() == sprite2.getSvgTexture());
+
+        sprite2.setSize({80, 80});
+        REQUIRE(sprite1.getSvgTexture() != sprite2.getSvgTexture());
+        REQUIRE(tgui::Vector2u{sprite2.getSvgTexture()->getSize()} == tgui::Vector2u{80, 80});
+
+        auto statistics = tgui::SvgImage::getRasterCacheStatistics();
+        REQUIRE(statistics.hits >= 1);
+        REQUIRE(statistics.misses >= 2);
+        REQUIRE(statistics.textureMemory >= (60 * 60 * 4) + (80 * 80 * 4));
+
+        const std::size_t oldLimit = tgui::SvgImage::getRasterCacheMemoryLimit();
+        tgui::SvgImage::setRasterCacheMemoryLimit(0);
+        REQUIRE(tgui::SvgImage::getRasterCacheMemoryLimit() == 0);
+
+        // Textures that are still used by a sprite are never removed from the cache
+        statistics = tgui::SvgImage::getRasterCacheStatistics();
+        REQUIRE(statistics.textureCount >= 2);
+
+        sprite2 = tgui::Sprite{};
+        tgui::SvgImage::setRasterCacheMemoryLimit(0);
+        REQUIRE(tgui::SvgImage::getRasterCacheStatistics().textureCount < statistics.textureCount);
+
+        tgui::SvgImage::setRasterCacheMemoryLimit(oldLimit);
+    }
+
     SECTION("Drawing svg")
     {
         auto picture = tgui::Picture::create("resources/SFML.svg");
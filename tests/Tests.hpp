@@ -36,33 +36,54 @@
 #endif
 
 #include "catch.hpp"
-#include <SFML/Graphics/RenderTexture.hpp>
-#include <TGUI/Backends/SFML/GuiSFML.hpp>
+#if TGUI_HAS_BACKEND_SFML
+    #include <SFML/Graphics/RenderTexture.hpp>
+    #include <TGUI/Backends/SFML/GuiSFML.hpp>
+#else
+    #include <TGUI/Backends/Software/GuiSoftware.hpp>
+    #include <TGUI/Backends/Software/BackendRenderTargetSoftware.hpp>
+#endif
 #include <TGUI/Container.hpp>
 #include <TGUI/Widgets/ClickableWidget.hpp>
 #include <TGUI/Widgets/Panel.hpp>
 #include <TGUI/Loading/Theme.hpp>
 #include <TGUI/Loading/Serializer.hpp>
 
-#define TEST_DRAW_INIT(width, height, widget) \
-            sf::RenderTexture target; \
-            target.create(width, height); \
-            tgui::GuiSFML gui{target}; \
-            gui.add(widget);
+// The tests are run with the SFML backend when it is available, otherwise the software backend is used
+#if TGUI_HAS_BACKEND_SFML
+    using TestGui = tgui::GuiSFML;
 
-#ifdef TGUI_ENABLE_DRAW_TESTS
-    #define TEST_DRAW(filename) \
+    #define TEST_DRAW_INIT(width, height, widget) \
+                sf::RenderTexture target; \
+                target.create(width, height); \
+                tgui::GuiSFML gui{target}; \
+                gui.add(widget);
+
+    #define TEST_DRAW_SAVE(filename) \
                 target.clear({25, 130, 10}); \
                 gui.draw(); \
                 target.display(); \
-                target.getTexture().copyToImage().saveToFile(filename); \
+                target.getTexture().copyToImage().saveToFile(filename);
+#else
+    using TestGui = tgui::GuiSoftware;
+
+    #define TEST_DRAW_INIT(width, height, widget) \
+                tgui::GuiSoftware gui{{width, height}}; \
+                gui.add(widget);
+
+    #define TEST_DRAW_SAVE(filename) \
+                gui.getRenderTarget()->clear({25, 130, 10}); \
+                gui.draw(); \
+                gui.getRenderTarget()->saveToFile(filename);
+#endif
+
+#ifdef TGUI_ENABLE_DRAW_TESTS
+    #define TEST_DRAW(filename) \
+                TEST_DRAW_SAVE(filename) \
                 compareImageFiles(filename, "expected/" filename);
 #else
     #define TEST_DRAW(filename) \
-                target.clear({25, 130, 10}); \
-                gui.draw(); \
-                target.display(); \
-                target.getTexture().copyToImage().saveToFile(filename);
+                TEST_DRAW_SAVE(filename)
 #endif
 
 static const std::chrono::milliseconds DOUBLE_CLICK_TIMEOUT = std::chrono::milliseconds(500);
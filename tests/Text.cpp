@@ -136,4 +136,30 @@ TEST_CASE("[Text]")
             REQUIRE(text.getSize().y == text3.getSize().y);
         }
     }
+
+    SECTION("Measuring multiple lines")
+    {
+        const tgui::Font font{"resources/DejaVuSans.ttf"};
+        const std::vector<tgui::String> lines = {"", "AVAV", "Tab\tbed", "Line\r\nbreak", U"\u00CAg\u00EA", "xy"};
+
+        REQUIRE(tgui::Text::getLineWidths(lines, nullptr, 20).size() == lines.size());
+        REQUIRE(tgui::Text::getLineWidths(lines, nullptr, 20)[1] == 0);
+
+        for (const auto style : {tgui::TextStyles{tgui::TextStyle::Regular}, tgui::TextStyles{tgui::TextStyle::Bold}})
+        {
+            const std::vector<float> widths = tgui::Text::getLineWidths(lines, font, 20, style);
+            REQUIRE(widths.size() == lines.size());
+            for (std::size_t i = 0; i < lines.size(); ++i)
+                REQUIRE(widths[i] == tgui::Text::getLineWidth(lines[i], font, 20, style));
+        }
+
+        // The threads are only used when there are a lot of characters
+        std::vector<tgui::String> manyLines(20000, "The quick brown fox jumps over the lazy dog. The quick brown fox jumps over the lazy dog.");
+        manyLines[1] = U"\u00CAg\u00EA";
+        const std::vector<float> widths = tgui::Text::getLineWidths(manyLines, font, 20, tgui::TextStyle::Regular, true);
+        REQUIRE(widths.size() == manyLines.size());
+        REQUIRE(widths[0] == tgui::Text::getLineWidth(manyLines[0], font, 20));
+        REQUIRE(widths[1] == tgui::Text::getLineWidth(manyLines[1], font, 20));
+        REQUIRE(widths.back() == widths[0]);
+    }
 }
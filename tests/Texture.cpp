@@ -26,8 +26,11 @@
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
 #include <TGUI/TextureManager.hpp>
-#include <TGUI/Backends/SFML.hpp>
-#include <SFML/System/Err.hpp>
+#include <TGUI/Backend.hpp>
+#if TGUI_HAS_BACKEND_SFML
+    #include <TGUI/Backends/SFML.hpp>
+    #include <SFML/System/Err.hpp>
+#endif
 
 TEST_CASE("[Texture]")
 {
@@ -43,10 +46,14 @@ TEST_CASE("[Texture]")
             }
             SECTION("Image not found")
             {
+#if TGUI_HAS_BACKEND_SFML
                 std::streambuf *oldbuf = sf::err().rdbuf(0);
+#endif
                 REQUIRE_THROWS_AS(tgui::Texture("NonExistent.png"), tgui::Exception);
                 REQUIRE_THROWS_AS(texture.load("NonExistent.png"), tgui::Exception);
+#if TGUI_HAS_BACKEND_SFML
                 sf::err().rdbuf(oldbuf);
+#endif
             }
 
             REQUIRE(texture.getId() == "");
@@ -177,6 +184,31 @@ TEST_CASE("[Texture]")
         REQUIRE(tgui::Texture("resources/image.png").isSmooth());
     }
 
+    SECTION("Alpha mask")
+    {
+        {
+            tgui::Texture texture{"resources/TransparentParts.png"};
+            REQUIRE(texture.getData()->backendTexture->isAlphaMaskEnabled());
+            REQUIRE(!texture.isTransparentPixel({15, 15}));
+            REQUIRE(texture.isTransparentPixel({16, 16}));
+
+            texture.getData()->backendTexture->setAlphaMaskEnabled(false);
+            REQUIRE(!texture.getData()->backendTexture->isAlphaMaskEnabled());
+            REQUIRE(!texture.isTransparentPixel({16, 16}));
+        }
+
+        REQUIRE(tgui::BackendTextureBase::getDefaultAlphaMaskEnabled());
+        tgui::BackendTextureBase::setDefaultAlphaMaskEnabled(false);
+        REQUIRE(!tgui::BackendTextureBase::getDefaultAlphaMaskEnabled());
+        {
+            tgui::Texture texture{"resources/TransparentParts.png"};
+            REQUIRE(!texture.getData()->backendTexture->isAlphaMaskEnabled());
+            REQUIRE(!texture.isTransparentPixel({16, 16}));
+        }
+
+        tgui::BackendTextureBase::setDefaultAlphaMaskEnabled(true);
+    }
+
     SECTION("Color")
     {
         tgui::Texture texture{"resources/image.png"};
@@ -186,6 +218,7 @@ TEST_CASE("[Texture]")
         REQUIRE(texture.getColor() == tgui::Color::Red);
     }
 
+#if TGUI_HAS_BACKEND_SFML
     SECTION("Shader")
     {
         tgui::Texture texture{"resources/image.png"};
@@ -198,6 +231,7 @@ TEST_CASE("[Texture]")
         texture.setShader(nullptr);
         REQUIRE(!texture.getShader());
     }
+#endif
 
     SECTION("BackendTextureLoader")
     {
@@ -225,7 +259,7 @@ TEST_CASE("[Texture]")
         auto func = [&](tgui::Texture& texture, const tgui::String& filename, bool) {
             REQUIRE(filename == "resources/image.png");
             auto data = std::make_shared<tgui::TextureData>();
-            data->backendTexture = std::make_shared<tgui::BackendTextureSFML>();
+            data->backendTexture = tgui::getBackend()->createTexture();
             texture.getBackendTextureLoader()(*data->backendTexture, filename);
             count++;
             return data;
@@ -26,14 +26,21 @@
 #include <TGUI/TextureManager.hpp>
 #include <TGUI/Exception.hpp>
 #include <TGUI/Texture.hpp>
-#include <SFML/System/Err.hpp>
+#include <TGUI/Sprite.hpp>
+#if TGUI_HAS_BACKEND_SFML
+    #include <SFML/System/Err.hpp>
+#endif
 
 TEST_CASE("[TextureManager]")
 {
+#if TGUI_HAS_BACKEND_SFML
     std::streambuf *oldbuf = sf::err().rdbuf(0);
+#endif
     tgui::Texture texture;
     REQUIRE(tgui::TextureManager::getTexture(texture, "NonExistent.png", true) == nullptr);
+#if TGUI_HAS_BACKEND_SFML
     sf::err().rdbuf(oldbuf);
+#endif
 
     tgui::Texture texture1;
     tgui::Texture texture2;
@@ -58,4 +65,157 @@ TEST_CASE("[TextureManager]")
     REQUIRE_THROWS_AS(tgui::TextureManager::removeTexture(textureData1), tgui::Exception);
 
     REQUIRE_NOTHROW(tgui::TextureManager::removeTexture(textureData3));
+
+    tgui::TextureManager::setAtlasEnabled(true);
+    REQUIRE(tgui::TextureManager::isAtlasEnabled());
+    REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+    REQUIRE(tgui::TextureManager::getAtlasFillRatio() == 0);
+    {
+        tgui::Texture atlasTexture1{"resources/image.png"};
+        tgui::Texture atlasTexture2{"resources/TransparentParts.png", {10, 20, 30, 25}};
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+        REQUIRE(atlasTexture1.getData()->backendTexture == atlasTexture2.getData()->backendTexture);
+        REQUIRE(atlasTexture1.getData()->backendTexture->getSize() == tgui::Vector2u(1024, 1024));
+        REQUIRE(atlasTexture1.getImageSize() == tgui::Vector2u(50, 50));
+        REQUIRE(atlasTexture2.getPartRect() == tgui::UIntRect(10, 20, 30, 25));
+        REQUIRE(tgui::TextureManager::getAtlasFillRatio() == Approx(2 * 50.f * 50.f / (1024.f * 1024.f)));
+
+        // The space of a removed image is reused by the next image that fits in it
+        tgui::UIntRect removedAtlasRect;
+        {
+            tgui::Texture atlasTexture3{"resources/Texture1.png"};
+            removedAtlasRect = atlasTexture3.getData()->atlasRect;
+        }
+        tgui::Texture atlasTexture4{"resources/Texture2.png"};
+        REQUIRE(atlasTexture4.getData()->atlasRect == removedAtlasRect);
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+
+        tgui::Texture unsmoothTexture{"resources/image.png", {}, {}, false};
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 2);
+    }
+    REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+
+    // The space of neighbouring removed images is merged, so that a larger image fits in it
+    tgui::TextureManager::setAtlasPageSize(160);
+    {
+        std::vector<std::unique_ptr<tgui::Texture>> textures;
+        for (unsigned int i = 1; i <= 8; ++i)
+            textures.push_back(std::make_unique<tgui::Texture>("resources/Texture" + tgui::String::fromNumber(i) + ".png"));
+        textures.push_back(std::make_unique<tgui::Texture>("resources/image.png"));
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+        REQUIRE(textures[1]->getData()->atlasRect == tgui::UIntRect(53, 1, 50, 50));
+
+        textures[0] = nullptr;
+        textures[1] = nullptr;
+        tgui::Texture largerTexture{"resources/CheckBox2.png"};
+        REQUIRE(largerTexture.getData()->atlasRect == tgui::UIntRect(1, 1, 70, 40));
+        REQUIRE(tgui::TextureManager::getAtlasPageCount() == 1);
+    }
+    REQUIRE(tgui::TextureManager::getAtlasPageCount() == 0);
+    tgui::TextureManager::setAtlasPageSize(1024);
+    tgui::TextureManager::setAtlasEnabled(false);
+
+    tgui::TextureManager::setAsyncLoadingEnabled(true);
+    REQUIRE(tgui::TextureManager::isAsyncLoadingEnabled());
+    {
+        std::vector<std::pair<tgui::String, bool>> finishedImages;
+        tgui::TextureManager::setAsyncLoadFinishedCallback([&](const tgui::String& filename, bool success){ finishedImages.emplace_back(filename, success); });
+
+        tgui::Texture asyncTexture1{"resources/image.png"};
+        tgui::Texture asyncTexture2{"resources/image.png", {10, 20, 30, 25}};
+        REQUIRE(asyncTexture1.isLoading());
+        REQUIRE(asyncTexture2.isLoading());
+        REQUIRE(asyncTexture1.getData() == asyncTexture2.getData());
+        REQUIRE(asyncTexture1.getImageSize() == tgui::Vector2u(0, 0));
+        REQUIRE(asyncTexture2.getImageSize() == tgui::Vector2u(30, 25));
+
+        tgui::Sprite sprite{asyncTexture1};
+        REQUIRE(!sprite.isSet());
+
+        // A missing file is only detected once the image is decoded
+        tgui::Texture missingTexture;
+        REQUIRE_NOTHROW(missingTexture.load("resources/NonExistent.png"));
+        REQUIRE(missingTexture.isLoading());
+
+        tgui::TextureManager::updateAsyncLoads(true);
+        REQUIRE(tgui::TextureManager::getAsyncLoadsPending() == 0);
+        REQUIRE(finishedImages.size() == 2);
+
+        REQUIRE(!asyncTexture1.isLoading());
+        REQUIRE(asyncTexture1.getImageSize() == tgui::Vector2u(50, 50));
+        REQUIRE(asyncTexture1.getMiddleRect() == tgui::UIntRect(0, 0, 50, 50));
+        REQUIRE(asyncTexture2.getPartRect() == tgui::UIntRect(10, 20, 30, 25));
+        REQUIRE(sprite.isSet());
+
+        REQUIRE(!missingTexture.isLoading());
+        REQUIRE(missingTexture.getImageSize() == tgui::Vector2u(0, 0));
+
+        tgui::TextureManager::setAsyncLoadFinishedCallback(nullptr);
+    }
+    tgui::TextureManager::setAsyncLoadingEnabled(false);
+
+    tgui::TextureManager::setMemoryBudget(15000);
+    REQUIRE(tgui::TextureManager::getMemoryBudget() == 15000);
+    {
+        tgui::TextureManager::resetMemoryStatistics();
+
+        tgui::Texture usedTexture{"resources/image.png"};
+        tgui::Texture unusedTexture{"resources/TransparentParts.png"};
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().residentBytes == 2 * 50 * 50 * 4);
+
+        // Images that were just loaded aren't evicted before they had a chance to be drawn
+        REQUIRE(tgui::TextureManager::enforceMemoryBudget());
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().evictions == 0);
+
+        // Images are only evicted when they weren't used since the last frame started, no matter how much time has passed
+        REQUIRE(tgui::TextureManager::enforceMemoryBudget());
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().evictions == 0);
+
+        tgui::TextureManager::startFrame();
+        REQUIRE(usedTexture.getBackendTexture() != nullptr);
+        REQUIRE(!tgui::TextureManager::enforceMemoryBudget());
+        REQUIRE(!usedTexture.getData()->evicted);
+        REQUIRE(unusedTexture.getData()->evicted);
+        REQUIRE(unusedTexture.getImageSize() == tgui::Vector2u(50, 50));
+
+        auto statistics = tgui::TextureManager::getMemoryStatistics();
+        REQUIRE(statistics.residentBytes == 50 * 50 * 4);
+        REQUIRE(statistics.evictions == 1);
+        REQUIRE(statistics.reloads == 0);
+
+        // Transparent pixels are still known without loading the image again
+        REQUIRE(!unusedTexture.isTransparentPixel({15, 15}));
+        REQUIRE(unusedTexture.isTransparentPixel({16, 16}));
+        REQUIRE(unusedTexture.getData()->evicted);
+
+        // The image is loaded again when it is needed
+        REQUIRE(unusedTexture.getBackendTexture()->getSize() == tgui::Vector2u(50, 50));
+        REQUIRE(!unusedTexture.getData()->evicted);
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().reloads == 1);
+        REQUIRE(tgui::TextureManager::getMemoryStatistics().residentBytes == 2 * 50 * 50 * 4);
+    }
+    tgui::TextureManager::setMemoryBudget(0);
+}
+
+TEST_CASE("[TextureManager] Copying textures", "[.][benchmark]")
+{
+    // The images don't need to exist, the loader creates a small image for every filename
+    const auto oldLoader = tgui::Texture::getBackendTextureLoader();
+    tgui::Texture::setBackendTextureLoader([](tgui::BackendTextureBase& backendTexture, const tgui::String&){
+            return backendTexture.load({1, 1}, std::make_unique<std::uint8_t[]>(4));
+        });
+
+    std::vector<tgui::Texture> textures;
+    for (unsigned int i = 0; i < 5000; ++i)
+        textures.emplace_back("Image" + tgui::String::fromNumber(i) + ".png");
+
+    REQUIRE(tgui::TextureManager::getCachedImagesCount() >= 5000);
+
+    BENCHMARK("Copy and destroy 5000 textures")
+    {
+        std::vector<tgui::Texture> copies = textures;
+    }
+
+    textures.clear();
+    tgui::Texture::setBackendTextureLoader(oldLoader);
 }
@@ -89,7 +89,7 @@ TEST_CASE("[Widget]")
 
     SECTION("ParentGui")
     {
-        auto gui = std::make_unique<tgui::GuiSFML>();
+        auto gui = std::make_unique<TestGui>();
         auto panel = tgui::Panel::create();
         panel->add(widget);
 
@@ -369,7 +369,7 @@ TEST_CASE("[Widget]")
             REQUIRE(renderer->getFont() == nullptr);
 
             // Inheriting the font does not change the renderer (but the widget will have a usable font)
-            tgui::GuiSFML gui;
+            TestGui gui;
             gui.add(widget);
             REQUIRE(renderer->getFont() == nullptr);
         }
@@ -74,6 +74,26 @@ TEST_CASE("[ComboBox]")
         REQUIRE(comboBox->getItemById("2") == "Item 2");
         REQUIRE(comboBox->getItemById("3") == "");
     }
+
+    SECTION("Adding multiple items")
+    {
+        comboBox->addItem("Item 1", "1");
+        comboBox->addMultipleItems({"Item 2", "Item 3", "Item 4"}, {"2", "3"});
+        REQUIRE(comboBox->getItemCount() == 4);
+
+        REQUIRE(comboBox->getItems()[0] == "Item 1");
+        REQUIRE(comboBox->getItems()[1] == "Item 2");
+        REQUIRE(comboBox->getItems()[3] == "Item 4");
+
+        REQUIRE(comboBox->getItemIds()[1] == "2");
+        REQUIRE(comboBox->getItemIds()[2] == "3");
+        REQUIRE(comboBox->getItemIds()[3] == "");
+
+        comboBox->setMaximumItems(5);
+        comboBox->addMultipleItems({"Item 5", "Item 6"});
+        REQUIRE(comboBox->getItemCount() == 5);
+        REQUIRE(comboBox->getItems()[4] == "Item 5");
+    }
     
     SECTION("Removing items")
     {
@@ -267,6 +287,39 @@ TEST_CASE("[ComboBox]")
         REQUIRE(!comboBox->getChangeItemOnScroll());
     }
 
+    SECTION("SearchIndex")
+    {
+        REQUIRE(!comboBox->isSearchIndexEnabled());
+        comboBox->setSearchIndexEnabled(true);
+        REQUIRE(comboBox->isSearchIndexEnabled());
+
+        comboBox->addMultipleItems({"Item 1", "Item 2", "Item 3"}, {"1", "2", "3"});
+        REQUIRE(comboBox->setSelectedItemById("2"));
+        REQUIRE(comboBox->getSelectedItem() == "Item 2");
+        REQUIRE(comboBox->removeItemById("1"));
+        REQUIRE(comboBox->getSelectedItemIndex() == 0);
+        REQUIRE(comboBox->containsId("3"));
+        REQUIRE(!comboBox->contains("Item 1"));
+    }
+
+    SECTION("TypeAhead")
+    {
+        comboBox->addMultipleItems({"one", "two", "three"});
+
+        REQUIRE(!comboBox->isTypeAheadEnabled());
+        comboBox->setTypeAheadEnabled(true);
+        REQUIRE(comboBox->isTypeAheadEnabled());
+
+        unsigned int itemSelectedCount = 0;
+        comboBox->onItemSelect([&]{ itemSelectedCount++; });
+
+        comboBox->textEntered('t');
+        REQUIRE(comboBox->getSelectedItem() == "two");
+        comboBox->textEntered('h');
+        REQUIRE(comboBox->getSelectedItem() == "three");
+        REQUIRE(itemSelectedCount == 2);
+    }
+
     SECTION("Events / Signals")
     {
         SECTION("Widget")
@@ -523,6 +576,8 @@ TEST_CASE("[ComboBox]")
         comboBox->setSelectedItem("Item 2");
         comboBox->setExpandDirection(tgui::ComboBox::ExpandDirection::Up);
         comboBox->setChangeItemOnScroll(false);
+        comboBox->setSearchIndexEnabled(true);
+        comboBox->setTypeAheadEnabled(true);
 
         testSavingWidget("ComboBox", comboBox);
     }
@@ -89,6 +89,26 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getItemById("3") == "");
     }
 
+    SECTION("Adding multiple items")
+    {
+        listBox->addItem("Item 1", "1");
+        listBox->addMultipleItems({"Item 2", "Item 3", "Item 4"}, {"2", "3"});
+        REQUIRE(listBox->getItemCount() == 4);
+
+        REQUIRE(listBox->getItems()[0] == "Item 1");
+        REQUIRE(listBox->getItems()[1] == "Item 2");
+        REQUIRE(listBox->getItems()[3] == "Item 4");
+
+        REQUIRE(listBox->getItemIds()[1] == "2");
+        REQUIRE(listBox->getItemIds()[2] == "3");
+        REQUIRE(listBox->getItemIds()[3] == "");
+
+        listBox->setMaximumItems(5);
+        listBox->addMultipleItems({"Item 5", "Item 6"});
+        REQUIRE(listBox->getItemCount() == 5);
+        REQUIRE(listBox->getItems()[4] == "Item 5");
+    }
+
     SECTION("Getters")
     {
         listBox->addItem("Item 1", "1");
@@ -302,6 +322,78 @@ TEST_CASE("[ListBox]")
         REQUIRE(listBox->getAutoScroll());
     }
 
+    SECTION("SearchIndex")
+    {
+        REQUIRE(!listBox->isSearchIndexEnabled());
+        listBox->addMultipleItems({"Apple", "banana", "Berry", "banana"}, {"1", "2", "3", "4"});
+        listBox->setSearchIndexEnabled(true);
+        REQUIRE(listBox->isSearchIndexEnabled());
+
+        REQUIRE(listBox->getIndexById("3") == 2);
+        REQUIRE(listBox->contains("banana"));
+        REQUIRE(listBox->setSelectedItem("banana"));
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+
+        REQUIRE(listBox->findItemByPrefix("b") == 1);
+        REQUIRE(listBox->findItemByPrefix("BE") == 2);
+        REQUIRE(listBox->findItemByPrefix("b", 2) == 2);
+        REQUIRE(listBox->findItemByPrefix("a", 1) == 0);
+        REQUIRE(listBox->findItemByPrefix("c") == -1);
+        REQUIRE(listBox->findItemByPrefix("", 3) == 3);
+        REQUIRE(listBox->findItemByPrefix("bananas") == -1);
+        REQUIRE(listBox->findItemByPrefix("Banana", 2) == 3);
+        REQUIRE(listBox->findItemByPrefix("berry", 3) == 2);
+
+        // The index is kept up-to-date when items are removed or changed
+        REQUIRE(listBox->removeItemByIndex(1));
+        REQUIRE(listBox->getIndexById("3") == 1);
+        REQUIRE(listBox->getIndexById("2") == -1);
+        REQUIRE(listBox->setSelectedItem("banana"));
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+        REQUIRE(listBox->changeItemById("1", "Cherry"));
+        REQUIRE(listBox->findItemByPrefix("a") == -1);
+        REQUIRE(listBox->findItemByPrefix("ch") == 0);
+
+        listBox->addItem("avocado", "5");
+        REQUIRE(listBox->findItemByPrefix("A") == 3);
+        REQUIRE(listBox->getItemById("5") == "avocado");
+
+        listBox->setSearchIndexEnabled(false);
+        REQUIRE(!listBox->isSearchIndexEnabled());
+        REQUIRE(listBox->findItemByPrefix("A") == 3);
+    }
+
+    SECTION("TypeAhead")
+    {
+        REQUIRE(!listBox->isTypeAheadEnabled());
+        listBox->addMultipleItems({"Apple", "banana", "Berry", "blueberry", "Cherry"});
+
+        listBox->textEntered('b');
+        REQUIRE(listBox->getSelectedItemIndex() == -1);
+
+        listBox->setTypeAheadEnabled(true);
+        REQUIRE(listBox->isTypeAheadEnabled());
+
+        // Typing the same character again moves to the next item starting with that character
+        listBox->textEntered('b');
+        REQUIRE(listBox->getSelectedItemIndex() == 1);
+        listBox->textEntered('b');
+        REQUIRE(listBox->getSelectedItemIndex() == 2);
+
+        // Typing more characters narrows down the search
+        listBox->setTypeAheadEnabled(true);
+        listBox->textEntered('b');
+        listBox->textEntered('l');
+        REQUIRE(listBox->getSelectedItem() == "blueberry");
+
+        listBox->setTypeAheadEnabled(true);
+        listBox->textEntered('C');
+        REQUIRE(listBox->getSelectedItem() == "Cherry");
+        listBox->textEntered('x');
+        REQUIRE(listBox->getSelectedItem() == "Cherry");
+    }
+
     testWidgetSignals(listBox);
     SECTION("Events / Signals")
     {
@@ -549,6 +641,8 @@ TEST_CASE("[ListBox]")
         listBox->setTextSize(20);
         listBox->setMaximumItems(5);
         listBox->setAutoScroll(false);
+        listBox->setSearchIndexEnabled(true);
+        listBox->setTypeAheadEnabled(true);
 
         testSavingWidget("ListBox", listBox);
     }
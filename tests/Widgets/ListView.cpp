@@ -26,6 +26,7 @@
 #include <TGUI/Widgets/ListView.hpp>
 #include <TGUI/Widgets/Group.hpp>
 #include <TGUI/Backend.hpp>
+#include <thread>
 
 TEST_CASE("[ListView]")
 {
@@ -227,6 +228,105 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"200", "-5", "20"}, {"1000", "7", ""}, {"300", "", ""}});
     }
 
+    SECTION("Sorting and filtering displayed items")
+    {
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addMultipleItems({{"b", "10"}, {"a", "9"}, {"c", "x"}, {"d", "-1.5"}, {"e"}});
+        REQUIRE(listView->getSortColumn() == -1);
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 1, 2, 3, 4});
+
+        // Numbers are compared by value and placed before texts
+        listView->setSortColumn(1);
+        REQUIRE(listView->getSortColumn() == 1);
+        REQUIRE(listView->getSortAscending());
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{3, 1, 0, 4, 2});
+
+        listView->setSortColumn(1, false);
+        REQUIRE(!listView->getSortAscending());
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{2, 4, 0, 1, 3});
+
+        // The item indices don't change
+        REQUIRE(listView->getItem(0) == "b");
+        REQUIRE(listView->getItemRows() == std::vector<std::vector<tgui::String>>{{"b", "10"}, {"a", "9"}, {"c", "x"}, {"d", "-1.5"}, {"e", ""}});
+
+        listView->setSortColumn(0);
+        listView->setItemFilter("A");
+        REQUIRE(listView->getItemFilter() == "A");
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{1});
+        REQUIRE(!listView->isSortingOrFiltering());
+
+        listView->setItemFilter("");
+        listView->removeItem(1);
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 1, 2, 3});
+
+        // New and changed items are placed in the existing order without sorting all items again
+        listView->insertItem(0, {"f", "1"});
+        listView->addItem("0");
+        REQUIRE(!listView->isSortingOrFiltering());
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{5, 1, 2, 3, 4, 0});
+
+        listView->changeItem(4, {"a", "2"});
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{5, 4, 1, 2, 3, 0});
+
+        listView->setSortColumn(0, false);
+        listView->addMultipleItems({{"c2"}, {"c"}, {"z"}});
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{8, 0, 3, 6, 2, 7, 1, 4, 5});
+
+        listView->setItemFilter("c");
+        listView->changeSubItem(0, 1, "c");
+        listView->addItem("C3");
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 6, 2, 7, 9});
+
+        // The result is the same as when all items are sorted again
+        listView->setSortColumn(0);
+        listView->setSortColumn(0, false);
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 6, 2, 7, 9});
+
+        listView->setItemFilter("");
+        listView->setSortColumn(-1);
+        REQUIRE(listView->getDisplayedItemIndices() == std::vector<std::size_t>{0, 1, 2, 3, 4, 5, 6, 7, 8, 9});
+    }
+
+    SECTION("Sorting many items in the background")
+    {
+        listView->addColumn("Col 1");
+        std::vector<std::vector<tgui::String>> items;
+        for (unsigned int i = 0; i < 20000; ++i)
+            items.push_back({tgui::String::fromNumber((i * 7919) % 20000)});
+        listView->addMultipleItems(items);
+
+        // A new job replaces the one that is still queued or running
+        listView->setSortColumn(0, false);
+        listView->setSortColumn(0);
+        REQUIRE(listView->isSortingOrFiltering());
+
+        // A copy that is made while the job is running also gets its result
+        auto copiedListView = tgui::ListView::copy(listView);
+        REQUIRE(copiedListView->isSortingOrFiltering());
+
+        // A list view that is destroyed while its job is running waits for its thread
+        tgui::ListView::copy(listView)->setSortColumn(0, false);
+
+        const std::vector<tgui::Widget::Ptr> widgets{listView, copiedListView};
+        while (listView->isSortingOrFiltering() || copiedListView->isSortingOrFiltering())
+        {
+            for (const auto& widget : widgets)
+                widget->updateTime(std::chrono::milliseconds(1));
+
+            std::this_thread::yield();
+        }
+
+        const auto displayedItems = listView->getDisplayedItemIndices();
+        REQUIRE(copiedListView->getDisplayedItemIndices() == displayedItems);
+        REQUIRE(displayedItems.size() == 20000);
+        for (std::size_t row = 0; row < displayedItems.size(); ++row)
+        {
+            if (listView->getItemCell(displayedItems[row], 0) != tgui::String::fromNumber(row))
+                FAIL("Row " << row << " contains the wrong item");
+        }
+    }
+
     SECTION("Returned item rows depend on columns")
     {
         listView->addItem({"1,1", "1,2", "1,3"});
@@ -300,6 +400,47 @@ TEST_CASE("[ListView]")
         REQUIRE(listView->getSelectedItemIndices() == std::set<std::size_t>{ });
     }
 
+    SECTION("Virtual items")
+    {
+        listView->addColumn("Col 1");
+        listView->addColumn("Col 2");
+        listView->addItem("Item");
+        REQUIRE(!listView->hasVirtualItems());
+
+        std::size_t calls = 0;
+        listView->setVirtualItems(1000000, [&](std::size_t row, std::size_t column){
+            ++calls;
+            return tgui::String::fromNumber(row) + "," + tgui::String::fromNumber(column);
+        });
+        REQUIRE(listView->hasVirtualItems());
+        REQUIRE(listView->getItemCount() == 1000000);
+        REQUIRE(calls == 0);
+
+        REQUIRE(listView->getItem(5) == "5,0");
+        REQUIRE(listView->getItemCell(999999, 1) == "999999,1");
+        REQUIRE(listView->getItemCell(999999, 2) == "");
+        REQUIRE(listView->getItemCell(1000000, 0) == "");
+        REQUIRE(listView->getItemRow(42) == std::vector<tgui::String>{"42,0", "42,1"});
+
+        listView->setSelectedItem(500000);
+        REQUIRE(listView->getSelectedItemIndex() == 500000);
+
+        // Items can't be modified in virtual mode
+        REQUIRE(!listView->removeItem(0));
+        REQUIRE(!listView->changeItem(0, {"x"}));
+        listView->addItem("x");
+        REQUIRE(listView->getItemCount() == 1000000);
+
+        listView->setVirtualItemCount(3);
+        REQUIRE(listView->getItemCount() == 3);
+        REQUIRE(listView->getSelectedItemIndex() == -1);
+        REQUIRE(listView->getItems() == std::vector<tgui::String>{"0,0", "1,0", "2,0"});
+
+        listView->removeAllItems();
+        REQUIRE(!listView->hasVirtualItems());
+        REQUIRE(listView->getItemCount() == 0);
+    }
+
     SECTION("Header height")
     {
         listView->setHeaderHeight(50);
@@ -430,6 +571,30 @@ TEST_CASE("[ListView]")
         REQUIRE(!listView->getExpandLastColumn());
     }
 
+    SECTION("Horizontal scrollbar follows widest item")
+    {
+        listView->setSize(100, 100);
+        listView->addItem("Short");
+        listView->addItem("This item is a lot wider than the list view");
+        listView->addItem("Short");
+
+        listView->setHorizontalScrollbarValue(1000);
+        const unsigned int maxScrollbarValue = listView->getHorizontalScrollbarValue();
+        REQUIRE(maxScrollbarValue > 0);
+
+        listView->changeItem(1, {"Short"});
+        listView->setHorizontalScrollbarValue(1000);
+        REQUIRE(listView->getHorizontalScrollbarValue() == 0);
+
+        listView->changeSubItem(2, 0, "This item is a lot wider than the list view");
+        listView->setHorizontalScrollbarValue(1000);
+        REQUIRE(listView->getHorizontalScrollbarValue() == maxScrollbarValue);
+
+        listView->removeItem(2);
+        listView->setHorizontalScrollbarValue(1000);
+        REQUIRE(listView->getHorizontalScrollbarValue() == 0);
+    }
+
     SECTION("AutoScroll")
     {
         REQUIRE(listView->getAutoScroll());
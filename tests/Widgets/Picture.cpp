@@ -43,22 +43,23 @@ TEST_CASE("[Picture]")
 
     SECTION("Create")
     {
-        sf::Texture texture;
-        texture.loadFromFile("resources/image.png");
-
         SECTION("from tgui::Texture")
         {
             REQUIRE_NOTHROW(picture = tgui::Picture::create("resources/image.png"));
             REQUIRE(picture->getRenderer()->getTexture().getId() == "resources/image.png");
         }
 
+#if TGUI_HAS_BACKEND_SFML
         SECTION("from sf::Texture")
         {
+            sf::Texture texture;
+            texture.loadFromFile("resources/image.png");
             REQUIRE_NOTHROW(picture = tgui::Picture::create(texture));
             REQUIRE(picture->getRenderer()->getTexture().getId() == "");
         }
+#endif
 
-        REQUIRE(picture->getSize() == tgui::Vector2f(static_cast<float>(texture.getSize().x), static_cast<float>(texture.getSize().y)));
+        REQUIRE(picture->getSize() == tgui::Vector2f(50, 50));
     }
 
     SECTION("Position and Size")
@@ -100,7 +101,7 @@ TEST_CASE("[Picture]")
             picture->leftMousePressed({115, 80});
             picture->leftMouseReleased({115, 80});
 
-            tgui::GuiSFML gui;
+            TestGui gui;
             gui.add(picture);
             gui.updateTime(DOUBLE_CLICK_TIMEOUT);
 
@@ -387,6 +387,7 @@ TEST_CASE("[TextArea]")
 
             SECTION("Pressing tab")
             {
+#if TGUI_HAS_BACKEND_SFML
                 auto sendTabEventToGui = [](tgui::GuiSFML& gui) {
                     sf::Event event;
                     event.key = sf::Event::KeyEvent();
@@ -403,6 +404,20 @@ TEST_CASE("[TextArea]")
 
                 sf::RenderTexture tempRenderTexture;
                 tgui::GuiSFML gui{tempRenderTexture};
+#else
+                auto sendTabEventToGui = [](tgui::GuiSoftware& gui) {
+                    tgui::Event event;
+                    event.type = tgui::Event::Type::KeyPressed;
+                    event.key.control = false;
+                    event.key.alt     = false;
+                    event.key.shift   = false;
+                    event.key.system  = false;
+                    event.key.code    = tgui::Event::KeyboardKey::Tab;
+                    gui.handleEvent(event);
+                };
+
+                tgui::GuiSoftware gui{{1, 1}};
+#endif
                 gui.add(textArea);
 
                 textArea->setText("");
@@ -1,4 +1,5 @@
 #define CATCH_CONFIG_RUNNER
+#define CATCH_CONFIG_NO_POSIX_SIGNALS // The signal handler of this Catch version doesn't compile with glibc 2.34 or newer
 #include "Tests.hpp"
 
 #include <TGUI/TextureManager.hpp>
@@ -7,7 +8,7 @@ int main (int argc, char * argv[])
 {
     // All tests are performed while a Gui object exists.
     // This will keep the global font alive instead of being destructed and reconstructed multiple times between the tests.
-    tgui::GuiSFML gui;
+    TestGui gui;
 
     return Catch::Session().run(argc, argv);
 }